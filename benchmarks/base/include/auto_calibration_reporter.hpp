@@ -0,0 +1,137 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/auto_bitset.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Display reporter collecting the times of the auto_* benchmarks of the representations of fix::auto_bitset for its
+// calibration (see auto.cpp). For each size and density, the calibration chooses the representation with the lowest
+// time for a workload calling each operation once: a ratio per operation would let an operation that is almost free in
+// a representation, as the count of fix::roaring_bitset from the cardinalities of its chunks, hide slower bulk ones.
+class auto_calibration_reporter final : public benchmark::BenchmarkReporter
+{
+public:
+    explicit auto_calibration_reporter(benchmark::BenchmarkReporter* display_reporter) noexcept
+      : m_display_reporter(display_reporter)
+    {
+    }
+
+    // benchmark filter of the calibration: the auto_* benchmarks of the representations
+    [[nodiscard]] static std::string benchmark_filter()
+    {
+        std::string filter = "^(";
+        for(size_t i = 0; i < fix::auto_bitset_representations_number; ++i)
+        {
+            if(i != 0)
+            {
+                filter += '|';
+            }
+            filter += fix::auto_bitset_representation_name(static_cast<fix::auto_bitset_representation>(i));
+        }
+        filter += ") auto_";
+        return filter;
+    }
+
+    bool ReportContext(const Context& context) override
+    {
+        m_display_reporter->SetOutputStream(&GetOutputStream());
+        m_display_reporter->SetErrorStream(&GetErrorStream());
+        return m_display_reporter->ReportContext(context);
+    }
+
+    void ReportRuns(const std::vector<Run>& runs) override
+    {
+        for(const Run& run: runs)
+        {
+            if(run.run_type == Run::RT_Aggregate)
+            {
+                continue;
+            }
+
+            // "<representation name> <operation>" and "bits:<bits>/density_inverse:<density_inverse>"
+            const std::string& name = run.run_name.function_name;
+            const size_t separator = name.rfind(' ');
+            size_t bits = 0;
+            size_t density_inverse = 0;
+            if(separator == std::string::npos
+               || std::sscanf(run.run_name.args.c_str(), "bits:%zu/density_inverse:%zu", &bits, &density_inverse) != 2)
+            {
+                continue;
+            }
+            const std::optional<fix::auto_bitset_representation> representation =
+              fix::auto_bitset_representation_from_name(std::string_view(name).substr(0, separator));
+            if(!representation)
+            {
+                continue;
+            }
+            m_times[{bits, density_inverse}][name.substr(separator + 1)][*representation] = run.GetAdjustedRealTime();
+        }
+        m_display_reporter->ReportRuns(runs);
+    }
+
+    void Finalize() override
+    {
+        m_display_reporter->Finalize();
+    }
+
+    // representations measured on all the operations of a size and density are compared, the others are ignored
+    [[nodiscard]] fix::auto_bitset_calibration calibration() const
+    {
+        fix::auto_bitset_calibration result;
+        for(const auto& [size_density, operations]: m_times)
+        {
+            std::optional<fix::auto_bitset_representation> best;
+            double best_workload_time = std::numeric_limits<double>::max();
+            for(size_t i = 0; i < fix::auto_bitset_representations_number; ++i)
+            {
+                const auto representation = static_cast<fix::auto_bitset_representation>(i);
+                double workload_time = 0;
+                bool measured = true;
+                for(const auto& [operation, times]: operations)
+                {
+                    const auto it = times.find(representation);
+                    if(it == times.end())
+                    {
+                        measured = false;
+                        break;
+                    }
+                    workload_time += it->second;
+                }
+                if(measured && workload_time < best_workload_time)
+                {
+                    best = representation;
+                    best_workload_time = workload_time;
+                }
+            }
+            if(best)
+            {
+                result.set(size_density.first, size_density.second, *best);
+            }
+        }
+        return result;
+    }
+
+private:
+    std::unique_ptr<benchmark::BenchmarkReporter> m_display_reporter;
+    // (bits, density_inverse) -> operation -> representation -> time of an iteration
+    std::map<std::pair<size_t, size_t>, std::map<std::string, std::map<fix::auto_bitset_representation, double>>>
+      m_times;
+};
@@ -10,10 +10,43 @@
 #include <random>
 
 const std::minstd_rand::result_type SEED = std::random_device{}();
-static constexpr size_t RANGE_START = 64ull;
+// small sizes first, fix::small_bitset stores them without heap allocation
+static constexpr size_t RANGE_START = 8ull;
 static constexpr size_t RANGE_END = 1ull << 20u;
 static constexpr size_t RANGE_MULTIPLIER = 1ull << 2u;
 
+// bit patterns of the operands (see bit_pattern in utils.hpp), and sizes and bit patterns of the *_PATTERN_RANGE
+// benchmarks: sizes are sparser, to stay under the 100 inputs per benchmark above which google benchmark warns
+static constexpr size_t PATTERN_RANGE_MULTIPLIER = 1ull << 3u;
+
+#define BIT_PATTERNS benchmark::CreateDenseRange(0, static_cast<int64_t>(bit_patterns_number) - 1, 1)
+
+#define PATTERN_RANGE {benchmark::CreateRange(RANGE_START, RANGE_END, PATTERN_RANGE_MULTIPLIER), BIT_PATTERNS}
+
+// multi-threaded adapters, around parallel::default_threshold (2^24 bits), the benchmarks force the parallel path
+static constexpr size_t PARALLEL_RANGE_START = 1ull << 20u;
+static constexpr size_t PARALLEL_RANGE_END = 1ull << 30u;
+
+// streaming adapters, from sizes fitting in the caches to sizes much larger than the last level cache
+static constexpr size_t STREAMING_RANGE_START = 1ull << 16u;
+static constexpr size_t STREAMING_RANGE_END = 1ull << 30u;
+
+// sparse-into-dense adapters, one bit on in sparse_density_inverse of the sparse operand, around the switch point
+static constexpr size_t SPARSE_RANGE_START = 1ull << 12u;
+static constexpr size_t SPARSE_RANGE_END = 1ull << 20u;
+
+// bit matrix transpose, number of columns up to the points of the largest set cover instances
+static constexpr size_t TRANSPOSE_RANGE_START = 1ull << 10u;
+static constexpr size_t TRANSPOSE_RANGE_END = 1ull << 20u;
+
+// compressed bitsets, from one chunk of fix::roaring_bitset (2^16 bits) to many, one bit on in density_inverse
+static constexpr size_t COMPRESSED_RANGE_START = 1ull << 12u;
+static constexpr size_t COMPRESSED_RANGE_END = 1ull << 22u;
+
+// concurrent single bit operations, from bitsets fitting in the first level cache to larger than the second level one
+static constexpr size_t ATOMIC_RANGE_START = 1ull << 12u;
+static constexpr size_t ATOMIC_RANGE_END = 1ull << 22u;
+
 // sul::dynamic_bitset benchmark
 #define SUL_DYNAMIC_BITSET_BENCHMARK_TEMPLATE(func, block_type, name) \
     BENCHMARK_TEMPLATE(func, block_type)->Name("sul::dynamic_bitset<" #block_type "> " name)
@@ -34,6 +67,17 @@ static constexpr size_t RANGE_MULTIPLIER = 1ull << 2u;
     SUL_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_RANGE(func, uint32_t, name); \
     SUL_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_RANGE(func, uint64_t, name)
 
+#define SUL_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, block_type, name) \
+    BENCHMARK_TEMPLATE(func, block_type) \
+      ->Name("sul::dynamic_bitset<" #block_type "> " name) \
+      ->ArgNames({"bits", "pattern"}) \
+      ->ArgsProduct(PATTERN_RANGE)
+
+#define SUL_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(func, name) \
+    SUL_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint16_t, name); \
+    SUL_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint32_t, name); \
+    SUL_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint64_t, name)
+
 // boost::dynamic_bitset benchmark
 #define BOOST_DYNAMIC_BITSET_BENCHMARK_TEMPLATE(func, block_type, name) \
     BENCHMARK_TEMPLATE(func, block_type)->Name("boost::dynamic_bitset<" #block_type "> " name)
@@ -54,6 +98,17 @@ static constexpr size_t RANGE_MULTIPLIER = 1ull << 2u;
     BOOST_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_RANGE(func, uint32_t, name); \
     BOOST_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_RANGE(func, uint64_t, name)
 
+#define BOOST_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, block_type, name) \
+    BENCHMARK_TEMPLATE(func, block_type) \
+      ->Name("boost::dynamic_bitset<" #block_type "> " name) \
+      ->ArgNames({"bits", "pattern"}) \
+      ->ArgsProduct(PATTERN_RANGE)
+
+#define BOOST_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(func, name) \
+    BOOST_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint16_t, name); \
+    BOOST_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint32_t, name); \
+    BOOST_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint64_t, name)
+
 // std::tr2::dynamic_bitset benchmark
 #define STD_TR2_DYNAMIC_BITSET_BENCHMARK_TEMPLATE(func, block_type, name) \
     BENCHMARK_TEMPLATE(func, block_type)->Name("std::tr2::dynamic_bitset<" #block_type "> " name)
@@ -74,17 +129,95 @@ static constexpr size_t RANGE_MULTIPLIER = 1ull << 2u;
     STD_TR2_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_RANGE(func, uint32_t, name); \
     STD_TR2_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_RANGE(func, uint64_t, name)
 
+#define STD_TR2_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, block_type, name) \
+    BENCHMARK_TEMPLATE(func, block_type) \
+      ->Name("std::tr2::dynamic_bitset<" #block_type "> " name) \
+      ->ArgNames({"bits", "pattern"}) \
+      ->ArgsProduct(PATTERN_RANGE)
+
+#define STD_TR2_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(func, name) \
+    STD_TR2_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint16_t, name); \
+    STD_TR2_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint32_t, name); \
+    STD_TR2_DYNAMIC_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint64_t, name)
+
+// fix::aligned_bitset benchmark
+#define FIX_ALIGNED_BITSET_BENCHMARK_TEMPLATE(func, block_type, name) \
+    BENCHMARK_TEMPLATE(func, block_type)->Name("fix::aligned_bitset<" #block_type "> " name)
+
+#define FIX_ALIGNED_BITSET_BENCHMARK(func, name) \
+    FIX_ALIGNED_BITSET_BENCHMARK_TEMPLATE(func, uint16_t, name); \
+    FIX_ALIGNED_BITSET_BENCHMARK_TEMPLATE(func, uint32_t, name); \
+    FIX_ALIGNED_BITSET_BENCHMARK_TEMPLATE(func, uint64_t, name)
+
+#define FIX_ALIGNED_BITSET_BENCHMARK_TEMPLATE_RANGE(func, block_type, name) \
+    BENCHMARK_TEMPLATE(func, block_type) \
+      ->Name("fix::aligned_bitset<" #block_type "> " name) \
+      ->RangeMultiplier(RANGE_MULTIPLIER) \
+      ->Range(RANGE_START, RANGE_END)
+
+#define FIX_ALIGNED_BITSET_BENCHMARK_RANGE(func, name) \
+    FIX_ALIGNED_BITSET_BENCHMARK_TEMPLATE_RANGE(func, uint16_t, name); \
+    FIX_ALIGNED_BITSET_BENCHMARK_TEMPLATE_RANGE(func, uint32_t, name); \
+    FIX_ALIGNED_BITSET_BENCHMARK_TEMPLATE_RANGE(func, uint64_t, name)
+
+#define FIX_ALIGNED_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, block_type, name) \
+    BENCHMARK_TEMPLATE(func, block_type) \
+      ->Name("fix::aligned_bitset<" #block_type "> " name) \
+      ->ArgNames({"bits", "pattern"}) \
+      ->ArgsProduct(PATTERN_RANGE)
+
+#define FIX_ALIGNED_BITSET_BENCHMARK_PATTERN_RANGE(func, name) \
+    FIX_ALIGNED_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint16_t, name); \
+    FIX_ALIGNED_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint32_t, name); \
+    FIX_ALIGNED_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint64_t, name)
+
+// fix::small_bitset benchmark
+#define FIX_SMALL_BITSET_BENCHMARK_TEMPLATE(func, block_type, name) \
+    BENCHMARK_TEMPLATE(func, block_type)->Name("fix::small_bitset<" #block_type "> " name)
+
+#define FIX_SMALL_BITSET_BENCHMARK(func, name) \
+    FIX_SMALL_BITSET_BENCHMARK_TEMPLATE(func, uint16_t, name); \
+    FIX_SMALL_BITSET_BENCHMARK_TEMPLATE(func, uint32_t, name); \
+    FIX_SMALL_BITSET_BENCHMARK_TEMPLATE(func, uint64_t, name)
+
+#define FIX_SMALL_BITSET_BENCHMARK_TEMPLATE_RANGE(func, block_type, name) \
+    BENCHMARK_TEMPLATE(func, block_type) \
+      ->Name("fix::small_bitset<" #block_type "> " name) \
+      ->RangeMultiplier(RANGE_MULTIPLIER) \
+      ->Range(RANGE_START, RANGE_END)
+
+#define FIX_SMALL_BITSET_BENCHMARK_RANGE(func, name) \
+    FIX_SMALL_BITSET_BENCHMARK_TEMPLATE_RANGE(func, uint16_t, name); \
+    FIX_SMALL_BITSET_BENCHMARK_TEMPLATE_RANGE(func, uint32_t, name); \
+    FIX_SMALL_BITSET_BENCHMARK_TEMPLATE_RANGE(func, uint64_t, name)
+
+#define FIX_SMALL_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, block_type, name) \
+    BENCHMARK_TEMPLATE(func, block_type) \
+      ->Name("fix::small_bitset<" #block_type "> " name) \
+      ->ArgNames({"bits", "pattern"}) \
+      ->ArgsProduct(PATTERN_RANGE)
+
+#define FIX_SMALL_BITSET_BENCHMARK_PATTERN_RANGE(func, name) \
+    FIX_SMALL_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint16_t, name); \
+    FIX_SMALL_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint32_t, name); \
+    FIX_SMALL_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, uint64_t, name)
+
 // std::vector<bool> benchmark
 #define STD_VECTOR_BOOL_BENCHMARK(func, name) BENCHMARK(func)->Name("std::vector<bool> " name)
 
 #define STD_VECTOR_BOOL_BENCHMARK_RANGE(func, name) \
     BENCHMARK(func)->Name("std::vector<bool> " name)->RangeMultiplier(RANGE_MULTIPLIER)->Range(RANGE_START, RANGE_END)
 
+#define STD_VECTOR_BOOL_BENCHMARK_PATTERN_RANGE(func, name) \
+    BENCHMARK(func)->Name("std::vector<bool> " name)->ArgNames({"bits", "pattern"})->ArgsProduct(PATTERN_RANGE)
+
 // std::bitset benchmark
 #define STD_BITSET_BENCHMARK_TEMPLATE_RANGE(func, bits, name) \
     BENCHMARK_TEMPLATE(func, bits)->Name("std::bitset<" #bits "> " name)
 
 #define STD_BITSET_BENCHMARK_RANGE(func, name) \
+    STD_BITSET_BENCHMARK_TEMPLATE_RANGE(func, 8, name); \
+    STD_BITSET_BENCHMARK_TEMPLATE_RANGE(func, 16, name); \
     STD_BITSET_BENCHMARK_TEMPLATE_RANGE(func, 64, name); \
     STD_BITSET_BENCHMARK_TEMPLATE_RANGE(func, 256, name); \
     STD_BITSET_BENCHMARK_TEMPLATE_RANGE(func, 1024, name); \
@@ -93,3 +226,21 @@ static constexpr size_t RANGE_MULTIPLIER = 1ull << 2u;
     STD_BITSET_BENCHMARK_TEMPLATE_RANGE(func, 65536, name); \
     STD_BITSET_BENCHMARK_TEMPLATE_RANGE(func, 262144, name); \
     STD_BITSET_BENCHMARK_TEMPLATE_RANGE(func, 1048576, name)
+
+#define STD_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, bits, name) \
+    BENCHMARK_TEMPLATE(func, bits) \
+      ->Name("std::bitset<" #bits "> " name) \
+      ->ArgNames({"bits", "pattern"}) \
+      ->ArgsProduct({{bits}, BIT_PATTERNS})
+
+#define STD_BITSET_BENCHMARK_PATTERN_RANGE(func, name) \
+    STD_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, 8, name); \
+    STD_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, 16, name); \
+    STD_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, 64, name); \
+    STD_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, 256, name); \
+    STD_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, 1024, name); \
+    STD_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, 4096, name); \
+    STD_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, 16384, name); \
+    STD_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, 65536, name); \
+    STD_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, 262144, name); \
+    STD_BITSET_BENCHMARK_TEMPLATE_PATTERN_RANGE(func, 1048576, name)
@@ -0,0 +1,223 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/atomic_bitset.hpp>
+#include <fix/auto_bitset.hpp>
+#include <fix/roaring_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
+#include <sul/dynamic_bitset.hpp>
+#ifdef HAS_BOOST
+#    include <boost/dynamic_bitset.hpp>
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+#    include <tr2/dynamic_bitset>
+#endif
+
+#include <bitset>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Benchmark matrix of the fix adapters (see matrix.cpp): each operation is registered for each backend, with each block
+// type of the backends templated on it, and each size. A backend added to matrix::backends is measured on all of them.
+namespace matrix
+{
+    template<typename... types_t>
+    struct type_list
+    {
+    };
+
+    template<size_t... values>
+    struct size_list
+    {
+    };
+
+    // backend templated on its block type
+    template<typename backend_t>
+    concept block_backend = requires { typename backend_t::template type<uint64_t>; };
+
+    // block type measured for the backend: all of them, up to max_block_bits bits for the backends limited to the
+    // blocks of the fix kernels
+    template<typename backend_t, typename block_t>
+    concept backend_block_type =
+      !requires { backend_t::max_block_bits; } || sizeof(block_t) * CHAR_BIT <= backend_t::max_block_bits;
+
+    // backend templated on its number of bits, measured on its sizes only
+    template<typename backend_t>
+    concept fixed_size_backend = requires { typename backend_t::template type<64>; };
+
+    struct sul_dynamic_bitset
+    {
+        static constexpr std::string_view name = "sul::dynamic_bitset";
+        template<typename block_t>
+        using type = sul::dynamic_bitset<block_t>;
+    };
+
+#ifdef HAS_BOOST
+    struct boost_dynamic_bitset
+    {
+        static constexpr std::string_view name = "boost::dynamic_bitset";
+        template<typename block_t>
+        using type = boost::dynamic_bitset<block_t>;
+    };
+#endif
+
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+    struct std_tr2_dynamic_bitset
+    {
+        static constexpr std::string_view name = "std::tr2::dynamic_bitset";
+        template<typename block_t>
+        using type = std::tr2::dynamic_bitset<block_t>;
+    };
+#endif
+
+    struct fix_aligned_bitset
+    {
+        static constexpr std::string_view name = "fix::aligned_bitset";
+        static constexpr size_t max_block_bits = 64;
+        template<typename block_t>
+        using type = fix::aligned_bitset<block_t>;
+    };
+
+    struct fix_small_bitset
+    {
+        static constexpr std::string_view name = "fix::small_bitset";
+        static constexpr size_t max_block_bits = 64;
+        template<typename block_t>
+        using type = fix::small_bitset<block_t>;
+    };
+
+    struct fix_atomic_bitset
+    {
+        static constexpr std::string_view name = "fix::atomic_bitset";
+        static constexpr size_t max_block_bits = 64;
+        template<typename block_t>
+        using type = fix::atomic_bitset<block_t>;
+    };
+
+    struct fix_roaring_bitset
+    {
+        static constexpr std::string_view name = "fix::roaring_bitset";
+        using type = fix::roaring_bitset;
+    };
+
+    struct fix_auto_bitset
+    {
+        static constexpr std::string_view name = "fix::auto_bitset";
+        using type = fix::auto_bitset;
+    };
+
+    struct std_vector_bool
+    {
+        static constexpr std::string_view name = "std::vector<bool>";
+        using type = std::vector<bool>;
+    };
+
+    struct std_bitset
+    {
+        static constexpr std::string_view name = "std::bitset";
+        template<size_t bits>
+        using type = std::bitset<bits>;
+        using sizes = size_list<8, 16, 64, 256, 1024, 4096, 16384, 65536, 262144, 1048576>;
+    };
+
+    using backends = type_list<sul_dynamic_bitset,
+#ifdef HAS_BOOST
+                               boost_dynamic_bitset,
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+                               std_tr2_dynamic_bitset,
+#endif
+                               fix_aligned_bitset,
+                               fix_small_bitset,
+                               fix_atomic_bitset,
+                               fix_roaring_bitset,
+                               fix_auto_bitset,
+                               std_vector_bool,
+                               std_bitset>;
+
+    // block types of the block backends, the ones that are not an unsigned integral type for the standard library (as
+    // unsigned __int128 without the GNU extensions) or an alias of a previous one (as size_t) are removed, the blocks
+    // wider than the 64 bits words of the fix kernels go through the backend own operations
+    template<typename list_t, typename... types_t>
+    struct block_types_of
+    {
+        using type = list_t;
+    };
+
+    template<typename... kept_t, typename type_t, typename... types_t>
+    struct block_types_of<type_list<kept_t...>, type_t, types_t...>
+      : std::conditional_t<!std::unsigned_integral<type_t> || (std::same_as<type_t, kept_t> || ...),
+                           block_types_of<type_list<kept_t...>, types_t...>,
+                           block_types_of<type_list<kept_t..., type_t>, types_t...>>
+    {
+    };
+
+    using block_types = block_types_of<type_list<>,
+                                       uint8_t,
+                                       uint16_t,
+                                       uint32_t,
+                                       uint64_t,
+#ifdef __SIZEOF_INT128__
+                                       unsigned __int128,
+#endif
+                                       size_t>::type;
+
+    template<typename block_t>
+    [[nodiscard]] constexpr std::string_view block_type_name() noexcept
+    {
+        if constexpr(std::same_as<block_t, uint8_t>)
+        {
+            return "uint8_t";
+        }
+        else if constexpr(std::same_as<block_t, uint16_t>)
+        {
+            return "uint16_t";
+        }
+        else if constexpr(std::same_as<block_t, uint32_t>)
+        {
+            return "uint32_t";
+        }
+        else if constexpr(std::same_as<block_t, uint64_t>)
+        {
+            return "uint64_t";
+        }
+        else if constexpr(std::same_as<block_t, size_t>)
+        {
+            return "size_t";
+        }
+        else
+        {
+            return "unsigned __int128";
+        }
+    }
+
+    // "<backend><<parameter>> matrix_<operation>", parameter: block type or number of bits of the backend, if any
+    template<typename backend_t>
+    [[nodiscard]] std::string benchmark_name(std::string_view parameter, std::string_view operation)
+    {
+        std::string name(backend_t::name);
+        if(!parameter.empty())
+        {
+            name += '<';
+            name += parameter;
+            name += '>';
+        }
+        name += " matrix_";
+        name += operation;
+        return name;
+    }
+} // namespace matrix
@@ -7,8 +7,17 @@
 //
 #pragma once
 
+#include <fix/dynamic_bitset.hpp>
+#include <uscp/bitset.hpp>
+
+#include <array>
+#include <bitset>
+#include <cassert>
 #include <climits>
 #include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string_view>
 #include <type_traits>
 
 template<typename T>
@@ -22,30 +31,172 @@ constexpr bool bit_value(T value, size_t bit_pos)
     return (value & (T(1) << bit_pos)) != T(0);
 }
 
+// bitset of bits bits, the bit pos is on if bit_value(pos), called in increasing positions
+template<typename dynamic_bitset_t, typename Function>
+dynamic_bitset_t generate_bitset(size_t bits, Function&& bit_value)
+{
+    if constexpr(requires(dynamic_bitset_t& bitset) { bitset.push_back(true); })
+    {
+        dynamic_bitset_t bitset;
+        if constexpr(requires { dynamic_bitset_t::reserve(bits); })
+        {
+            bitset.reserve(bits);
+        }
+        for(size_t i = 0; i < bits; ++i)
+        {
+            bitset.push_back(bit_value(i));
+        }
+        return bitset;
+    }
+    else
+    {
+        // fixed-size bitsets and bitsets without push_back, as fix::atomic_bitset
+        dynamic_bitset_t bitset = uscp::make_bitset<dynamic_bitset_t>(bits);
+        for(size_t i = 0; i < bits; ++i)
+        {
+            if(bit_value(i))
+            {
+                fix::dynamic_bitset::do_set(bitset, i);
+            }
+        }
+        return bitset;
+    }
+}
+
+// density: probability of each bit to be on
+template<typename dynamic_bitset_t>
+dynamic_bitset_t random_bitset(std::minstd_rand& gen, size_t bits, double density)
+{
+    std::bernoulli_distribution d(density);
+    return generate_bitset<dynamic_bitset_t>(bits, [&](size_t) { return d(gen); });
+}
+
+// each bit on with a probability of 0.5
 template<typename dynamic_bitset_t>
 dynamic_bitset_t random_bitset(std::minstd_rand& gen, size_t bits)
 {
-    std::bernoulli_distribution d;
-    dynamic_bitset_t bitset;
-    if constexpr(requires { dynamic_bitset_t::reserve(bits); })
+    // fill the blocks directly, bit by bit generation is too slow for the largest bitsets
+    if constexpr(fix::dynamic_bitset::has_blocks<dynamic_bitset_t>
+                 && !fix::dynamic_bitset::fixed_size<dynamic_bitset_t>)
     {
-        bitset.reserve(bits);
+        dynamic_bitset_t bitset;
+        bitset.resize(bits);
+        const auto bitset_blocks = fix::dynamic_bitset::blocks(bitset);
+        using block_t = typename decltype(bitset_blocks)::element_type;
+        // uniform_int_distribution is not defined for the 8 bits types, blocks are truncated 64 bits values
+        std::uniform_int_distribution<uint64_t> d;
+        for(block_t& block: bitset_blocks)
+        {
+            block = static_cast<block_t>(d(gen));
+        }
+        if(!bitset_blocks.empty())
+        {
+            bitset_blocks.back() =
+              static_cast<block_t>(bitset_blocks.back() & fix::dynamic_bitset::kernels::last_block_mask<block_t>(bits));
+        }
+        return bitset;
     }
-    for(size_t i = 0; i < bits; ++i)
+    else
     {
-        bitset.push_back(d(gen));
+        return random_bitset<dynamic_bitset_t>(gen, bits, 0.5);
     }
-    return bitset;
 }
 
-template<size_t bits>
-std::bitset<bits> random_std_bitset(std::minstd_rand& gen) noexcept
+// bits of the operands of the benchmarks: densities, as the fair one of random_bitset(), and structured patterns, the
+// sparse, nearly full and structured ones expose the early exits and the branch mispredictions of the operations
+enum class bit_pattern : uint8_t
+{
+    density_0,
+    density_0_001,
+    density_0_01,
+    density_0_1,
+    density_0_5,
+    density_0_9,
+    density_0_999,
+    density_1,
+    clustered,   // runs of bits on and of bits off, of 1 to 256 bits
+    zero_prefix, // bits off but in the last eighth, at density 0.5
+    last_bit,    // only the last bit on
+};
+
+inline constexpr size_t bit_patterns_number = 11;
+
+[[nodiscard]] constexpr std::string_view bit_pattern_name(bit_pattern pattern) noexcept
+{
+    constexpr std::array<std::string_view, bit_patterns_number> names = {"density_0",
+                                                                         "density_0.001",
+                                                                         "density_0.01",
+                                                                         "density_0.1",
+                                                                         "density_0.5",
+                                                                         "density_0.9",
+                                                                         "density_0.999",
+                                                                         "density_1",
+                                                                         "clustered",
+                                                                         "zero_prefix",
+                                                                         "last_bit"};
+    assert(static_cast<size_t>(pattern) < bit_patterns_number);
+    return names[static_cast<size_t>(pattern)];
+}
+
+template<typename dynamic_bitset_t>
+dynamic_bitset_t random_bitset(std::minstd_rand& gen, size_t bits, bit_pattern pattern)
+{
+    constexpr std::array<double, 8> densities = {0, 0.001, 0.01, 0.1, 0.5, 0.9, 0.999, 1};
+    switch(pattern)
+    {
+        case bit_pattern::clustered:
+        {
+            std::uniform_int_distribution<size_t> run_length(1, 256);
+            size_t run = 0;
+            bool value = true;
+            return generate_bitset<dynamic_bitset_t>(bits,
+                                                     [&](size_t)
+                                                     {
+                                                         if(run == 0)
+                                                         {
+                                                             value = !value;
+                                                             run = run_length(gen);
+                                                         }
+                                                         --run;
+                                                         return value;
+                                                     });
+        }
+        case bit_pattern::zero_prefix:
+        {
+            std::bernoulli_distribution d;
+            const size_t prefix = bits - bits / 8;
+            return generate_bitset<dynamic_bitset_t>(bits, [&](size_t pos) { return pos >= prefix && d(gen); });
+        }
+        case bit_pattern::last_bit:
+            return generate_bitset<dynamic_bitset_t>(bits, [&](size_t pos) { return pos + 1 == bits; });
+        case bit_pattern::density_0_5:
+            return random_bitset<dynamic_bitset_t>(gen, bits);
+        default:
+            assert(static_cast<size_t>(pattern) < densities.size());
+            return random_bitset<dynamic_bitset_t>(gen, bits, densities[static_cast<size_t>(pattern)]);
+    }
+}
+
+// bytes used by the bitset, its own memory_footprint() if any, its object and its blocks otherwise
+template<typename dynamic_bitset_t>
+size_t memory_footprint(const dynamic_bitset_t& bitset) noexcept
 {
-    std::bernoulli_distribution d;
-    std::bitset<bits> bitset;
-    for(size_t i = 0; i < bits; ++i)
+    if constexpr(requires { bitset.memory_footprint(); })
     {
-        bitset[i] = d(gen);
+        return bitset.memory_footprint();
     }
-    return bitset;
+    else if constexpr(fix::dynamic_bitset::has_blocks<const dynamic_bitset_t>)
+    {
+        return sizeof(bitset) + fix::dynamic_bitset::blocks(bitset).size_bytes();
+    }
+    else
+    {
+        return sizeof(bitset) + (bitset.size() + CHAR_BIT - 1) / CHAR_BIT;
+    }
+}
+
+template<size_t bits>
+std::bitset<bits> random_std_bitset(std::minstd_rand& gen, bit_pattern pattern = bit_pattern::density_0_5)
+{
+    return random_bitset<std::bitset<bits>>(gen, bits, pattern);
 }
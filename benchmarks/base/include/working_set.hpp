@@ -0,0 +1,192 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <utils.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string_view>
+#include <vector>
+
+// Working set of the operands of the matrix benchmarks (see matrix.cpp). With the hot working set, the benchmarks use
+// the same operands on each iteration, that stay in the first level cache once read. The other ones rotate through a
+// pool of operands filling the cache level, and a multiple of the last level cache for the memory.
+enum class working_set : uint8_t
+{
+    hot,
+    l1,
+    l2,
+    llc,
+    llc_x4,
+};
+
+inline constexpr size_t working_sets_number = 5;
+
+[[nodiscard]] constexpr std::string_view working_set_name(working_set set) noexcept
+{
+    constexpr std::array<std::string_view, working_sets_number> names = {"hot", "L1", "L2", "LLC", "4xLLC"};
+    return names[static_cast<size_t>(set)];
+}
+
+[[nodiscard]] constexpr std::optional<working_set> working_set_from_name(std::string_view name) noexcept
+{
+    for(size_t i = 0; i < working_sets_number; ++i)
+    {
+        if(working_set_name(static_cast<working_set>(i)) == name)
+        {
+            return static_cast<working_set>(i);
+        }
+    }
+    return std::nullopt;
+}
+
+// bytes of the working set, from the caches of the CPU information of google benchmark (sysfs on Linux), 0 for the
+// hot working set and for cache levels it does not know
+[[nodiscard]] inline size_t working_set_bytes(working_set set) noexcept
+{
+    size_t l1 = 0;
+    size_t l2 = 0;
+    size_t llc = 0;
+    int llc_level = 0;
+    for(const benchmark::CPUInfo::CacheInfo& cache: benchmark::CPUInfo::Get().caches)
+    {
+        if(cache.type == "Instruction" || cache.size <= 0)
+        {
+            continue;
+        }
+        const size_t size = static_cast<size_t>(cache.size);
+        if(cache.level == 1)
+        {
+            l1 = size;
+        }
+        else if(cache.level == 2)
+        {
+            l2 = size;
+        }
+        if(cache.level >= llc_level)
+        {
+            llc = size;
+            llc_level = cache.level;
+        }
+    }
+
+    switch(set)
+    {
+        case working_set::hot:
+            return 0;
+        case working_set::l1:
+            return l1;
+        case working_set::l2:
+            return l2;
+        case working_set::llc:
+            return llc;
+        case working_set::llc_x4:
+            return 4 * llc;
+    }
+    return 0;
+}
+
+// working set of the matrix benchmarks, selected by the --working_set argument
+inline working_set& selected_working_set() noexcept
+{
+    static working_set set = working_set::hot;
+    return set;
+}
+
+// Sets of operands of a benchmark, as many as fit in the working set, at least one. next() moves to the next set in a
+// random order, so that the hardware prefetchers do not hide the latency of the cache level. A few sets are random, the
+// others are copies of them: only their addresses matter for the caches. The bytes of the sets are their
+// memory_footprint(), without the overhead of the allocator for the blocks on the heap of small bitsets.
+template<typename dynamic_bitset_t>
+class operands_pool final
+{
+public:
+    operands_pool(std::minstd_rand& gen, size_t bits, bit_pattern pattern, size_t operands, working_set set)
+      : m_operands(operands)
+    {
+        std::vector<dynamic_bitset_t> random_set;
+        random_set.reserve(m_operands);
+        size_t set_bytes = 0;
+        for(size_t i = 0; i < m_operands; ++i)
+        {
+            random_set.push_back(random_bitset<dynamic_bitset_t>(gen, bits, pattern));
+            set_bytes += memory_footprint(random_set.back());
+        }
+        const size_t sets = std::clamp<size_t>(
+          working_set_bytes(set) / std::max<size_t>(1, set_bytes), 1, std::numeric_limits<uint32_t>::max());
+        m_bytes = sets * set_bytes;
+
+        m_bitsets.reserve(sets * m_operands);
+        for(size_t i = 0; i < sets; ++i)
+        {
+            if(i != 0 && i < random_sets)
+            {
+                for(dynamic_bitset_t& bitset: random_set)
+                {
+                    bitset = random_bitset<dynamic_bitset_t>(gen, bits, pattern);
+                }
+            }
+            const size_t source = i < random_sets ? 0 : (i % random_sets) * m_operands;
+            for(size_t j = 0; j < m_operands; ++j)
+            {
+                m_bitsets.push_back(i < random_sets ? random_set[j] : m_bitsets[source + j]);
+            }
+        }
+
+        m_order.resize(sets);
+        std::iota(m_order.begin(), m_order.end(), static_cast<uint32_t>(0));
+        std::shuffle(m_order.begin(), m_order.end(), gen);
+        m_current = static_cast<size_t>(m_order.front()) * m_operands;
+        benchmark::DoNotOptimize(m_bitsets.data());
+    }
+
+    // operand of the current set
+    [[nodiscard]] dynamic_bitset_t& operator[](size_t operand) noexcept
+    {
+        return m_bitsets[m_current + operand];
+    }
+
+    void next() noexcept
+    {
+        if(++m_position == m_order.size())
+        {
+            m_position = 0;
+        }
+        m_current = static_cast<size_t>(m_order[m_position]) * m_operands;
+    }
+
+    [[nodiscard]] size_t sets() const noexcept
+    {
+        return m_order.size();
+    }
+
+    // bytes of the operands of the sets
+    [[nodiscard]] size_t bytes() const noexcept
+    {
+        return m_bytes;
+    }
+
+private:
+    static constexpr size_t random_sets = 16;
+
+    size_t m_operands;
+    size_t m_bytes = 0;
+    std::vector<dynamic_bitset_t> m_bitsets;
+    std::vector<uint32_t> m_order;
+    size_t m_position = 0;
+    size_t m_current = 0;
+};
@@ -8,6 +8,9 @@
 #include <config.hpp>
 #include <utils.hpp>
 
+#include <fix/aligned_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
 #include <benchmark/benchmark.h>
 #include <sul/dynamic_bitset.hpp>
 #ifdef HAS_BOOST
@@ -20,15 +23,71 @@
 #include <bitset>
 #include <chrono>
 #include <random>
+#include <string>
 #include <vector>
 
 template<typename block_type_t>
 void sul_dynamic_bitset_and_equal(benchmark::State& state)
 {
     const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    sul::dynamic_bitset<block_type_t> bitset1 = random_bitset<sul::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    sul::dynamic_bitset<block_type_t> bitset2 = random_bitset<sul::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(bitset1 &= bitset2);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+SUL_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(sul_dynamic_bitset_and_equal, "and_equal");
+
+template<typename block_type_t>
+void fix_aligned_bitset_and_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    fix::aligned_bitset<block_type_t> bitset1 = random_bitset<fix::aligned_bitset<block_type_t>>(gen, bits, pattern);
+    fix::aligned_bitset<block_type_t> bitset2 = random_bitset<fix::aligned_bitset<block_type_t>>(gen, bits, pattern);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(bitset1 &= bitset2);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+FIX_ALIGNED_BITSET_BENCHMARK_PATTERN_RANGE(fix_aligned_bitset_and_equal, "and_equal");
+
+template<typename block_type_t>
+void fix_small_bitset_and_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
     std::minstd_rand gen(SEED);
-    sul::dynamic_bitset<block_type_t> bitset1 = random_bitset<sul::dynamic_bitset<block_type_t>>(gen, bits);
-    sul::dynamic_bitset<block_type_t> bitset2 = random_bitset<sul::dynamic_bitset<block_type_t>>(gen, bits);
+    fix::small_bitset<block_type_t> bitset1 = random_bitset<fix::small_bitset<block_type_t>>(gen, bits, pattern);
+    fix::small_bitset<block_type_t> bitset2 = random_bitset<fix::small_bitset<block_type_t>>(gen, bits, pattern);
     benchmark::ClobberMemory();
 
     for(auto _: state)
@@ -43,18 +102,22 @@ void sul_dynamic_bitset_and_equal(benchmark::State& state)
                          benchmark::Counter::OneK::kIs1000);
     state.counters["bits_per_second"] =
       benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
 }
 
-SUL_DYNAMIC_BITSET_BENCHMARK_RANGE(sul_dynamic_bitset_and_equal, "and_equal");
+FIX_SMALL_BITSET_BENCHMARK_PATTERN_RANGE(fix_small_bitset_and_equal, "and_equal");
 
 #ifdef HAS_BOOST
 template<typename block_type_t>
 void boost_dynamic_bitset_and_equal(benchmark::State& state)
 {
     const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
     std::minstd_rand gen(SEED);
-    boost::dynamic_bitset<block_type_t> bitset1 = random_bitset<boost::dynamic_bitset<block_type_t>>(gen, bits);
-    boost::dynamic_bitset<block_type_t> bitset2 = random_bitset<boost::dynamic_bitset<block_type_t>>(gen, bits);
+    boost::dynamic_bitset<block_type_t> bitset1 =
+      random_bitset<boost::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    boost::dynamic_bitset<block_type_t> bitset2 =
+      random_bitset<boost::dynamic_bitset<block_type_t>>(gen, bits, pattern);
     benchmark::ClobberMemory();
 
     for(auto _: state)
@@ -69,9 +132,10 @@ void boost_dynamic_bitset_and_equal(benchmark::State& state)
                          benchmark::Counter::OneK::kIs1000);
     state.counters["bits_per_second"] =
       benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
 }
 
-BOOST_DYNAMIC_BITSET_BENCHMARK_RANGE(boost_dynamic_bitset_and_equal, "and_equal");
+BOOST_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(boost_dynamic_bitset_and_equal, "and_equal");
 #endif
 
 #ifdef HAS_STD_TR2_DYNAMIC_BITSET
@@ -79,9 +143,12 @@ template<typename block_type_t>
 void std_tr2_dynamic_bitset_and_equal(benchmark::State& state)
 {
     const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
     std::minstd_rand gen(SEED);
-    std::tr2::dynamic_bitset<block_type_t> bitset1 = random_bitset<std::tr2::dynamic_bitset<block_type_t>>(gen, bits);
-    std::tr2::dynamic_bitset<block_type_t> bitset2 = random_bitset<std::tr2::dynamic_bitset<block_type_t>>(gen, bits);
+    std::tr2::dynamic_bitset<block_type_t> bitset1 =
+      random_bitset<std::tr2::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    std::tr2::dynamic_bitset<block_type_t> bitset2 =
+      random_bitset<std::tr2::dynamic_bitset<block_type_t>>(gen, bits, pattern);
     benchmark::ClobberMemory();
 
     for(auto _: state)
@@ -96,17 +163,19 @@ void std_tr2_dynamic_bitset_and_equal(benchmark::State& state)
                          benchmark::Counter::OneK::kIs1000);
     state.counters["bits_per_second"] =
       benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
 }
 
-STD_TR2_DYNAMIC_BITSET_BENCHMARK_RANGE(std_tr2_dynamic_bitset_and_equal, "and_equal");
+STD_TR2_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(std_tr2_dynamic_bitset_and_equal, "and_equal");
 #endif
 
 void std_vector_bool_and_equal(benchmark::State& state)
 {
     const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
     std::minstd_rand gen(SEED);
-    std::vector<bool> bitset1 = random_bitset<std::vector<bool>>(gen, bits);
-    std::vector<bool> bitset2 = random_bitset<std::vector<bool>>(gen, bits);
+    std::vector<bool> bitset1 = random_bitset<std::vector<bool>>(gen, bits, pattern);
+    std::vector<bool> bitset2 = random_bitset<std::vector<bool>>(gen, bits, pattern);
     benchmark::ClobberMemory();
 
     for(auto _: state)
@@ -124,16 +193,20 @@ void std_vector_bool_and_equal(benchmark::State& state)
                          benchmark::Counter::OneK::kIs1000);
     state.counters["bits_per_second"] =
       benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
 }
 
-STD_VECTOR_BOOL_BENCHMARK_RANGE(std_vector_bool_and_equal, "and_equal");
+STD_VECTOR_BOOL_BENCHMARK_PATTERN_RANGE(std_vector_bool_and_equal, "and_equal");
 
 template<size_t bits>
 void std_bitset_and_equal(benchmark::State& state)
 {
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
     std::minstd_rand gen(SEED);
-    std::bitset<bits> bitset1 = random_std_bitset<bits>(gen);
-    std::bitset<bits> bitset2 = random_std_bitset<bits>(gen);
+    std::bitset<bits> bitset1 = random_std_bitset<bits>(gen, pattern);
+    std::bitset<bits> bitset2 = random_std_bitset<bits>(gen, pattern);
+    benchmark::DoNotOptimize(&bitset1);
+    benchmark::DoNotOptimize(&bitset2);
     benchmark::ClobberMemory();
 
     for(auto _: state)
@@ -148,6 +221,7 @@ void std_bitset_and_equal(benchmark::State& state)
                          benchmark::Counter::OneK::kIs1000);
     state.counters["bits_per_second"] =
       benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
 }
 
-STD_BITSET_BENCHMARK_RANGE(std_bitset_and_equal, "and_equal");
+STD_BITSET_BENCHMARK_PATTERN_RANGE(std_bitset_and_equal, "and_equal");
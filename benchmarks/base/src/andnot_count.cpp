@@ -0,0 +1,421 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+#include <utils.hpp>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
+#include <benchmark/benchmark.h>
+#include <sul/dynamic_bitset.hpp>
+#ifdef HAS_BOOST
+#    include <boost/dynamic_bitset.hpp>
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+#    include <tr2/dynamic_bitset>
+#endif
+
+#include <algorithm>
+#include <bitset>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+// count of lhs & ~rhs: fused fix adapter against the andnot then count sequence on a temporary bitset
+
+template<typename block_type_t>
+void sul_dynamic_bitset_andnot_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const sul::dynamic_bitset<block_type_t> bitset1 =
+      random_bitset<sul::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    const sul::dynamic_bitset<block_type_t> bitset2 =
+      random_bitset<sul::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_andnot_count(bitset1, bitset2));
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+SUL_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(sul_dynamic_bitset_andnot_count, "andnot_count");
+
+template<typename block_type_t>
+void sul_dynamic_bitset_andnot_then_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const sul::dynamic_bitset<block_type_t> bitset1 =
+      random_bitset<sul::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    const sul::dynamic_bitset<block_type_t> bitset2 =
+      random_bitset<sul::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    sul::dynamic_bitset<block_type_t> result = bitset1;
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        result = bitset1;
+        result -= bitset2;
+        benchmark::DoNotOptimize(result.count());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+SUL_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(sul_dynamic_bitset_andnot_then_count, "andnot_then_count");
+
+template<typename block_type_t>
+void fix_aligned_bitset_andnot_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const fix::aligned_bitset<block_type_t> bitset1 =
+      random_bitset<fix::aligned_bitset<block_type_t>>(gen, bits, pattern);
+    const fix::aligned_bitset<block_type_t> bitset2 =
+      random_bitset<fix::aligned_bitset<block_type_t>>(gen, bits, pattern);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_andnot_count(bitset1, bitset2));
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+FIX_ALIGNED_BITSET_BENCHMARK_PATTERN_RANGE(fix_aligned_bitset_andnot_count, "andnot_count");
+
+template<typename block_type_t>
+void fix_aligned_bitset_andnot_then_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const fix::aligned_bitset<block_type_t> bitset1 =
+      random_bitset<fix::aligned_bitset<block_type_t>>(gen, bits, pattern);
+    const fix::aligned_bitset<block_type_t> bitset2 =
+      random_bitset<fix::aligned_bitset<block_type_t>>(gen, bits, pattern);
+    fix::aligned_bitset<block_type_t> result = bitset1;
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        result = bitset1;
+        result -= bitset2;
+        benchmark::DoNotOptimize(result.count());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+FIX_ALIGNED_BITSET_BENCHMARK_PATTERN_RANGE(fix_aligned_bitset_andnot_then_count, "andnot_then_count");
+
+template<typename block_type_t>
+void fix_small_bitset_andnot_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const fix::small_bitset<block_type_t> bitset1 = random_bitset<fix::small_bitset<block_type_t>>(gen, bits, pattern);
+    const fix::small_bitset<block_type_t> bitset2 = random_bitset<fix::small_bitset<block_type_t>>(gen, bits, pattern);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_andnot_count(bitset1, bitset2));
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+FIX_SMALL_BITSET_BENCHMARK_PATTERN_RANGE(fix_small_bitset_andnot_count, "andnot_count");
+
+template<typename block_type_t>
+void fix_small_bitset_andnot_then_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const fix::small_bitset<block_type_t> bitset1 = random_bitset<fix::small_bitset<block_type_t>>(gen, bits, pattern);
+    const fix::small_bitset<block_type_t> bitset2 = random_bitset<fix::small_bitset<block_type_t>>(gen, bits, pattern);
+    fix::small_bitset<block_type_t> result = bitset1;
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        result = bitset1;
+        result -= bitset2;
+        benchmark::DoNotOptimize(result.count());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+FIX_SMALL_BITSET_BENCHMARK_PATTERN_RANGE(fix_small_bitset_andnot_then_count, "andnot_then_count");
+
+#ifdef HAS_BOOST
+template<typename block_type_t>
+void boost_dynamic_bitset_andnot_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const boost::dynamic_bitset<block_type_t> bitset1 =
+      random_bitset<boost::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    const boost::dynamic_bitset<block_type_t> bitset2 =
+      random_bitset<boost::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_andnot_count(bitset1, bitset2));
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+BOOST_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(boost_dynamic_bitset_andnot_count, "andnot_count");
+
+template<typename block_type_t>
+void boost_dynamic_bitset_andnot_then_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const boost::dynamic_bitset<block_type_t> bitset1 =
+      random_bitset<boost::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    const boost::dynamic_bitset<block_type_t> bitset2 =
+      random_bitset<boost::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    boost::dynamic_bitset<block_type_t> result = bitset1;
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        result = bitset1;
+        result -= bitset2;
+        benchmark::DoNotOptimize(result.count());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+BOOST_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(boost_dynamic_bitset_andnot_then_count, "andnot_then_count");
+#endif
+
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+template<typename block_type_t>
+void std_tr2_dynamic_bitset_andnot_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const std::tr2::dynamic_bitset<block_type_t> bitset1 =
+      random_bitset<std::tr2::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    const std::tr2::dynamic_bitset<block_type_t> bitset2 =
+      random_bitset<std::tr2::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_andnot_count(bitset1, bitset2));
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+STD_TR2_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(std_tr2_dynamic_bitset_andnot_count, "andnot_count");
+
+template<typename block_type_t>
+void std_tr2_dynamic_bitset_andnot_then_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const std::tr2::dynamic_bitset<block_type_t> bitset1 =
+      random_bitset<std::tr2::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    const std::tr2::dynamic_bitset<block_type_t> bitset2 =
+      random_bitset<std::tr2::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    std::tr2::dynamic_bitset<block_type_t> result = bitset1;
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        result = bitset1;
+        result -= bitset2;
+        benchmark::DoNotOptimize(result.count());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+STD_TR2_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(std_tr2_dynamic_bitset_andnot_then_count, "andnot_then_count");
+#endif
+
+void std_vector_bool_andnot_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const std::vector<bool> bitset1 = random_bitset<std::vector<bool>>(gen, bits, pattern);
+    const std::vector<bool> bitset2 = random_bitset<std::vector<bool>>(gen, bits, pattern);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_andnot_count(bitset1, bitset2));
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+STD_VECTOR_BOOL_BENCHMARK_PATTERN_RANGE(std_vector_bool_andnot_count, "andnot_count");
+
+void std_vector_bool_andnot_then_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const std::vector<bool> bitset1 = random_bitset<std::vector<bool>>(gen, bits, pattern);
+    const std::vector<bool> bitset2 = random_bitset<std::vector<bool>>(gen, bits, pattern);
+    std::vector<bool> result = bitset1;
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        for(size_t i = 0; i < bits; ++i)
+        {
+            result[i] = bitset1[i] && !bitset2[i];
+        }
+        benchmark::DoNotOptimize(std::ranges::count(result, true));
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+STD_VECTOR_BOOL_BENCHMARK_PATTERN_RANGE(std_vector_bool_andnot_then_count, "andnot_then_count");
+
+template<size_t bits>
+void std_bitset_andnot_count(benchmark::State& state)
+{
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const std::bitset<bits> bitset1 = random_std_bitset<bits>(gen, pattern);
+    const std::bitset<bits> bitset2 = random_std_bitset<bits>(gen, pattern);
+    benchmark::DoNotOptimize(&bitset1);
+    benchmark::DoNotOptimize(&bitset2);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize((bitset1 & ~ bitset2).count());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+STD_BITSET_BENCHMARK_PATTERN_RANGE(std_bitset_andnot_count, "andnot_count");
@@ -8,6 +8,9 @@
 #include <config.hpp>
 #include <utils.hpp>
 
+#include <fix/aligned_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
 #include <benchmark/benchmark.h>
 #include <sul/dynamic_bitset.hpp>
 #ifdef HAS_BOOST
@@ -21,14 +24,68 @@
 #include <chrono>
 #include <random>
 #include <ranges>
+#include <string>
 #include <vector>
 
 template<typename block_type_t>
 void sul_dynamic_bitset_any(benchmark::State& state)
 {
     const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    sul::dynamic_bitset<block_type_t> bitset = random_bitset<sul::dynamic_bitset<block_type_t>>(gen, bits, pattern);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(bitset.any());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+SUL_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(sul_dynamic_bitset_any, "any");
+
+template<typename block_type_t>
+void fix_aligned_bitset_any(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    fix::aligned_bitset<block_type_t> bitset = random_bitset<fix::aligned_bitset<block_type_t>>(gen, bits, pattern);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(bitset.any());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+FIX_ALIGNED_BITSET_BENCHMARK_PATTERN_RANGE(fix_aligned_bitset_any, "any");
+
+template<typename block_type_t>
+void fix_small_bitset_any(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
     std::minstd_rand gen(SEED);
-    sul::dynamic_bitset<block_type_t> bitset = random_bitset<sul::dynamic_bitset<block_type_t>>(gen, bits);
+    fix::small_bitset<block_type_t> bitset = random_bitset<fix::small_bitset<block_type_t>>(gen, bits, pattern);
     benchmark::ClobberMemory();
 
     for(auto _: state)
@@ -43,17 +100,19 @@ void sul_dynamic_bitset_any(benchmark::State& state)
                          benchmark::Counter::OneK::kIs1000);
     state.counters["bits_per_second"] =
       benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
 }
 
-SUL_DYNAMIC_BITSET_BENCHMARK_RANGE(sul_dynamic_bitset_any, "any");
+FIX_SMALL_BITSET_BENCHMARK_PATTERN_RANGE(fix_small_bitset_any, "any");
 
 #ifdef HAS_BOOST
 template<typename block_type_t>
 void boost_dynamic_bitset_any(benchmark::State& state)
 {
     const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
     std::minstd_rand gen(SEED);
-    boost::dynamic_bitset<block_type_t> bitset = random_bitset<boost::dynamic_bitset<block_type_t>>(gen, bits);
+    boost::dynamic_bitset<block_type_t> bitset = random_bitset<boost::dynamic_bitset<block_type_t>>(gen, bits, pattern);
     benchmark::ClobberMemory();
 
     for(auto _: state)
@@ -68,9 +127,10 @@ void boost_dynamic_bitset_any(benchmark::State& state)
                          benchmark::Counter::OneK::kIs1000);
     state.counters["bits_per_second"] =
       benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
 }
 
-BOOST_DYNAMIC_BITSET_BENCHMARK_RANGE(boost_dynamic_bitset_any, "any");
+BOOST_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(boost_dynamic_bitset_any, "any");
 #endif
 
 #ifdef HAS_STD_TR2_DYNAMIC_BITSET
@@ -78,8 +138,10 @@ template<typename block_type_t>
 void std_tr2_dynamic_bitset_any(benchmark::State& state)
 {
     const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
     std::minstd_rand gen(SEED);
-    std::tr2::dynamic_bitset<block_type_t> bitset = random_bitset<std::tr2::dynamic_bitset<block_type_t>>(gen, bits);
+    std::tr2::dynamic_bitset<block_type_t> bitset =
+      random_bitset<std::tr2::dynamic_bitset<block_type_t>>(gen, bits, pattern);
     benchmark::ClobberMemory();
 
     for(auto _: state)
@@ -94,24 +156,23 @@ void std_tr2_dynamic_bitset_any(benchmark::State& state)
                          benchmark::Counter::OneK::kIs1000);
     state.counters["bits_per_second"] =
       benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
 }
 
-STD_TR2_DYNAMIC_BITSET_BENCHMARK_RANGE(std_tr2_dynamic_bitset_any, "any");
+STD_TR2_DYNAMIC_BITSET_BENCHMARK_PATTERN_RANGE(std_tr2_dynamic_bitset_any, "any");
 #endif
 
 void std_vector_bool_any(benchmark::State& state)
 {
     const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
     std::minstd_rand gen(SEED);
-    std::vector<bool> bitset = random_bitset<std::vector<bool>>(gen, bits);
+    std::vector<bool> bitset = random_bitset<std::vector<bool>>(gen, bits, pattern);
     benchmark::ClobberMemory();
 
     for(auto _: state)
     {
-        for(size_t i = 0; i < bits; ++i)
-        {
-            benchmark::DoNotOptimize(std::ranges::any_of(bitset, [](bool val) noexcept { return val; }));
-        }
+        benchmark::DoNotOptimize(std::ranges::any_of(bitset, [](bool val) noexcept { return val; }));
         benchmark::ClobberMemory();
     }
 
@@ -121,15 +182,18 @@ void std_vector_bool_any(benchmark::State& state)
                          benchmark::Counter::OneK::kIs1000);
     state.counters["bits_per_second"] =
       benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
 }
 
-STD_VECTOR_BOOL_BENCHMARK_RANGE(std_vector_bool_any, "any");
+STD_VECTOR_BOOL_BENCHMARK_PATTERN_RANGE(std_vector_bool_any, "any");
 
 template<size_t bits>
 void std_bitset_any(benchmark::State& state)
 {
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
     std::minstd_rand gen(SEED);
-    std::bitset<bits> bitset = random_std_bitset<bits>(gen);
+    std::bitset<bits> bitset = random_std_bitset<bits>(gen, pattern);
+    benchmark::DoNotOptimize(&bitset);
     benchmark::ClobberMemory();
 
     for(auto _: state)
@@ -144,6 +208,7 @@ void std_bitset_any(benchmark::State& state)
                          benchmark::Counter::OneK::kIs1000);
     state.counters["bits_per_second"] =
       benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
 }
 
-STD_BITSET_BENCHMARK_RANGE(std_bitset_any, "any");
+STD_BITSET_BENCHMARK_PATTERN_RANGE(std_bitset_any, "any");
@@ -0,0 +1,147 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/atomic_bitset.hpp>
+#include <fix/parallel.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <thread>
+
+// single bit operations from 1 to hardware_concurrency threads, each bit is used once per iteration
+// contended: the threads interleave their bits and write the same blocks, uncontended: each thread has a range of whole
+// cache lines; fix::aligned_bitset is race free in the uncontended case and gives the cost of the non-atomic operations
+#define ATOMIC_BENCHMARK_RANGE(func, dynamic_bitset_type, contended, name) \
+    BENCHMARK_TEMPLATE(func, dynamic_bitset_type, contended) \
+      ->Name(#dynamic_bitset_type " " name) \
+      ->ArgNames({"bits", "threads"}) \
+      ->ArgsProduct({benchmark::CreateRange(ATOMIC_RANGE_START, ATOMIC_RANGE_END, RANGE_MULTIPLIER), \
+                     benchmark::CreateRange(1, std::max(1u, std::thread::hardware_concurrency()), 2)}) \
+      ->Unit(benchmark::kMicrosecond) \
+      ->UseRealTime()
+
+#define FIX_ATOMIC_BITSET_ATOMIC_BENCHMARK_RANGE(func, name) \
+    ATOMIC_BENCHMARK_RANGE(func, fix::atomic_bitset<uint64_t>, false, name "_uncontended"); \
+    ATOMIC_BENCHMARK_RANGE(func, fix::atomic_bitset<uint64_t>, true, name "_contended")
+
+#define FIX_ALIGNED_BITSET_ATOMIC_BENCHMARK_RANGE(func, name) \
+    ATOMIC_BENCHMARK_RANGE(func, fix::aligned_bitset<uint64_t>, false, name "_uncontended")
+
+static void set_atomic_counters(benchmark::State& state, size_t bits)
+{
+    state.counters["1_bit_time"] =
+      benchmark::Counter(static_cast<double>(bits),
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] = benchmark::Counter(
+      static_cast<double>(bits), benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+// call function(pos) for each position lower than bits, split between the threads of the pool
+template<typename dynamic_bitset_t, bool contended, typename Function>
+static void for_each_position(fix::dynamic_bitset::parallel::thread_pool& pool, size_t bits, Function&& function)
+{
+    const size_t threads = pool.size();
+    pool.run(threads,
+             [&](size_t task) noexcept
+             {
+                 if constexpr(contended)
+                 {
+                     for(size_t pos = task; pos < bits; pos += threads)
+                     {
+                         function(pos);
+                     }
+                 }
+                 else
+                 {
+                     constexpr size_t line_bits = dynamic_bitset_t::bits_per_line;
+                     const size_t lines = (bits + line_bits - 1) / line_bits;
+                     const size_t begin = std::min(bits, lines * task / threads * line_bits);
+                     const size_t end = std::min(bits, lines * (task + 1) / threads * line_bits);
+                     for(size_t pos = begin; pos < end; ++pos)
+                     {
+                         function(pos);
+                     }
+                 }
+             });
+}
+
+template<typename dynamic_bitset_t, bool contended>
+void atomic_set(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    fix::dynamic_bitset::parallel::thread_pool pool(static_cast<size_t>(state.range(1)));
+    dynamic_bitset_t bitset(bits);
+    benchmark::ClobberMemory();
+
+    // the bits are set then reset so that each operation changes its block
+    bool value = true;
+    for(auto _: state)
+    {
+        for_each_position<dynamic_bitset_t, contended>(
+          pool, bits, [&](size_t pos) noexcept { bitset.set(pos, value); });
+        value = !value;
+        benchmark::ClobberMemory();
+    }
+
+    set_atomic_counters(state, bits);
+}
+
+template<typename dynamic_bitset_t, bool contended>
+void atomic_test(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    fix::dynamic_bitset::parallel::thread_pool pool(static_cast<size_t>(state.range(1)));
+    dynamic_bitset_t bitset(bits);
+    for(size_t pos = 0; pos < bits; pos += 2)
+    {
+        bitset.set(pos);
+    }
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        for_each_position<dynamic_bitset_t, contended>(
+          pool, bits, [&](size_t pos) noexcept { benchmark::DoNotOptimize(bitset.test(pos)); });
+    }
+
+    set_atomic_counters(state, bits);
+}
+
+// claims of the bits: test_and_set then test_and_reset, as a parallel algorithm marking the covered elements
+template<typename dynamic_bitset_t, bool contended>
+void atomic_test_and_set(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    fix::dynamic_bitset::parallel::thread_pool pool(static_cast<size_t>(state.range(1)));
+    dynamic_bitset_t bitset(bits);
+    benchmark::ClobberMemory();
+
+    bool claim = true;
+    for(auto _: state)
+    {
+        for_each_position<dynamic_bitset_t, contended>(
+          pool,
+          bits,
+          [&](size_t pos) noexcept
+          { benchmark::DoNotOptimize(claim ? bitset.test_and_set(pos) : bitset.test_and_reset(pos)); });
+        claim = !claim;
+        benchmark::ClobberMemory();
+    }
+
+    set_atomic_counters(state, bits);
+}
+
+FIX_ATOMIC_BITSET_ATOMIC_BENCHMARK_RANGE(atomic_set, "atomic_set");
+FIX_ATOMIC_BITSET_ATOMIC_BENCHMARK_RANGE(atomic_test, "atomic_test");
+FIX_ATOMIC_BITSET_ATOMIC_BENCHMARK_RANGE(atomic_test_and_set, "atomic_test_and_set");
+FIX_ALIGNED_BITSET_ATOMIC_BENCHMARK_RANGE(atomic_set, "atomic_set");
+FIX_ALIGNED_BITSET_ATOMIC_BENCHMARK_RANGE(atomic_test, "atomic_test");
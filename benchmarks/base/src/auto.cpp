@@ -0,0 +1,175 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+#include <utils.hpp>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/auto_bitset.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/roaring_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <concepts>
+#include <cstdint>
+#include <random>
+#include <string>
+
+// fix::auto_bitset in the representation of the calibration for the size and density of the operands, against each
+// of its representations; the calibration mode runs the benchmarks of the representations to build its table
+#define AUTO_BENCHMARK_RANGE(func, dynamic_bitset_type, name) \
+    BENCHMARK_TEMPLATE(func, dynamic_bitset_type) \
+      ->Name(#dynamic_bitset_type " " name) \
+      ->ArgNames({"bits", "density_inverse"}) \
+      ->ArgsProduct({benchmark::CreateRange(RANGE_START, RANGE_END, RANGE_MULTIPLIER), {2, 64, 4096}}) \
+      ->Unit(benchmark::kNanosecond)
+
+#define AUTO_BENCHMARKS(dynamic_bitset_type) \
+    AUTO_BENCHMARK_RANGE(auto_count, dynamic_bitset_type, "auto_count"); \
+    AUTO_BENCHMARK_RANGE(auto_or_equal, dynamic_bitset_type, "auto_or_equal"); \
+    AUTO_BENCHMARK_RANGE(auto_and_count, dynamic_bitset_type, "auto_and_count"); \
+    AUTO_BENCHMARK_RANGE(auto_andnot_count, dynamic_bitset_type, "auto_andnot_count"); \
+    AUTO_BENCHMARK_RANGE(auto_iterate_bits_on, dynamic_bitset_type, "auto_iterate_bits_on")
+
+// the label of fix::auto_bitset is the name of its representation
+template<typename dynamic_bitset_t>
+static void set_auto_counters(benchmark::State& state, size_t bits, const dynamic_bitset_t& bitset)
+{
+    state.counters["1_bit_time"] =
+      benchmark::Counter(static_cast<double>(bits),
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    if constexpr(std::same_as<dynamic_bitset_t, fix::auto_bitset>)
+    {
+        state.SetLabel(std::string(fix::auto_bitset_representation_name(bitset.representation())));
+    }
+}
+
+// compressed representations are given their smallest form, as after loading data
+template<typename dynamic_bitset_t>
+dynamic_bitset_t random_auto_bitset(std::minstd_rand& gen, size_t bits, double density)
+{
+    if constexpr(std::same_as<dynamic_bitset_t, fix::auto_bitset>)
+    {
+        const fix::aligned_bitset<uint64_t> bits_on = random_bitset<fix::aligned_bitset<uint64_t>>(gen, bits, density);
+        fix::auto_bitset bitset(bits, fix::auto_bitset::expected_density{density});
+        bits_on.iterate_bits_on([&](size_t bit_pos) { bitset.set(bit_pos); });
+        bitset.optimize();
+        return bitset;
+    }
+    else
+    {
+        dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits, density);
+        if constexpr(requires { bitset.optimize(); })
+        {
+            bitset.optimize();
+        }
+        return bitset;
+    }
+}
+
+template<typename dynamic_bitset_t>
+void auto_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const double density = 1.0 / static_cast<double>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset = random_auto_bitset<dynamic_bitset_t>(gen, bits, density);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_count(bitset));
+    }
+
+    set_auto_counters(state, bits, bitset);
+}
+
+template<typename dynamic_bitset_t>
+void auto_or_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const double density = 1.0 / static_cast<double>(state.range(1));
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset1 = random_auto_bitset<dynamic_bitset_t>(gen, bits, density);
+    const dynamic_bitset_t bitset2 = random_auto_bitset<dynamic_bitset_t>(gen, bits, density);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::do_or_equal(bitset1, bitset2);
+        benchmark::ClobberMemory();
+    }
+
+    set_auto_counters(state, bits, bitset1);
+}
+
+template<typename dynamic_bitset_t>
+void auto_and_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const double density = 1.0 / static_cast<double>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset1 = random_auto_bitset<dynamic_bitset_t>(gen, bits, density);
+    const dynamic_bitset_t bitset2 = random_auto_bitset<dynamic_bitset_t>(gen, bits, density);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_and_count(bitset1, bitset2));
+    }
+
+    set_auto_counters(state, bits, bitset1);
+}
+
+template<typename dynamic_bitset_t>
+void auto_andnot_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const double density = 1.0 / static_cast<double>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset1 = random_auto_bitset<dynamic_bitset_t>(gen, bits, density);
+    const dynamic_bitset_t bitset2 = random_auto_bitset<dynamic_bitset_t>(gen, bits, density);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_andnot_count(bitset1, bitset2));
+    }
+
+    set_auto_counters(state, bits, bitset1);
+}
+
+template<typename dynamic_bitset_t>
+void auto_iterate_bits_on(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const double density = 1.0 / static_cast<double>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset = random_auto_bitset<dynamic_bitset_t>(gen, bits, density);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        size_t sum = 0;
+        fix::dynamic_bitset::do_iterate_bits_on(bitset, [&](size_t bit_pos) noexcept { sum += bit_pos; });
+        benchmark::DoNotOptimize(sum);
+    }
+
+    set_auto_counters(state, bits, bitset);
+}
+
+AUTO_BENCHMARKS(fix::auto_bitset);
+
+// the representations of fix::auto_bitset, with the names of auto_bitset_representation_name()
+AUTO_BENCHMARKS(fix::aligned_bitset<uint16_t>);
+AUTO_BENCHMARKS(fix::aligned_bitset<uint32_t>);
+AUTO_BENCHMARKS(fix::aligned_bitset<uint64_t>);
+AUTO_BENCHMARKS(fix::small_bitset<uint64_t>);
+AUTO_BENCHMARKS(fix::roaring_bitset);
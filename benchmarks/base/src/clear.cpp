@@ -7,6 +7,9 @@
 //
 #include <config.hpp>
 
+#include <fix/aligned_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
 #include <benchmark/benchmark.h>
 #include <sul/dynamic_bitset.hpp>
 #ifdef HAS_BOOST
@@ -50,6 +53,64 @@ void sul_dynamic_bitset_clear(benchmark::State& state)
 
 SUL_DYNAMIC_BITSET_BENCHMARK_RANGE(sul_dynamic_bitset_clear, "clear");
 
+template<typename block_type_t>
+void fix_aligned_bitset_clear(benchmark::State& state)
+{
+    const size_t new_size = static_cast<size_t>(state.range(0));
+
+    for(auto _: state)
+    {
+        // setup
+        state.PauseTiming();
+        fix::aligned_bitset<block_type_t> bitset;
+        bitset.resize(new_size);
+        benchmark::ClobberMemory();
+        state.ResumeTiming();
+
+        // run
+        bitset.clear();
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(new_size,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(new_size, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+FIX_ALIGNED_BITSET_BENCHMARK_RANGE(fix_aligned_bitset_clear, "clear");
+
+template<typename block_type_t>
+void fix_small_bitset_clear(benchmark::State& state)
+{
+    const size_t new_size = static_cast<size_t>(state.range(0));
+
+    for(auto _: state)
+    {
+        // setup
+        state.PauseTiming();
+        fix::small_bitset<block_type_t> bitset;
+        bitset.resize(new_size);
+        benchmark::ClobberMemory();
+        state.ResumeTiming();
+
+        // run
+        bitset.clear();
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(new_size,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(new_size, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+FIX_SMALL_BITSET_BENCHMARK_RANGE(fix_small_bitset_clear, "clear");
+
 #ifdef HAS_BOOST
 template<typename block_type_t>
 void boost_dynamic_bitset_clear(benchmark::State& state)
@@ -0,0 +1,169 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+#include <utils.hpp>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/roaring_bitset.hpp>
+
+#include <benchmark/benchmark.h>
+#include <sul/dynamic_bitset.hpp>
+#ifdef HAS_BOOST
+#    include <boost/dynamic_bitset.hpp>
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+#    include <tr2/dynamic_bitset>
+#endif
+
+#include <random>
+#include <vector>
+
+// random operands with one bit on in density_inverse, the bytes counter is the memory footprint of the operands,
+// to compare the compressed bitset with the dense ones from the densities of the set cover rows to half full bitsets
+#define COMPRESSED_BENCHMARK_RANGE(func, dynamic_bitset_type, name) \
+    BENCHMARK_TEMPLATE(func, dynamic_bitset_type) \
+      ->Name(#dynamic_bitset_type " " name) \
+      ->ArgNames({"bits", "density_inverse"}) \
+      ->ArgsProduct({benchmark::CreateRange(COMPRESSED_RANGE_START, COMPRESSED_RANGE_END, RANGE_MULTIPLIER), \
+                     {2, 8, 64, 512, 4096}}) \
+      ->Unit(benchmark::kNanosecond)
+
+#define COMPRESSED_BENCHMARKS(dynamic_bitset_type) \
+    COMPRESSED_BENCHMARK_RANGE(compressed_count, dynamic_bitset_type, "compressed_count"); \
+    COMPRESSED_BENCHMARK_RANGE(compressed_or_equal, dynamic_bitset_type, "compressed_or_equal"); \
+    COMPRESSED_BENCHMARK_RANGE(compressed_and_count, dynamic_bitset_type, "compressed_and_count"); \
+    COMPRESSED_BENCHMARK_RANGE(compressed_andnot_count, dynamic_bitset_type, "compressed_andnot_count"); \
+    COMPRESSED_BENCHMARK_RANGE(compressed_iterate_bits_on, dynamic_bitset_type, "compressed_iterate_bits_on")
+
+static void set_compressed_counters(benchmark::State& state, size_t bits, size_t bytes)
+{
+    state.counters["1_bit_time"] =
+      benchmark::Counter(static_cast<double>(bits),
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bytes"] =
+      benchmark::Counter(static_cast<double>(bytes), benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+}
+
+// compressed bitsets are given their smallest representation, as after loading data
+template<typename dynamic_bitset_t>
+dynamic_bitset_t random_compressed_bitset(std::minstd_rand& gen, size_t bits, double density)
+{
+    dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits, density);
+    if constexpr(requires { bitset.optimize(); })
+    {
+        bitset.optimize();
+    }
+    return bitset;
+}
+
+template<typename dynamic_bitset_t>
+void compressed_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const double density = 1.0 / static_cast<double>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset = random_compressed_bitset<dynamic_bitset_t>(gen, bits, density);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_count(bitset));
+    }
+
+    set_compressed_counters(state, bits, memory_footprint(bitset));
+}
+
+template<typename dynamic_bitset_t>
+void compressed_or_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const double density = 1.0 / static_cast<double>(state.range(1));
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset1 = random_compressed_bitset<dynamic_bitset_t>(gen, bits, density);
+    const dynamic_bitset_t bitset2 = random_compressed_bitset<dynamic_bitset_t>(gen, bits, density);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::do_or_equal(bitset1, bitset2);
+        benchmark::ClobberMemory();
+    }
+
+    set_compressed_counters(state, bits, memory_footprint(bitset1) + memory_footprint(bitset2));
+}
+
+template<typename dynamic_bitset_t>
+void compressed_and_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const double density = 1.0 / static_cast<double>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset1 = random_compressed_bitset<dynamic_bitset_t>(gen, bits, density);
+    const dynamic_bitset_t bitset2 = random_compressed_bitset<dynamic_bitset_t>(gen, bits, density);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_and_count(bitset1, bitset2));
+    }
+
+    set_compressed_counters(state, bits, memory_footprint(bitset1) + memory_footprint(bitset2));
+}
+
+template<typename dynamic_bitset_t>
+void compressed_andnot_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const double density = 1.0 / static_cast<double>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset1 = random_compressed_bitset<dynamic_bitset_t>(gen, bits, density);
+    const dynamic_bitset_t bitset2 = random_compressed_bitset<dynamic_bitset_t>(gen, bits, density);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_andnot_count(bitset1, bitset2));
+    }
+
+    set_compressed_counters(state, bits, memory_footprint(bitset1) + memory_footprint(bitset2));
+}
+
+template<typename dynamic_bitset_t>
+void compressed_iterate_bits_on(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const double density = 1.0 / static_cast<double>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset = random_compressed_bitset<dynamic_bitset_t>(gen, bits, density);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        size_t sum = 0;
+        fix::dynamic_bitset::do_iterate_bits_on(bitset, [&](size_t bit_pos) noexcept { sum += bit_pos; });
+        benchmark::DoNotOptimize(sum);
+    }
+
+    set_compressed_counters(state, bits, memory_footprint(bitset));
+}
+
+COMPRESSED_BENCHMARKS(fix::roaring_bitset);
+COMPRESSED_BENCHMARKS(sul::dynamic_bitset<uint64_t>);
+COMPRESSED_BENCHMARKS(fix::aligned_bitset<uint64_t>);
+
+#ifdef HAS_BOOST
+COMPRESSED_BENCHMARKS(boost::dynamic_bitset<uint64_t>);
+#endif
+
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+COMPRESSED_BENCHMARKS(std::tr2::dynamic_bitset<uint64_t>);
+#endif
+
+COMPRESSED_BENCHMARKS(std::vector<bool>);
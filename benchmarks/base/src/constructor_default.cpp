@@ -7,6 +7,9 @@
 //
 #include <config.hpp>
 
+#include <fix/aligned_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
 #include <benchmark/benchmark.h>
 #include <sul/dynamic_bitset.hpp>
 #ifdef HAS_BOOST
@@ -34,6 +37,32 @@ void sul_dynamic_bitset_constructor_default(benchmark::State& state)
 
 SUL_DYNAMIC_BITSET_BENCHMARK(sul_dynamic_bitset_constructor_default, "constructor_default");
 
+template<typename block_type_t>
+void fix_aligned_bitset_constructor_default(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        fix::aligned_bitset<block_type_t> bitset;
+        benchmark::DoNotOptimize(bitset);
+        benchmark::ClobberMemory();
+    }
+}
+
+FIX_ALIGNED_BITSET_BENCHMARK(fix_aligned_bitset_constructor_default, "constructor_default");
+
+template<typename block_type_t>
+void fix_small_bitset_constructor_default(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        fix::small_bitset<block_type_t> bitset;
+        benchmark::DoNotOptimize(bitset);
+        benchmark::ClobberMemory();
+    }
+}
+
+FIX_SMALL_BITSET_BENCHMARK(fix_small_bitset_constructor_default, "constructor_default");
+
 #ifdef HAS_BOOST
 template<typename block_type_t>
 void boost_dynamic_bitset_constructor_default(benchmark::State& state)
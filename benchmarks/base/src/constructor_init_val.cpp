@@ -8,6 +8,9 @@
 #include <config.hpp>
 #include <utils.hpp>
 
+#include <fix/aligned_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
 #include <benchmark/benchmark.h>
 #include <sul/dynamic_bitset.hpp>
 #ifdef HAS_BOOST
@@ -40,6 +43,42 @@ void sul_dynamic_bitset_constructor_init_val(benchmark::State& state)
 
 SUL_DYNAMIC_BITSET_BENCHMARK(sul_dynamic_bitset_constructor_init_val, "constructor_init_val");
 
+template<typename block_type_t>
+void fix_aligned_bitset_constructor_init_val(benchmark::State& state)
+{
+    std::minstd_rand gen(SEED);
+    std::uniform_int_distribution<unsigned long long> dis;
+    const unsigned long long init_val = dis(gen);
+    constexpr size_t nbits = bits_number<unsigned long long> * 2;
+
+    for(auto _: state)
+    {
+        fix::aligned_bitset<block_type_t> bitset(nbits, init_val);
+        benchmark::DoNotOptimize(bitset);
+        benchmark::ClobberMemory();
+    }
+}
+
+FIX_ALIGNED_BITSET_BENCHMARK(fix_aligned_bitset_constructor_init_val, "constructor_init_val");
+
+template<typename block_type_t>
+void fix_small_bitset_constructor_init_val(benchmark::State& state)
+{
+    std::minstd_rand gen(SEED);
+    std::uniform_int_distribution<unsigned long long> dis;
+    const unsigned long long init_val = dis(gen);
+    constexpr size_t nbits = bits_number<unsigned long long> * 2;
+
+    for(auto _: state)
+    {
+        fix::small_bitset<block_type_t> bitset(nbits, init_val);
+        benchmark::DoNotOptimize(bitset);
+        benchmark::ClobberMemory();
+    }
+}
+
+FIX_SMALL_BITSET_BENCHMARK(fix_small_bitset_constructor_init_val, "constructor_init_val");
+
 #ifdef HAS_BOOST
 template<typename block_type_t>
 void boost_dynamic_bitset_constructor_init_val(benchmark::State& state)
@@ -8,6 +8,9 @@
 #include <config.hpp>
 #include <utils.hpp>
 
+#include <fix/aligned_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
 #include <benchmark/benchmark.h>
 #include <sul/dynamic_bitset.hpp>
 #ifdef HAS_STD_TR2_DYNAMIC_BITSET
@@ -38,6 +41,46 @@ void sul_dynamic_bitset_constructor_initializer_list(benchmark::State& state)
 
 SUL_DYNAMIC_BITSET_BENCHMARK(sul_dynamic_bitset_constructor_initializer_list, "constructor_initializer_list");
 
+template<typename block_type_t>
+void fix_aligned_bitset_constructor_initializer_list(benchmark::State& state)
+{
+    std::minstd_rand gen(SEED);
+    std::uniform_int_distribution<block_type_t> dis;
+    const block_type_t init_val_1 = dis(gen);
+    const block_type_t init_val_2 = dis(gen);
+    const block_type_t init_val_3 = dis(gen);
+    const block_type_t init_val_4 = dis(gen);
+
+    for(auto _: state)
+    {
+        fix::aligned_bitset<block_type_t> bitset({init_val_1, init_val_2, init_val_3, init_val_4});
+        benchmark::DoNotOptimize(bitset);
+        benchmark::ClobberMemory();
+    }
+}
+
+FIX_ALIGNED_BITSET_BENCHMARK(fix_aligned_bitset_constructor_initializer_list, "constructor_initializer_list");
+
+template<typename block_type_t>
+void fix_small_bitset_constructor_initializer_list(benchmark::State& state)
+{
+    std::minstd_rand gen(SEED);
+    std::uniform_int_distribution<block_type_t> dis;
+    const block_type_t init_val_1 = dis(gen);
+    const block_type_t init_val_2 = dis(gen);
+    const block_type_t init_val_3 = dis(gen);
+    const block_type_t init_val_4 = dis(gen);
+
+    for(auto _: state)
+    {
+        fix::small_bitset<block_type_t> bitset({init_val_1, init_val_2, init_val_3, init_val_4});
+        benchmark::DoNotOptimize(bitset);
+        benchmark::ClobberMemory();
+    }
+}
+
+FIX_SMALL_BITSET_BENCHMARK(fix_small_bitset_constructor_initializer_list, "constructor_initializer_list");
+
 #ifdef HAS_STD_TR2_DYNAMIC_BITSET
 template<typename block_type_t>
 void std_tr2_dynamic_bitset_constructor_initializer_list(benchmark::State& state)
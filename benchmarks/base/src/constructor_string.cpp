@@ -7,6 +7,9 @@
 //
 #include <config.hpp>
 
+#include <fix/aligned_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
 #include <benchmark/benchmark.h>
 #include <sul/dynamic_bitset.hpp>
 #ifdef HAS_BOOST
@@ -52,6 +55,68 @@ void sul_dynamic_bitset_constructor_string(benchmark::State& state)
 
 SUL_DYNAMIC_BITSET_BENCHMARK_RANGE(sul_dynamic_bitset_constructor_string, "constructor_string");
 
+template<typename block_type_t>
+void fix_aligned_bitset_constructor_string(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    std::bernoulli_distribution d;
+    std::ostringstream oss;
+    for(size_t i = 0; i < bits; ++i)
+    {
+        oss << (d(gen) ? '1' : '0');
+    }
+    const std::string str = oss.str();
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::aligned_bitset<block_type_t> bitset(str);
+        benchmark::DoNotOptimize(bitset);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+FIX_ALIGNED_BITSET_BENCHMARK_RANGE(fix_aligned_bitset_constructor_string, "constructor_string");
+
+template<typename block_type_t>
+void fix_small_bitset_constructor_string(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    std::bernoulli_distribution d;
+    std::ostringstream oss;
+    for(size_t i = 0; i < bits; ++i)
+    {
+        oss << (d(gen) ? '1' : '0');
+    }
+    const std::string str = oss.str();
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::small_bitset<block_type_t> bitset(str);
+        benchmark::DoNotOptimize(bitset);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+FIX_SMALL_BITSET_BENCHMARK_RANGE(fix_small_bitset_constructor_string, "constructor_string");
+
 #ifdef HAS_BOOST
 template<typename block_type_t>
 void boost_dynamic_bitset_constructor_string(benchmark::State& state)
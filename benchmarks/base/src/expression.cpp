@@ -0,0 +1,256 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+#include <utils.hpp>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/expression.hpp>
+#include <fix/small_bitset.hpp>
+
+#include <benchmark/benchmark.h>
+#include <sul/dynamic_bitset.hpp>
+#ifdef HAS_BOOST
+#    include <boost/dynamic_bitset.hpp>
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+#    include <tr2/dynamic_bitset>
+#endif
+
+#include <random>
+
+// fused evaluation of lazy expressions against the chain of adapters with a temporary, for the expressions
+// 2 operands: a - b
+// 3 operands: a | (b & ~c)
+// 4 operands: (a | b) - (c ^ d)
+#define EXPRESSION_BENCHMARK_RANGE(func, dynamic_bitset_type, name) \
+    BENCHMARK_TEMPLATE(func, dynamic_bitset_type) \
+      ->Name(#dynamic_bitset_type " " name) \
+      ->ArgNames({"bits", "operands"}) \
+      ->ArgsProduct({benchmark::CreateRange(RANGE_START, RANGE_END, RANGE_MULTIPLIER), {2, 3, 4}})
+
+#define SUL_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(func, name) \
+    EXPRESSION_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint16_t>, name); \
+    EXPRESSION_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint32_t>, name); \
+    EXPRESSION_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint64_t>, name)
+
+#define FIX_ALIGNED_BITSET_EXPRESSION_BENCHMARK_RANGE(func, name) \
+    EXPRESSION_BENCHMARK_RANGE(func, fix::aligned_bitset<uint16_t>, name); \
+    EXPRESSION_BENCHMARK_RANGE(func, fix::aligned_bitset<uint32_t>, name); \
+    EXPRESSION_BENCHMARK_RANGE(func, fix::aligned_bitset<uint64_t>, name)
+
+#define FIX_SMALL_BITSET_EXPRESSION_BENCHMARK_RANGE(func, name) \
+    EXPRESSION_BENCHMARK_RANGE(func, fix::small_bitset<uint16_t>, name); \
+    EXPRESSION_BENCHMARK_RANGE(func, fix::small_bitset<uint32_t>, name); \
+    EXPRESSION_BENCHMARK_RANGE(func, fix::small_bitset<uint64_t>, name)
+
+#define BOOST_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(func, name) \
+    EXPRESSION_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint16_t>, name); \
+    EXPRESSION_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint32_t>, name); \
+    EXPRESSION_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint64_t>, name)
+
+#define STD_TR2_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(func, name) \
+    EXPRESSION_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint16_t>, name); \
+    EXPRESSION_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint32_t>, name); \
+    EXPRESSION_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint64_t>, name)
+
+#define STD_VECTOR_BOOL_EXPRESSION_BENCHMARK_RANGE(func, name) \
+    EXPRESSION_BENCHMARK_RANGE(func, std::vector<bool>, name)
+
+// run function(a, b, c, d) on 4 random operands, set the counters on the bits of the operands used
+template<typename dynamic_bitset_t, typename Function>
+void run_expression_benchmark(benchmark::State& state, Function&& function)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const size_t operands_number = static_cast<size_t>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t a = random_bitset<dynamic_bitset_t>(gen, bits);
+    const dynamic_bitset_t b = random_bitset<dynamic_bitset_t>(gen, bits);
+    const dynamic_bitset_t c = random_bitset<dynamic_bitset_t>(gen, bits);
+    const dynamic_bitset_t d = random_bitset<dynamic_bitset_t>(gen, bits);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        function(a, b, c, d);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(static_cast<double>(bits * operands_number),
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] = benchmark::Counter(static_cast<double>(bits * operands_number),
+                                                           benchmark::Counter::kIsIterationInvariantRate,
+                                                           benchmark::Counter::OneK::kIs1024);
+}
+
+template<typename dynamic_bitset_t>
+void expression_eval(benchmark::State& state)
+{
+    using fix::dynamic_bitset::eval;
+    using fix::dynamic_bitset::expr;
+    dynamic_bitset_t result(static_cast<size_t>(state.range(0)));
+    switch(state.range(1))
+    {
+        case 2:
+            run_expression_benchmark<dynamic_bitset_t>(
+              state, [&](const auto& a, const auto& b, const auto&, const auto&) { eval(result, expr(a) - expr(b)); });
+            break;
+        case 3:
+            run_expression_benchmark<dynamic_bitset_t>(
+              state,
+              [&](const auto& a, const auto& b, const auto& c, const auto&)
+              { eval(result, expr(a) | (expr(b) & ~expr(c))); });
+            break;
+        default:
+            run_expression_benchmark<dynamic_bitset_t>(
+              state,
+              [&](const auto& a, const auto& b, const auto& c, const auto& d)
+              { eval(result, (expr(a) | expr(b)) - (expr(c) ^ expr(d))); });
+            break;
+    }
+}
+
+template<typename dynamic_bitset_t>
+void chain_eval(benchmark::State& state)
+{
+    using namespace fix::dynamic_bitset;
+    dynamic_bitset_t result(static_cast<size_t>(state.range(0)));
+    dynamic_bitset_t temporary(static_cast<size_t>(state.range(0)));
+    switch(state.range(1))
+    {
+        case 2:
+            run_expression_benchmark<dynamic_bitset_t>(state,
+                                                       [&](const auto& a, const auto& b, const auto&, const auto&)
+                                                       {
+                                                           result = a;
+                                                           do_minus_equal(result, b);
+                                                       });
+            break;
+        case 3:
+            run_expression_benchmark<dynamic_bitset_t>(state,
+                                                       [&](const auto& a, const auto& b, const auto& c, const auto&)
+                                                       {
+                                                           result = b;
+                                                           do_minus_equal(result, c);
+                                                           do_or_equal(result, a);
+                                                       });
+            break;
+        default:
+            run_expression_benchmark<dynamic_bitset_t>(state,
+                                                       [&](const auto& a, const auto& b, const auto& c, const auto& d)
+                                                       {
+                                                           result = a;
+                                                           do_or_equal(result, b);
+                                                           temporary = c;
+                                                           do_xor_equal(temporary, d);
+                                                           do_minus_equal(result, temporary);
+                                                       });
+            break;
+    }
+}
+
+template<typename dynamic_bitset_t>
+void expression_count(benchmark::State& state)
+{
+    using fix::dynamic_bitset::count;
+    using fix::dynamic_bitset::expr;
+    switch(state.range(1))
+    {
+        case 2:
+            run_expression_benchmark<dynamic_bitset_t>(
+              state,
+              [&](const auto& a, const auto& b, const auto&, const auto&)
+              { benchmark::DoNotOptimize(count(expr(a) - expr(b))); });
+            break;
+        case 3:
+            run_expression_benchmark<dynamic_bitset_t>(
+              state,
+              [&](const auto& a, const auto& b, const auto& c, const auto&)
+              { benchmark::DoNotOptimize(count(expr(a) | (expr(b) & ~expr(c)))); });
+            break;
+        default:
+            run_expression_benchmark<dynamic_bitset_t>(
+              state,
+              [&](const auto& a, const auto& b, const auto& c, const auto& d)
+              { benchmark::DoNotOptimize(count((expr(a) | expr(b)) - (expr(c) ^ expr(d)))); });
+            break;
+    }
+}
+
+template<typename dynamic_bitset_t>
+void chain_count(benchmark::State& state)
+{
+    using namespace fix::dynamic_bitset;
+    dynamic_bitset_t result(static_cast<size_t>(state.range(0)));
+    dynamic_bitset_t temporary(static_cast<size_t>(state.range(0)));
+    switch(state.range(1))
+    {
+        case 2:
+            run_expression_benchmark<dynamic_bitset_t>(state,
+                                                       [&](const auto& a, const auto& b, const auto&, const auto&)
+                                                       {
+                                                           result = a;
+                                                           do_minus_equal(result, b);
+                                                           benchmark::DoNotOptimize(do_count(result));
+                                                       });
+            break;
+        case 3:
+            run_expression_benchmark<dynamic_bitset_t>(state,
+                                                       [&](const auto& a, const auto& b, const auto& c, const auto&)
+                                                       {
+                                                           result = b;
+                                                           do_minus_equal(result, c);
+                                                           do_or_equal(result, a);
+                                                           benchmark::DoNotOptimize(do_count(result));
+                                                       });
+            break;
+        default:
+            run_expression_benchmark<dynamic_bitset_t>(state,
+                                                       [&](const auto& a, const auto& b, const auto& c, const auto& d)
+                                                       {
+                                                           result = a;
+                                                           do_or_equal(result, b);
+                                                           temporary = c;
+                                                           do_xor_equal(temporary, d);
+                                                           do_minus_equal(result, temporary);
+                                                           benchmark::DoNotOptimize(do_count(result));
+                                                       });
+            break;
+    }
+}
+
+SUL_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(expression_eval, "expression_eval");
+SUL_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(chain_eval, "chain_eval");
+SUL_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(expression_count, "expression_count");
+SUL_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(chain_count, "chain_count");
+FIX_ALIGNED_BITSET_EXPRESSION_BENCHMARK_RANGE(expression_eval, "expression_eval");
+FIX_ALIGNED_BITSET_EXPRESSION_BENCHMARK_RANGE(chain_eval, "chain_eval");
+FIX_ALIGNED_BITSET_EXPRESSION_BENCHMARK_RANGE(expression_count, "expression_count");
+FIX_ALIGNED_BITSET_EXPRESSION_BENCHMARK_RANGE(chain_count, "chain_count");
+FIX_SMALL_BITSET_EXPRESSION_BENCHMARK_RANGE(expression_eval, "expression_eval");
+FIX_SMALL_BITSET_EXPRESSION_BENCHMARK_RANGE(chain_eval, "chain_eval");
+FIX_SMALL_BITSET_EXPRESSION_BENCHMARK_RANGE(expression_count, "expression_count");
+FIX_SMALL_BITSET_EXPRESSION_BENCHMARK_RANGE(chain_count, "chain_count");
+#ifdef HAS_BOOST
+BOOST_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(expression_eval, "expression_eval");
+BOOST_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(chain_eval, "chain_eval");
+BOOST_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(expression_count, "expression_count");
+BOOST_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(chain_count, "chain_count");
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+STD_TR2_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(expression_eval, "expression_eval");
+STD_TR2_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(chain_eval, "chain_eval");
+STD_TR2_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(expression_count, "expression_count");
+STD_TR2_DYNAMIC_BITSET_EXPRESSION_BENCHMARK_RANGE(chain_count, "chain_count");
+#endif
+STD_VECTOR_BOOL_EXPRESSION_BENCHMARK_RANGE(expression_eval, "expression_eval");
+STD_VECTOR_BOOL_EXPRESSION_BENCHMARK_RANGE(chain_eval, "chain_eval");
+STD_VECTOR_BOOL_EXPRESSION_BENCHMARK_RANGE(expression_count, "expression_count");
+STD_VECTOR_BOOL_EXPRESSION_BENCHMARK_RANGE(chain_count, "chain_count");
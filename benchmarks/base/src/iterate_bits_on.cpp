@@ -0,0 +1,147 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+#include <utils.hpp>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
+#include <benchmark/benchmark.h>
+#include <sul/dynamic_bitset.hpp>
+#ifdef HAS_BOOST
+#    include <boost/dynamic_bitset.hpp>
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+#    include <tr2/dynamic_bitset>
+#endif
+
+#include <array>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+// iteration on the bits on, one callback per bit against batches of decoded indices, for each bit pattern
+#define ITERATE_BITS_ON_BENCHMARK_RANGE(func, dynamic_bitset_type, name) \
+    BENCHMARK_TEMPLATE(func, dynamic_bitset_type) \
+      ->Name(#dynamic_bitset_type " " name) \
+      ->ArgNames({"bits", "pattern"}) \
+      ->ArgsProduct(PATTERN_RANGE)
+
+#define SUL_DYNAMIC_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(func, name) \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint16_t>, name); \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint32_t>, name); \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint64_t>, name)
+
+#define FIX_ALIGNED_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(func, name) \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, fix::aligned_bitset<uint16_t>, name); \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, fix::aligned_bitset<uint32_t>, name); \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, fix::aligned_bitset<uint64_t>, name)
+
+#define FIX_SMALL_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(func, name) \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, fix::small_bitset<uint16_t>, name); \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, fix::small_bitset<uint32_t>, name); \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, fix::small_bitset<uint64_t>, name)
+
+#define BOOST_DYNAMIC_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(func, name) \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint16_t>, name); \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint32_t>, name); \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint64_t>, name)
+
+#define STD_TR2_DYNAMIC_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(func, name) \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint16_t>, name); \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint32_t>, name); \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint64_t>, name)
+
+#define STD_VECTOR_BOOL_ITERATE_BITS_ON_BENCHMARK_RANGE(func, name) \
+    ITERATE_BITS_ON_BENCHMARK_RANGE(func, std::vector<bool>, name)
+
+template<typename dynamic_bitset_t>
+void iterate_bits_on(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits, pattern);
+    const size_t bits_on = fix::dynamic_bitset::do_count(bitset);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        size_t sum = 0;
+        fix::dynamic_bitset::do_iterate_bits_on(bitset, [&](size_t bit_on) noexcept { sum += bit_on; });
+        benchmark::DoNotOptimize(sum);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.counters["bits_on_per_second"] =
+      benchmark::Counter(bits_on, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+template<typename dynamic_bitset_t>
+void iterate_bits_on_batched(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits, pattern);
+    const size_t bits_on = fix::dynamic_bitset::do_count(bitset);
+    std::array<size_t, 256> buffer;
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        size_t sum = 0;
+        fix::dynamic_bitset::do_iterate_bits_on_batched(bitset,
+                                                        buffer,
+                                                        [&](std::span<const size_t> batch) noexcept
+                                                        {
+                                                            for(const size_t bit_on: batch)
+                                                            {
+                                                                sum += bit_on;
+                                                            }
+                                                        });
+        benchmark::DoNotOptimize(sum);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.counters["bits_on_per_second"] =
+      benchmark::Counter(bits_on, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    state.SetLabel(std::string(bit_pattern_name(pattern)));
+}
+
+SUL_DYNAMIC_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(iterate_bits_on, "iterate_bits_on");
+SUL_DYNAMIC_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(iterate_bits_on_batched, "iterate_bits_on_batched");
+FIX_ALIGNED_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(iterate_bits_on, "iterate_bits_on");
+FIX_ALIGNED_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(iterate_bits_on_batched, "iterate_bits_on_batched");
+FIX_SMALL_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(iterate_bits_on, "iterate_bits_on");
+FIX_SMALL_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(iterate_bits_on_batched, "iterate_bits_on_batched");
+#ifdef HAS_BOOST
+BOOST_DYNAMIC_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(iterate_bits_on, "iterate_bits_on");
+BOOST_DYNAMIC_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(iterate_bits_on_batched, "iterate_bits_on_batched");
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+STD_TR2_DYNAMIC_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(iterate_bits_on, "iterate_bits_on");
+STD_TR2_DYNAMIC_BITSET_ITERATE_BITS_ON_BENCHMARK_RANGE(iterate_bits_on_batched, "iterate_bits_on_batched");
+#endif
+STD_VECTOR_BOOL_ITERATE_BITS_ON_BENCHMARK_RANGE(iterate_bits_on, "iterate_bits_on");
+STD_VECTOR_BOOL_ITERATE_BITS_ON_BENCHMARK_RANGE(iterate_bits_on_batched, "iterate_bits_on_batched");
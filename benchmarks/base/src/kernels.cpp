@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+#include <utils.hpp>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/kernels.hpp>
+#include <fix/small_bitset.hpp>
+
+#include <benchmark/benchmark.h>
+#include <sul/dynamic_bitset.hpp>
+#ifdef HAS_BOOST
+#    include <boost/dynamic_bitset.hpp>
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+#    include <tr2/dynamic_bitset>
+#endif
+
+#include <random>
+#include <utility>
+#include <vector>
+
+// fix kernels on the blocks of each dynamic bitset, to compare with the dynamic bitsets own operations
+#define KERNELS_BENCHMARK_RANGE(func, dynamic_bitset_type, name) \
+    BENCHMARK_TEMPLATE(func, dynamic_bitset_type) \
+      ->Name(#dynamic_bitset_type " " name) \
+      ->RangeMultiplier(RANGE_MULTIPLIER) \
+      ->Range(RANGE_START, RANGE_END)
+
+#define SUL_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(func, name) \
+    KERNELS_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint16_t>, name); \
+    KERNELS_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint32_t>, name); \
+    KERNELS_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint64_t>, name)
+
+#define FIX_ALIGNED_BITSET_KERNELS_BENCHMARK_RANGE(func, name) \
+    KERNELS_BENCHMARK_RANGE(func, fix::aligned_bitset<uint16_t>, name); \
+    KERNELS_BENCHMARK_RANGE(func, fix::aligned_bitset<uint32_t>, name); \
+    KERNELS_BENCHMARK_RANGE(func, fix::aligned_bitset<uint64_t>, name)
+
+#define FIX_SMALL_BITSET_KERNELS_BENCHMARK_RANGE(func, name) \
+    KERNELS_BENCHMARK_RANGE(func, fix::small_bitset<uint16_t>, name); \
+    KERNELS_BENCHMARK_RANGE(func, fix::small_bitset<uint32_t>, name); \
+    KERNELS_BENCHMARK_RANGE(func, fix::small_bitset<uint64_t>, name)
+
+#define BOOST_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(func, name) \
+    KERNELS_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint16_t>, name); \
+    KERNELS_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint32_t>, name); \
+    KERNELS_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint64_t>, name)
+
+#define STD_TR2_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(func, name) \
+    KERNELS_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint16_t>, name); \
+    KERNELS_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint32_t>, name); \
+    KERNELS_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint64_t>, name)
+
+#define STD_VECTOR_BOOL_KERNELS_BENCHMARK_RANGE(func, name) KERNELS_BENCHMARK_RANGE(func, std::vector<bool>, name)
+
+template<typename dynamic_bitset_t>
+void kernels_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits);
+    const auto bitset_blocks = fix::dynamic_bitset::blocks(bitset);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::kernels::count(bitset_blocks, bits));
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+template<typename dynamic_bitset_t>
+void kernels_or_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset1 = random_bitset<dynamic_bitset_t>(gen, bits);
+    const dynamic_bitset_t bitset2 = random_bitset<dynamic_bitset_t>(gen, bits);
+    const auto bitset1_blocks = fix::dynamic_bitset::blocks(bitset1);
+    const auto bitset2_blocks = fix::dynamic_bitset::blocks(bitset2);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::kernels::or_equal(bitset1_blocks, bitset2_blocks);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+template<typename dynamic_bitset_t>
+void kernels_and_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset1 = random_bitset<dynamic_bitset_t>(gen, bits);
+    const dynamic_bitset_t bitset2 = random_bitset<dynamic_bitset_t>(gen, bits);
+    const auto bitset1_blocks = fix::dynamic_bitset::blocks(bitset1);
+    const auto bitset2_blocks = fix::dynamic_bitset::blocks(bitset2);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::kernels::and_equal(bitset1_blocks, bitset2_blocks);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+template<typename dynamic_bitset_t>
+void kernels_minus_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset1 = random_bitset<dynamic_bitset_t>(gen, bits);
+    const dynamic_bitset_t bitset2 = random_bitset<dynamic_bitset_t>(gen, bits);
+    const auto bitset1_blocks = fix::dynamic_bitset::blocks(bitset1);
+    const auto bitset2_blocks = fix::dynamic_bitset::blocks(bitset2);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::kernels::minus_equal(bitset1_blocks, bitset2_blocks);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+template<typename dynamic_bitset_t>
+void kernels_xor_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset1 = random_bitset<dynamic_bitset_t>(gen, bits);
+    const dynamic_bitset_t bitset2 = random_bitset<dynamic_bitset_t>(gen, bits);
+    const auto bitset1_blocks = fix::dynamic_bitset::blocks(bitset1);
+    const auto bitset2_blocks = fix::dynamic_bitset::blocks(bitset2);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::kernels::xor_equal(bitset1_blocks, bitset2_blocks);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+template<typename dynamic_bitset_t>
+void kernels_any(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    dynamic_bitset_t bitset;
+    bitset.resize(bits); // all bits off: worst case, every block is read
+    const auto bitset_blocks = fix::dynamic_bitset::blocks(std::as_const(bitset));
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::kernels::any(bitset_blocks, bits));
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+SUL_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_count, "kernels::count");
+SUL_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_or_equal, "kernels::or_equal");
+SUL_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_and_equal, "kernels::and_equal");
+SUL_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_minus_equal, "kernels::minus_equal");
+SUL_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_xor_equal, "kernels::xor_equal");
+SUL_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_any, "kernels::any");
+FIX_ALIGNED_BITSET_KERNELS_BENCHMARK_RANGE(kernels_count, "kernels::count");
+FIX_ALIGNED_BITSET_KERNELS_BENCHMARK_RANGE(kernels_or_equal, "kernels::or_equal");
+FIX_ALIGNED_BITSET_KERNELS_BENCHMARK_RANGE(kernels_and_equal, "kernels::and_equal");
+FIX_ALIGNED_BITSET_KERNELS_BENCHMARK_RANGE(kernels_minus_equal, "kernels::minus_equal");
+FIX_ALIGNED_BITSET_KERNELS_BENCHMARK_RANGE(kernels_xor_equal, "kernels::xor_equal");
+FIX_ALIGNED_BITSET_KERNELS_BENCHMARK_RANGE(kernels_any, "kernels::any");
+FIX_SMALL_BITSET_KERNELS_BENCHMARK_RANGE(kernels_count, "kernels::count");
+FIX_SMALL_BITSET_KERNELS_BENCHMARK_RANGE(kernels_or_equal, "kernels::or_equal");
+FIX_SMALL_BITSET_KERNELS_BENCHMARK_RANGE(kernels_and_equal, "kernels::and_equal");
+FIX_SMALL_BITSET_KERNELS_BENCHMARK_RANGE(kernels_minus_equal, "kernels::minus_equal");
+FIX_SMALL_BITSET_KERNELS_BENCHMARK_RANGE(kernels_xor_equal, "kernels::xor_equal");
+FIX_SMALL_BITSET_KERNELS_BENCHMARK_RANGE(kernels_any, "kernels::any");
+
+#ifdef HAS_BOOST
+BOOST_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_count, "kernels::count");
+BOOST_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_or_equal, "kernels::or_equal");
+BOOST_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_and_equal, "kernels::and_equal");
+BOOST_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_minus_equal, "kernels::minus_equal");
+BOOST_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_xor_equal, "kernels::xor_equal");
+BOOST_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_any, "kernels::any");
+#endif
+
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+STD_TR2_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_count, "kernels::count");
+STD_TR2_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_or_equal, "kernels::or_equal");
+STD_TR2_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_and_equal, "kernels::and_equal");
+STD_TR2_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_minus_equal, "kernels::minus_equal");
+STD_TR2_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_xor_equal, "kernels::xor_equal");
+STD_TR2_DYNAMIC_BITSET_KERNELS_BENCHMARK_RANGE(kernels_any, "kernels::any");
+#endif
+
+STD_VECTOR_BOOL_KERNELS_BENCHMARK_RANGE(kernels_count, "kernels::count");
+STD_VECTOR_BOOL_KERNELS_BENCHMARK_RANGE(kernels_or_equal, "kernels::or_equal");
+STD_VECTOR_BOOL_KERNELS_BENCHMARK_RANGE(kernels_and_equal, "kernels::and_equal");
+STD_VECTOR_BOOL_KERNELS_BENCHMARK_RANGE(kernels_minus_equal, "kernels::minus_equal");
+STD_VECTOR_BOOL_KERNELS_BENCHMARK_RANGE(kernels_xor_equal, "kernels::xor_equal");
+STD_VECTOR_BOOL_KERNELS_BENCHMARK_RANGE(kernels_any, "kernels::any");
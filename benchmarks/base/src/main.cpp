@@ -5,6 +5,103 @@
 // See accompanying file LICENSE or copy at
 // https://opensource.org/licenses/MIT
 //
+#include <arguments.hpp>
+#include <auto_bitset_calibration.hpp>
+#include <auto_calibration_reporter.hpp>
+#include <census_reporter.hpp>
+#include <working_set.hpp>
+
+#include <fix/auto_bitset.hpp>
+#include <fix/census.hpp>
+#include <fix/kernels_simd.hpp>
+
 #include <benchmark/benchmark.h>
 
-BENCHMARK_MAIN();
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+
+// calibration mode: run the benchmarks of the representations of fix::auto_bitset and write its calibration table
+static int calibrate_auto_bitset(const std::string& calibration_path)
+{
+    auto_calibration_reporter reporter(benchmark::CreateDefaultDisplayReporter());
+    benchmark::RunSpecifiedBenchmarks(&reporter, auto_calibration_reporter::benchmark_filter());
+    benchmark::Shutdown();
+
+    const fix::auto_bitset_calibration calibration = reporter.calibration();
+    std::ofstream calibration_file(calibration_path);
+    calibration.save(calibration_file);
+    if(!calibration_file)
+    {
+        std::cerr << "failed to write fix::auto_bitset calibration: " << calibration_path << '\n';
+        return 1;
+    }
+    std::cerr << "fix::auto_bitset calibration written to: " << calibration_path << ", "
+              << calibration.entries().size() << " entries\n";
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    // Record the instruction set used by the fix kernels
+    benchmark::AddCustomContext(
+      "fix_kernels_isa",
+      std::string(fix::dynamic_bitset::kernels::isa_name(fix::dynamic_bitset::kernels::selected_isa())));
+
+    // Process arguments
+    // --auto_bitset_calibrate=<file>: calibration mode, writes the fix::auto_bitset calibration table to file
+    // --auto_bitset_calibration=<file>: calibration table of fix::auto_bitset, default representations without it
+    // --working_set=<hot|L1|L2|LLC|4xLLC>: working set of the operands of the matrix benchmarks, hot by default
+    const std::string auto_bitset_calibrate = extract_argument(argc, argv, "--auto_bitset_calibrate");
+    const std::string auto_bitset_calibration = extract_argument(argc, argv, "--auto_bitset_calibration");
+    const std::string working_set_argument = extract_argument(argc, argv, "--working_set");
+    const std::string benchmark_out = find_argument(argc, argv, "--benchmark_out");
+    const std::string benchmark_out_format = find_argument(argc, argv, "--benchmark_out_format");
+    benchmark::Initialize(&argc, argv);
+    if(benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    if(!auto_bitset_calibrate.empty())
+    {
+        return calibrate_auto_bitset(auto_bitset_calibrate);
+    }
+
+    // Load the fix::auto_bitset calibration, before the benchmarks construct their bitsets
+    if(!auto_bitset_calibration.empty())
+    {
+        if(!load_auto_bitset_calibration(auto_bitset_calibration))
+        {
+            return 1;
+        }
+    }
+
+    // Select the working set of the matrix benchmarks, from the cache sizes of the CPU
+    if(!working_set_argument.empty())
+    {
+        const std::optional<working_set> set = working_set_from_name(working_set_argument);
+        if(!set || (*set != working_set::hot && working_set_bytes(*set) == 0))
+        {
+            std::cerr << "unknown working set or cache size: " << working_set_argument << '\n';
+            return 1;
+        }
+        selected_working_set() = *set;
+        benchmark::AddCustomContext("working_set",
+                                    working_set_argument + ": " + std::to_string(working_set_bytes(*set)) + " bytes");
+    }
+
+    // Run benchmarks, with the census of the fix adapters when enabled
+    if constexpr(fix::dynamic_bitset::census::enabled)
+    {
+        run_census_benchmarks(benchmark_out, benchmark_out_format);
+    }
+    else
+    {
+        benchmark::RunSpecifiedBenchmarks();
+    }
+    benchmark::Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,390 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+#include <matrix.hpp>
+#include <utils.hpp>
+#include <working_set.hpp>
+
+#include <fix/dynamic_bitset.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// operations of the fix adapters, on random operands of each bit pattern: the adapters use the fix kernels on the
+// blocks of the backends giving access to them, the bitset_traits hooks or the members of the others; outside of the
+// hot working set, the label gives the cache level of the operands and the working_set counter their bytes
+static void set_matrix_counters(benchmark::State& state, size_t bits, bit_pattern pattern, size_t working_set_bytes)
+{
+    state.counters["1_bit_time"] =
+      benchmark::Counter(static_cast<double>(bits),
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] = benchmark::Counter(
+      static_cast<double>(bits), benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+    if(selected_working_set() == working_set::hot)
+    {
+        state.SetLabel(std::string(bit_pattern_name(pattern)));
+        return;
+    }
+    state.counters["working_set"] = benchmark::Counter(
+      static_cast<double>(working_set_bytes), benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+    std::string label(bit_pattern_name(pattern));
+    label += ' ';
+    label += working_set_name(selected_working_set());
+    state.SetLabel(label);
+}
+
+template<typename dynamic_bitset_t>
+void matrix_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    operands_pool<dynamic_bitset_t> operands(gen, bits, pattern, 1, selected_working_set());
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_count(operands[0]));
+        operands.next();
+    }
+
+    set_matrix_counters(state, bits, pattern, operands.bytes());
+}
+
+template<typename dynamic_bitset_t>
+void matrix_all(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    operands_pool<dynamic_bitset_t> operands(gen, bits, pattern, 1, selected_working_set());
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_all(operands[0]));
+        operands.next();
+    }
+
+    set_matrix_counters(state, bits, pattern, operands.bytes());
+}
+
+template<typename dynamic_bitset_t>
+void matrix_any(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    operands_pool<dynamic_bitset_t> operands(gen, bits, pattern, 1, selected_working_set());
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_any(operands[0]));
+        operands.next();
+    }
+
+    set_matrix_counters(state, bits, pattern, operands.bytes());
+}
+
+template<typename dynamic_bitset_t>
+void matrix_none(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    operands_pool<dynamic_bitset_t> operands(gen, bits, pattern, 1, selected_working_set());
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_none(operands[0]));
+        operands.next();
+    }
+
+    set_matrix_counters(state, bits, pattern, operands.bytes());
+}
+
+template<typename dynamic_bitset_t>
+void matrix_find_first(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    operands_pool<dynamic_bitset_t> operands(gen, bits, pattern, 1, selected_working_set());
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_find_first(operands[0]));
+        operands.next();
+    }
+
+    set_matrix_counters(state, bits, pattern, operands.bytes());
+}
+
+template<typename dynamic_bitset_t>
+void matrix_reset(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    operands_pool<dynamic_bitset_t> operands(gen, bits, pattern, 1, selected_working_set());
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::do_reset(operands[0]);
+        benchmark::ClobberMemory();
+        operands.next();
+    }
+
+    set_matrix_counters(state, bits, pattern, operands.bytes());
+}
+
+template<typename dynamic_bitset_t>
+void matrix_or_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    operands_pool<dynamic_bitset_t> operands(gen, bits, pattern, 2, selected_working_set());
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::do_or_equal(operands[0], operands[1]);
+        benchmark::ClobberMemory();
+        operands.next();
+    }
+
+    set_matrix_counters(state, bits, pattern, operands.bytes());
+}
+
+template<typename dynamic_bitset_t>
+void matrix_and_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    operands_pool<dynamic_bitset_t> operands(gen, bits, pattern, 2, selected_working_set());
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::do_and_equal(operands[0], operands[1]);
+        benchmark::ClobberMemory();
+        operands.next();
+    }
+
+    set_matrix_counters(state, bits, pattern, operands.bytes());
+}
+
+template<typename dynamic_bitset_t>
+void matrix_xor_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    operands_pool<dynamic_bitset_t> operands(gen, bits, pattern, 2, selected_working_set());
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::do_xor_equal(operands[0], operands[1]);
+        benchmark::ClobberMemory();
+        operands.next();
+    }
+
+    set_matrix_counters(state, bits, pattern, operands.bytes());
+}
+
+template<typename dynamic_bitset_t>
+void matrix_minus_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    operands_pool<dynamic_bitset_t> operands(gen, bits, pattern, 2, selected_working_set());
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::do_minus_equal(operands[0], operands[1]);
+        benchmark::ClobberMemory();
+        operands.next();
+    }
+
+    set_matrix_counters(state, bits, pattern, operands.bytes());
+}
+
+template<typename dynamic_bitset_t>
+void matrix_or_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    operands_pool<dynamic_bitset_t> operands(gen, bits, pattern, 2, selected_working_set());
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_or_count(operands[0], operands[1]));
+        operands.next();
+    }
+
+    set_matrix_counters(state, bits, pattern, operands.bytes());
+}
+
+template<typename dynamic_bitset_t>
+void matrix_and_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    operands_pool<dynamic_bitset_t> operands(gen, bits, pattern, 2, selected_working_set());
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_and_count(operands[0], operands[1]));
+        operands.next();
+    }
+
+    set_matrix_counters(state, bits, pattern, operands.bytes());
+}
+
+template<typename dynamic_bitset_t>
+void matrix_andnot_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    operands_pool<dynamic_bitset_t> operands(gen, bits, pattern, 2, selected_working_set());
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::do_andnot_count(operands[0], operands[1]));
+        operands.next();
+    }
+
+    set_matrix_counters(state, bits, pattern, operands.bytes());
+}
+
+template<typename dynamic_bitset_t>
+void matrix_iterate_bits_on(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const bit_pattern pattern = static_cast<bit_pattern>(state.range(1));
+    std::minstd_rand gen(SEED);
+    operands_pool<dynamic_bitset_t> operands(gen, bits, pattern, 1, selected_working_set());
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        size_t sum = 0;
+        fix::dynamic_bitset::do_iterate_bits_on(operands[0], [&](size_t bit_pos) noexcept { sum += bit_pos; });
+        benchmark::DoNotOptimize(sum);
+        operands.next();
+    }
+
+    set_matrix_counters(state, bits, pattern, operands.bytes());
+}
+
+// operations of the matrix, by name
+template<typename dynamic_bitset_t>
+static constexpr std::array<std::pair<std::string_view, void (*)(benchmark::State&)>, 14> matrix_operations = {{
+  {"count", matrix_count<dynamic_bitset_t>},
+  {"all", matrix_all<dynamic_bitset_t>},
+  {"any", matrix_any<dynamic_bitset_t>},
+  {"none", matrix_none<dynamic_bitset_t>},
+  {"find_first", matrix_find_first<dynamic_bitset_t>},
+  {"reset", matrix_reset<dynamic_bitset_t>},
+  {"or_equal", matrix_or_equal<dynamic_bitset_t>},
+  {"and_equal", matrix_and_equal<dynamic_bitset_t>},
+  {"xor_equal", matrix_xor_equal<dynamic_bitset_t>},
+  {"minus_equal", matrix_minus_equal<dynamic_bitset_t>},
+  {"or_count", matrix_or_count<dynamic_bitset_t>},
+  {"and_count", matrix_and_count<dynamic_bitset_t>},
+  {"andnot_count", matrix_andnot_count<dynamic_bitset_t>},
+  {"iterate_bits_on", matrix_iterate_bits_on<dynamic_bitset_t>},
+}};
+
+// dynamic backends on the sizes and bit patterns of the other benchmarks
+template<typename backend_t, typename dynamic_bitset_t>
+static void register_matrix_operations(std::string_view parameter)
+{
+    for(const auto& [operation, function]: matrix_operations<dynamic_bitset_t>)
+    {
+        benchmark::RegisterBenchmark(matrix::benchmark_name<backend_t>(parameter, operation).c_str(), function)
+          ->ArgNames({"bits", "pattern"})
+          ->ArgsProduct(PATTERN_RANGE);
+    }
+}
+
+template<typename backend_t, typename... blocks_t>
+static void register_matrix_blocks(matrix::type_list<blocks_t...>)
+{
+    const auto register_block = []<typename block_t>()
+    {
+        if constexpr(matrix::backend_block_type<backend_t, block_t>)
+        {
+            register_matrix_operations<backend_t, typename backend_t::template type<block_t>>(
+              matrix::block_type_name<block_t>());
+        }
+    };
+    (register_block.template operator()<blocks_t>(), ...);
+}
+
+// fixed-size backends on their sizes, for each bit pattern
+template<typename backend_t, size_t... sizes>
+static void register_matrix_sizes(matrix::size_list<sizes...>)
+{
+    const auto register_size = []<size_t bits>()
+    {
+        for(const auto& [operation, function]: matrix_operations<typename backend_t::template type<bits>>)
+        {
+            const std::string name = matrix::benchmark_name<backend_t>(std::to_string(bits), operation);
+            benchmark::RegisterBenchmark(name.c_str(), function)
+              ->ArgNames({"bits", "pattern"})
+              ->ArgsProduct({{static_cast<int64_t>(bits)}, BIT_PATTERNS});
+        }
+    };
+    (register_size.template operator()<sizes>(), ...);
+}
+
+template<typename... backends_t>
+static bool register_matrix(matrix::type_list<backends_t...>)
+{
+    const auto register_backend = []<typename backend_t>()
+    {
+        if constexpr(matrix::block_backend<backend_t>)
+        {
+            register_matrix_blocks<backend_t>(matrix::block_types{});
+        }
+        else if constexpr(matrix::fixed_size_backend<backend_t>)
+        {
+            register_matrix_sizes<backend_t>(typename backend_t::sizes{});
+        }
+        else
+        {
+            register_matrix_operations<backend_t, typename backend_t::type>({});
+        }
+    };
+    (register_backend.template operator()<backends_t>(), ...);
+    return true;
+}
+
+[[maybe_unused]] static const bool matrix_registered = register_matrix(matrix::backends{});
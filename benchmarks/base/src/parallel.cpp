@@ -0,0 +1,247 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+#include <utils.hpp>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/parallel.hpp>
+#include <fix/small_bitset.hpp>
+
+#include <benchmark/benchmark.h>
+#include <sul/dynamic_bitset.hpp>
+#ifdef HAS_BOOST
+#    include <boost/dynamic_bitset.hpp>
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+#    include <tr2/dynamic_bitset>
+#endif
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+// multi-threaded adapters on very large bitsets, for thread pools from 1 to hardware_concurrency threads
+// the parallel split does not depend on the block type, only 64 bits blocks are benchmarked
+#define PARALLEL_BENCHMARK_RANGE(func, dynamic_bitset_type, name) \
+    BENCHMARK_TEMPLATE(func, dynamic_bitset_type) \
+      ->Name(#dynamic_bitset_type " " name) \
+      ->ArgNames({"bits", "threads"}) \
+      ->ArgsProduct({benchmark::CreateRange(PARALLEL_RANGE_START, PARALLEL_RANGE_END, RANGE_MULTIPLIER), \
+                     benchmark::CreateRange(1, std::max(1u, std::thread::hardware_concurrency()), 2)}) \
+      ->Unit(benchmark::kMicrosecond) \
+      ->UseRealTime()
+
+#define SUL_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(func, name) \
+    PARALLEL_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint64_t>, name)
+
+#define FIX_ALIGNED_BITSET_PARALLEL_BENCHMARK_RANGE(func, name) \
+    PARALLEL_BENCHMARK_RANGE(func, fix::aligned_bitset<uint64_t>, name)
+
+#define FIX_SMALL_BITSET_PARALLEL_BENCHMARK_RANGE(func, name) \
+    PARALLEL_BENCHMARK_RANGE(func, fix::small_bitset<uint64_t>, name)
+
+#define BOOST_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(func, name) \
+    PARALLEL_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint64_t>, name)
+
+#define STD_TR2_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(func, name) \
+    PARALLEL_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint64_t>, name)
+
+#define STD_VECTOR_BOOL_PARALLEL_BENCHMARK_RANGE(func, name) PARALLEL_BENCHMARK_RANGE(func, std::vector<bool>, name)
+
+// the sizes start below parallel::default_threshold: the benchmarks force the parallel path, with a threshold of 0 bits,
+// so that all sizes measure the thread pool, and restore the threshold afterwards
+class forced_parallel_path final
+{
+public:
+    forced_parallel_path() noexcept
+      : m_threshold(fix::dynamic_bitset::parallel::threshold())
+    {
+        fix::dynamic_bitset::parallel::set_threshold(0);
+    }
+
+    forced_parallel_path(const forced_parallel_path&) = delete;
+    forced_parallel_path(forced_parallel_path&&) = delete;
+    forced_parallel_path& operator=(const forced_parallel_path&) = delete;
+    forced_parallel_path& operator=(forced_parallel_path&&) = delete;
+
+    ~forced_parallel_path() noexcept
+    {
+        fix::dynamic_bitset::parallel::set_threshold(m_threshold);
+    }
+
+private:
+    size_t m_threshold;
+};
+
+static void set_parallel_counters(benchmark::State& state, size_t bits)
+{
+    state.counters["1_bit_time"] =
+      benchmark::Counter(static_cast<double>(bits),
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] = benchmark::Counter(
+      static_cast<double>(bits), benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+template<typename dynamic_bitset_t>
+void parallel_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    fix::dynamic_bitset::parallel::thread_pool pool(static_cast<size_t>(state.range(1)));
+    const forced_parallel_path parallel_path;
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::parallel::do_count(bitset, pool));
+    }
+
+    set_parallel_counters(state, bits);
+}
+
+template<typename dynamic_bitset_t>
+void parallel_or_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    fix::dynamic_bitset::parallel::thread_pool pool(static_cast<size_t>(state.range(1)));
+    const forced_parallel_path parallel_path;
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset1 = random_bitset<dynamic_bitset_t>(gen, bits);
+    const dynamic_bitset_t bitset2 = random_bitset<dynamic_bitset_t>(gen, bits);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::parallel::do_or_equal(bitset1, bitset2, pool);
+        benchmark::ClobberMemory();
+    }
+
+    set_parallel_counters(state, bits);
+}
+
+template<typename dynamic_bitset_t>
+void parallel_and_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    fix::dynamic_bitset::parallel::thread_pool pool(static_cast<size_t>(state.range(1)));
+    const forced_parallel_path parallel_path;
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset1 = random_bitset<dynamic_bitset_t>(gen, bits);
+    const dynamic_bitset_t bitset2 = random_bitset<dynamic_bitset_t>(gen, bits);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::parallel::do_and_equal(bitset1, bitset2, pool);
+        benchmark::ClobberMemory();
+    }
+
+    set_parallel_counters(state, bits);
+}
+
+template<typename dynamic_bitset_t>
+void parallel_minus_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    fix::dynamic_bitset::parallel::thread_pool pool(static_cast<size_t>(state.range(1)));
+    const forced_parallel_path parallel_path;
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset1 = random_bitset<dynamic_bitset_t>(gen, bits);
+    const dynamic_bitset_t bitset2 = random_bitset<dynamic_bitset_t>(gen, bits);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::parallel::do_minus_equal(bitset1, bitset2, pool);
+        benchmark::ClobberMemory();
+    }
+
+    set_parallel_counters(state, bits);
+}
+
+template<typename dynamic_bitset_t>
+void parallel_any(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    fix::dynamic_bitset::parallel::thread_pool pool(static_cast<size_t>(state.range(1)));
+    const forced_parallel_path parallel_path;
+    // all bits off: worst case, no early exit
+    const dynamic_bitset_t bitset(bits);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::parallel::do_any(bitset, pool));
+    }
+
+    set_parallel_counters(state, bits);
+}
+
+template<typename dynamic_bitset_t>
+void parallel_all(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    fix::dynamic_bitset::parallel::thread_pool pool(static_cast<size_t>(state.range(1)));
+    const forced_parallel_path parallel_path;
+    // all bits on: worst case, no early exit
+    dynamic_bitset_t bitset(bits);
+    bitset.flip();
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(fix::dynamic_bitset::parallel::do_all(bitset, pool));
+    }
+
+    set_parallel_counters(state, bits);
+}
+
+SUL_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_count, "parallel_count");
+SUL_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_or_equal, "parallel_or_equal");
+SUL_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_and_equal, "parallel_and_equal");
+SUL_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_minus_equal, "parallel_minus_equal");
+SUL_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_any, "parallel_any");
+SUL_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_all, "parallel_all");
+FIX_ALIGNED_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_count, "parallel_count");
+FIX_ALIGNED_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_or_equal, "parallel_or_equal");
+FIX_ALIGNED_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_and_equal, "parallel_and_equal");
+FIX_ALIGNED_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_minus_equal, "parallel_minus_equal");
+FIX_ALIGNED_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_any, "parallel_any");
+FIX_ALIGNED_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_all, "parallel_all");
+FIX_SMALL_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_count, "parallel_count");
+FIX_SMALL_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_or_equal, "parallel_or_equal");
+FIX_SMALL_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_and_equal, "parallel_and_equal");
+FIX_SMALL_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_minus_equal, "parallel_minus_equal");
+FIX_SMALL_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_any, "parallel_any");
+FIX_SMALL_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_all, "parallel_all");
+#ifdef HAS_BOOST
+BOOST_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_count, "parallel_count");
+BOOST_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_or_equal, "parallel_or_equal");
+BOOST_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_and_equal, "parallel_and_equal");
+BOOST_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_minus_equal, "parallel_minus_equal");
+BOOST_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_any, "parallel_any");
+BOOST_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_all, "parallel_all");
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+STD_TR2_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_count, "parallel_count");
+STD_TR2_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_or_equal, "parallel_or_equal");
+STD_TR2_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_and_equal, "parallel_and_equal");
+STD_TR2_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_minus_equal, "parallel_minus_equal");
+STD_TR2_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_any, "parallel_any");
+STD_TR2_DYNAMIC_BITSET_PARALLEL_BENCHMARK_RANGE(parallel_all, "parallel_all");
+#endif
+STD_VECTOR_BOOL_PARALLEL_BENCHMARK_RANGE(parallel_count, "parallel_count");
+STD_VECTOR_BOOL_PARALLEL_BENCHMARK_RANGE(parallel_or_equal, "parallel_or_equal");
+STD_VECTOR_BOOL_PARALLEL_BENCHMARK_RANGE(parallel_and_equal, "parallel_and_equal");
+STD_VECTOR_BOOL_PARALLEL_BENCHMARK_RANGE(parallel_minus_equal, "parallel_minus_equal");
+STD_VECTOR_BOOL_PARALLEL_BENCHMARK_RANGE(parallel_any, "parallel_any");
+STD_VECTOR_BOOL_PARALLEL_BENCHMARK_RANGE(parallel_all, "parallel_all");
@@ -8,6 +8,9 @@
 #include <config.hpp>
 #include <utils.hpp>
 
+#include <fix/aligned_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
 #include <benchmark/benchmark.h>
 #include <sul/dynamic_bitset.hpp>
 #ifdef HAS_BOOST
@@ -55,6 +58,71 @@ void sul_dynamic_bitset_pop_back(benchmark::State& state)
 
 SUL_DYNAMIC_BITSET_BENCHMARK_RANGE(sul_dynamic_bitset_pop_back, "pop_back");
 
+template<typename block_type_t>
+void fix_aligned_bitset_pop_back(benchmark::State& state)
+{
+    const size_t bits_to_pop_back = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+
+    for(auto _: state)
+    {
+        // setup
+        state.PauseTiming();
+        fix::aligned_bitset<block_type_t> bitset =
+          random_bitset<fix::aligned_bitset<block_type_t>>(gen, bits_to_pop_back);
+        benchmark::ClobberMemory();
+        state.ResumeTiming();
+
+        // run
+        for(size_t i = 0; i < bits_to_pop_back; ++i)
+        {
+            bitset.pop_back();
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits_to_pop_back,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] = benchmark::Counter(
+      bits_to_pop_back, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+FIX_ALIGNED_BITSET_BENCHMARK_RANGE(fix_aligned_bitset_pop_back, "pop_back");
+
+template<typename block_type_t>
+void fix_small_bitset_pop_back(benchmark::State& state)
+{
+    const size_t bits_to_pop_back = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+
+    for(auto _: state)
+    {
+        // setup
+        state.PauseTiming();
+        fix::small_bitset<block_type_t> bitset = random_bitset<fix::small_bitset<block_type_t>>(gen, bits_to_pop_back);
+        benchmark::ClobberMemory();
+        state.ResumeTiming();
+
+        // run
+        for(size_t i = 0; i < bits_to_pop_back; ++i)
+        {
+            bitset.pop_back();
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits_to_pop_back,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] = benchmark::Counter(
+      bits_to_pop_back, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+FIX_SMALL_BITSET_BENCHMARK_RANGE(fix_small_bitset_pop_back, "pop_back");
+
 #ifdef HAS_BOOST
 template<typename block_type_t>
 void boost_dynamic_bitset_pop_back(benchmark::State& state)
@@ -7,6 +7,9 @@
 //
 #include <config.hpp>
 
+#include <fix/aligned_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
 #include <benchmark/benchmark.h>
 #include <sul/dynamic_bitset.hpp>
 #ifdef HAS_BOOST
@@ -57,6 +60,78 @@ void sul_dynamic_bitset_push_back(benchmark::State& state)
 
 SUL_DYNAMIC_BITSET_BENCHMARK_RANGE(sul_dynamic_bitset_push_back, "push_back");
 
+template<typename block_type_t>
+void fix_aligned_bitset_push_back(benchmark::State& state)
+{
+    const size_t bits_to_push_back = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    std::bernoulli_distribution d;
+    std::vector<bool> values;
+    values.reserve(bits_to_push_back);
+    for(size_t i = 0; i < bits_to_push_back; ++i)
+    {
+        values.push_back(d(gen));
+    }
+
+    for(auto _: state)
+    {
+        // setup
+        fix::aligned_bitset<block_type_t> bitset;
+
+        // run
+        for(const bool value: values)
+        {
+            bitset.push_back(value);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits_to_push_back,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] = benchmark::Counter(
+      bits_to_push_back, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+FIX_ALIGNED_BITSET_BENCHMARK_RANGE(fix_aligned_bitset_push_back, "push_back");
+
+template<typename block_type_t>
+void fix_small_bitset_push_back(benchmark::State& state)
+{
+    const size_t bits_to_push_back = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    std::bernoulli_distribution d;
+    std::vector<bool> values;
+    values.reserve(bits_to_push_back);
+    for(size_t i = 0; i < bits_to_push_back; ++i)
+    {
+        values.push_back(d(gen));
+    }
+
+    for(auto _: state)
+    {
+        // setup
+        fix::small_bitset<block_type_t> bitset;
+
+        // run
+        for(const bool value: values)
+        {
+            bitset.push_back(value);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits_to_push_back,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] = benchmark::Counter(
+      bits_to_push_back, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+FIX_SMALL_BITSET_BENCHMARK_RANGE(fix_small_bitset_push_back, "push_back");
+
 #ifdef HAS_BOOST
 template<typename block_type_t>
 void boost_dynamic_bitset_push_back(benchmark::State& state)
@@ -0,0 +1,270 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+#include <utils.hpp>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/rank_select.hpp>
+#include <fix/small_bitset.hpp>
+
+#include <benchmark/benchmark.h>
+#include <sul/dynamic_bitset.hpp>
+#ifdef HAS_BOOST
+#    include <boost/dynamic_bitset.hpp>
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+#    include <tr2/dynamic_bitset>
+#endif
+
+#include <random>
+#include <vector>
+
+// fix::dynamic_bitset::rank_select build, queries and updates, against the linear scan with do_iterate_bits_on
+#define RANK_SELECT_BENCHMARK_RANGE(func, dynamic_bitset_type, name) \
+    BENCHMARK_TEMPLATE(func, dynamic_bitset_type) \
+      ->Name(#dynamic_bitset_type " " name) \
+      ->RangeMultiplier(RANGE_MULTIPLIER) \
+      ->Range(RANGE_START, RANGE_END)
+
+#define SUL_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(func, name) \
+    RANK_SELECT_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint16_t>, name); \
+    RANK_SELECT_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint32_t>, name); \
+    RANK_SELECT_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint64_t>, name)
+
+#define FIX_ALIGNED_BITSET_RANK_SELECT_BENCHMARK_RANGE(func, name) \
+    RANK_SELECT_BENCHMARK_RANGE(func, fix::aligned_bitset<uint16_t>, name); \
+    RANK_SELECT_BENCHMARK_RANGE(func, fix::aligned_bitset<uint32_t>, name); \
+    RANK_SELECT_BENCHMARK_RANGE(func, fix::aligned_bitset<uint64_t>, name)
+
+#define FIX_SMALL_BITSET_RANK_SELECT_BENCHMARK_RANGE(func, name) \
+    RANK_SELECT_BENCHMARK_RANGE(func, fix::small_bitset<uint16_t>, name); \
+    RANK_SELECT_BENCHMARK_RANGE(func, fix::small_bitset<uint32_t>, name); \
+    RANK_SELECT_BENCHMARK_RANGE(func, fix::small_bitset<uint64_t>, name)
+
+#define BOOST_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(func, name) \
+    RANK_SELECT_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint16_t>, name); \
+    RANK_SELECT_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint32_t>, name); \
+    RANK_SELECT_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint64_t>, name)
+
+#define STD_TR2_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(func, name) \
+    RANK_SELECT_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint16_t>, name); \
+    RANK_SELECT_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint32_t>, name); \
+    RANK_SELECT_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint64_t>, name)
+
+#define STD_VECTOR_BOOL_RANK_SELECT_BENCHMARK_RANGE(func, name) \
+    RANK_SELECT_BENCHMARK_RANGE(func, std::vector<bool>, name)
+
+// number of precomputed random query arguments
+static constexpr size_t QUERIES = 1u << 12u;
+
+static std::vector<size_t> random_queries(std::minstd_rand& gen, size_t max)
+{
+    std::uniform_int_distribution<size_t> dist(0, max);
+    std::vector<size_t> queries(QUERIES);
+    for(size_t& query: queries)
+    {
+        query = dist(gen);
+    }
+    return queries;
+}
+
+template<typename dynamic_bitset_t>
+void rank_select_build(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits);
+    fix::dynamic_bitset::rank_select<dynamic_bitset_t> index;
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        index.build(bitset);
+        benchmark::DoNotOptimize(index.count());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["1_bit_time"] =
+      benchmark::Counter(bits,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] =
+      benchmark::Counter(bits, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+template<typename dynamic_bitset_t>
+void rank_select_rank(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits);
+    const fix::dynamic_bitset::rank_select<dynamic_bitset_t> index(bitset);
+    const std::vector<size_t> queries = random_queries(gen, bits);
+    size_t query = 0;
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(index.rank(bitset, queries[query++ % QUERIES]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename dynamic_bitset_t>
+void rank_select_select(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits);
+    const fix::dynamic_bitset::rank_select<dynamic_bitset_t> index(bitset);
+    const std::vector<size_t> queries = random_queries(gen, index.count() - 1);
+    size_t query = 0;
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(index.select(bitset, queries[query++ % QUERIES]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename dynamic_bitset_t>
+void rank_select_update(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits);
+    fix::dynamic_bitset::rank_select<dynamic_bitset_t> index(bitset);
+    const std::vector<size_t> queries = random_queries(gen, bits - 1);
+    size_t query = 0;
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        // flip a bit and report it
+        const size_t pos = queries[query++ % QUERIES];
+        if(fix::dynamic_bitset::do_test(bitset, pos))
+        {
+            fix::dynamic_bitset::do_reset(bitset, pos);
+            index.bit_reset(pos);
+        }
+        else
+        {
+            fix::dynamic_bitset::do_set(bitset, pos);
+            index.bit_set(pos);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename dynamic_bitset_t>
+void linear_rank(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits);
+    const std::vector<size_t> queries = random_queries(gen, bits);
+    size_t query = 0;
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        const size_t pos = queries[query++ % QUERIES];
+        size_t rank = 0;
+        fix::dynamic_bitset::do_iterate_bits_on(bitset,
+                                                [&](size_t bit_on) noexcept
+                                                {
+                                                    if(bit_on >= pos)
+                                                    {
+                                                        return false;
+                                                    }
+                                                    ++rank;
+                                                    return true;
+                                                });
+        benchmark::DoNotOptimize(rank);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename dynamic_bitset_t>
+void linear_select(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits);
+    const std::vector<size_t> queries = random_queries(gen, fix::dynamic_bitset::do_count(bitset) - 1);
+    size_t query = 0;
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        const size_t k = queries[query++ % QUERIES];
+        size_t selected = 0;
+        size_t current = 0;
+        fix::dynamic_bitset::do_iterate_bits_on(bitset,
+                                                [&](size_t bit_on) noexcept
+                                                {
+                                                    if(current++ == k)
+                                                    {
+                                                        selected = bit_on;
+                                                        return false;
+                                                    }
+                                                    return true;
+                                                });
+        benchmark::DoNotOptimize(selected);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+SUL_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_build, "rank_select_build");
+SUL_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_rank, "rank_select_rank");
+SUL_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_select, "rank_select_select");
+SUL_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_update, "rank_select_update");
+SUL_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(linear_rank, "linear_rank");
+SUL_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(linear_select, "linear_select");
+FIX_ALIGNED_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_build, "rank_select_build");
+FIX_ALIGNED_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_rank, "rank_select_rank");
+FIX_ALIGNED_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_select, "rank_select_select");
+FIX_ALIGNED_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_update, "rank_select_update");
+FIX_ALIGNED_BITSET_RANK_SELECT_BENCHMARK_RANGE(linear_rank, "linear_rank");
+FIX_ALIGNED_BITSET_RANK_SELECT_BENCHMARK_RANGE(linear_select, "linear_select");
+FIX_SMALL_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_build, "rank_select_build");
+FIX_SMALL_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_rank, "rank_select_rank");
+FIX_SMALL_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_select, "rank_select_select");
+FIX_SMALL_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_update, "rank_select_update");
+FIX_SMALL_BITSET_RANK_SELECT_BENCHMARK_RANGE(linear_rank, "linear_rank");
+FIX_SMALL_BITSET_RANK_SELECT_BENCHMARK_RANGE(linear_select, "linear_select");
+#ifdef HAS_BOOST
+BOOST_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_build, "rank_select_build");
+BOOST_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_rank, "rank_select_rank");
+BOOST_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_select, "rank_select_select");
+BOOST_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_update, "rank_select_update");
+BOOST_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(linear_rank, "linear_rank");
+BOOST_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(linear_select, "linear_select");
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+STD_TR2_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_build, "rank_select_build");
+STD_TR2_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_rank, "rank_select_rank");
+STD_TR2_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_select, "rank_select_select");
+STD_TR2_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(rank_select_update, "rank_select_update");
+STD_TR2_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(linear_rank, "linear_rank");
+STD_TR2_DYNAMIC_BITSET_RANK_SELECT_BENCHMARK_RANGE(linear_select, "linear_select");
+#endif
+STD_VECTOR_BOOL_RANK_SELECT_BENCHMARK_RANGE(rank_select_build, "rank_select_build");
+STD_VECTOR_BOOL_RANK_SELECT_BENCHMARK_RANGE(rank_select_rank, "rank_select_rank");
+STD_VECTOR_BOOL_RANK_SELECT_BENCHMARK_RANGE(rank_select_select, "rank_select_select");
+STD_VECTOR_BOOL_RANK_SELECT_BENCHMARK_RANGE(rank_select_update, "rank_select_update");
+STD_VECTOR_BOOL_RANK_SELECT_BENCHMARK_RANGE(linear_rank, "linear_rank");
+STD_VECTOR_BOOL_RANK_SELECT_BENCHMARK_RANGE(linear_select, "linear_select");
@@ -0,0 +1,203 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+#include <utils.hpp>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
+#include <benchmark/benchmark.h>
+#include <sul/dynamic_bitset.hpp>
+#ifdef HAS_BOOST
+#    include <boost/dynamic_bitset.hpp>
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+#    include <tr2/dynamic_bitset>
+#endif
+
+#include <random>
+#include <vector>
+
+// multi-operand reductions against one binary operation per operand, for several numbers of operands
+#define REDUCE_BENCHMARK_RANGE(func, dynamic_bitset_type, name) \
+    BENCHMARK_TEMPLATE(func, dynamic_bitset_type) \
+      ->Name(#dynamic_bitset_type " " name) \
+      ->ArgNames({"bits", "operands"}) \
+      ->ArgsProduct({benchmark::CreateRange(RANGE_START, RANGE_END, RANGE_MULTIPLIER), {2, 10, 100, 1000}})
+
+#define SUL_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(func, name) \
+    REDUCE_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint16_t>, name); \
+    REDUCE_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint32_t>, name); \
+    REDUCE_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint64_t>, name)
+
+#define FIX_ALIGNED_BITSET_REDUCE_BENCHMARK_RANGE(func, name) \
+    REDUCE_BENCHMARK_RANGE(func, fix::aligned_bitset<uint16_t>, name); \
+    REDUCE_BENCHMARK_RANGE(func, fix::aligned_bitset<uint32_t>, name); \
+    REDUCE_BENCHMARK_RANGE(func, fix::aligned_bitset<uint64_t>, name)
+
+#define FIX_SMALL_BITSET_REDUCE_BENCHMARK_RANGE(func, name) \
+    REDUCE_BENCHMARK_RANGE(func, fix::small_bitset<uint16_t>, name); \
+    REDUCE_BENCHMARK_RANGE(func, fix::small_bitset<uint32_t>, name); \
+    REDUCE_BENCHMARK_RANGE(func, fix::small_bitset<uint64_t>, name)
+
+#define BOOST_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(func, name) \
+    REDUCE_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint16_t>, name); \
+    REDUCE_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint32_t>, name); \
+    REDUCE_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint64_t>, name)
+
+#define STD_TR2_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(func, name) \
+    REDUCE_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint16_t>, name); \
+    REDUCE_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint32_t>, name); \
+    REDUCE_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint64_t>, name)
+
+#define STD_VECTOR_BOOL_REDUCE_BENCHMARK_RANGE(func, name) REDUCE_BENCHMARK_RANGE(func, std::vector<bool>, name)
+
+// number of distinct random bitsets, the operands are copies of them to not share memory
+static constexpr size_t DISTINCT_OPERANDS = 8;
+
+template<typename dynamic_bitset_t>
+std::vector<dynamic_bitset_t> random_operands(std::minstd_rand& gen, size_t bits, size_t operands_number)
+{
+    std::vector<dynamic_bitset_t> distinct;
+    for(size_t i = 0; i < DISTINCT_OPERANDS; ++i)
+    {
+        // dense operands for the and reduction to not become empty after a few operands
+        distinct.push_back(random_bitset<dynamic_bitset_t>(gen, bits, 0.99));
+    }
+    std::vector<dynamic_bitset_t> operands;
+    operands.reserve(operands_number);
+    for(size_t i = 0; i < operands_number; ++i)
+    {
+        operands.push_back(distinct[i % DISTINCT_OPERANDS]);
+    }
+    return operands;
+}
+
+static void set_reduce_counters(benchmark::State& state, size_t bits, size_t operands_number)
+{
+    // bits of the operands processed
+    state.counters["1_bit_time"] =
+      benchmark::Counter(static_cast<double>(bits * operands_number),
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] = benchmark::Counter(static_cast<double>(bits * operands_number),
+                                                           benchmark::Counter::kIsIterationInvariantRate,
+                                                           benchmark::Counter::OneK::kIs1024);
+}
+
+template<typename dynamic_bitset_t>
+void or_reduce(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const size_t operands_number = static_cast<size_t>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const std::vector<dynamic_bitset_t> operands = random_operands<dynamic_bitset_t>(gen, bits, operands_number);
+    dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::do_or_reduce(bitset, operands);
+        benchmark::ClobberMemory();
+    }
+
+    set_reduce_counters(state, bits, operands_number);
+}
+
+template<typename dynamic_bitset_t>
+void or_equal_loop(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const size_t operands_number = static_cast<size_t>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const std::vector<dynamic_bitset_t> operands = random_operands<dynamic_bitset_t>(gen, bits, operands_number);
+    dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        for(const dynamic_bitset_t& operand: operands)
+        {
+            fix::dynamic_bitset::do_or_equal(bitset, operand);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    set_reduce_counters(state, bits, operands_number);
+}
+
+template<typename dynamic_bitset_t>
+void and_reduce(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const size_t operands_number = static_cast<size_t>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const std::vector<dynamic_bitset_t> operands = random_operands<dynamic_bitset_t>(gen, bits, operands_number);
+    dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::do_and_reduce(bitset, operands);
+        benchmark::ClobberMemory();
+    }
+
+    set_reduce_counters(state, bits, operands_number);
+}
+
+template<typename dynamic_bitset_t>
+void and_equal_loop(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const size_t operands_number = static_cast<size_t>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const std::vector<dynamic_bitset_t> operands = random_operands<dynamic_bitset_t>(gen, bits, operands_number);
+    dynamic_bitset_t bitset = random_bitset<dynamic_bitset_t>(gen, bits);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        for(const dynamic_bitset_t& operand: operands)
+        {
+            fix::dynamic_bitset::do_and_equal(bitset, operand);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    set_reduce_counters(state, bits, operands_number);
+}
+
+SUL_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(or_reduce, "or_reduce");
+SUL_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(or_equal_loop, "or_equal_loop");
+SUL_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(and_reduce, "and_reduce");
+SUL_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(and_equal_loop, "and_equal_loop");
+FIX_ALIGNED_BITSET_REDUCE_BENCHMARK_RANGE(or_reduce, "or_reduce");
+FIX_ALIGNED_BITSET_REDUCE_BENCHMARK_RANGE(or_equal_loop, "or_equal_loop");
+FIX_ALIGNED_BITSET_REDUCE_BENCHMARK_RANGE(and_reduce, "and_reduce");
+FIX_ALIGNED_BITSET_REDUCE_BENCHMARK_RANGE(and_equal_loop, "and_equal_loop");
+FIX_SMALL_BITSET_REDUCE_BENCHMARK_RANGE(or_reduce, "or_reduce");
+FIX_SMALL_BITSET_REDUCE_BENCHMARK_RANGE(or_equal_loop, "or_equal_loop");
+FIX_SMALL_BITSET_REDUCE_BENCHMARK_RANGE(and_reduce, "and_reduce");
+FIX_SMALL_BITSET_REDUCE_BENCHMARK_RANGE(and_equal_loop, "and_equal_loop");
+#ifdef HAS_BOOST
+BOOST_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(or_reduce, "or_reduce");
+BOOST_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(or_equal_loop, "or_equal_loop");
+BOOST_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(and_reduce, "and_reduce");
+BOOST_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(and_equal_loop, "and_equal_loop");
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+STD_TR2_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(or_reduce, "or_reduce");
+STD_TR2_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(or_equal_loop, "or_equal_loop");
+STD_TR2_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(and_reduce, "and_reduce");
+STD_TR2_DYNAMIC_BITSET_REDUCE_BENCHMARK_RANGE(and_equal_loop, "and_equal_loop");
+#endif
+STD_VECTOR_BOOL_REDUCE_BENCHMARK_RANGE(or_reduce, "or_reduce");
+STD_VECTOR_BOOL_REDUCE_BENCHMARK_RANGE(or_equal_loop, "or_equal_loop");
+STD_VECTOR_BOOL_REDUCE_BENCHMARK_RANGE(and_reduce, "and_reduce");
+STD_VECTOR_BOOL_REDUCE_BENCHMARK_RANGE(and_equal_loop, "and_equal_loop");
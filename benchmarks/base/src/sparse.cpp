@@ -0,0 +1,163 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+#include <utils.hpp>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
+#include <benchmark/benchmark.h>
+#include <sul/dynamic_bitset.hpp>
+#ifdef HAS_BOOST
+#    include <boost/dynamic_bitset.hpp>
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+#    include <tr2/dynamic_bitset>
+#endif
+
+#include <random>
+#include <span>
+#include <vector>
+
+// dense operand (sparse:0) and positions of the bits on (sparse:1) of a random operand with one bit on in
+// density_inverse, to find the density under which the sparse adapters are worth it
+#define SPARSE_BENCHMARK_RANGE(func, dynamic_bitset_type, name) \
+    BENCHMARK_TEMPLATE(func, dynamic_bitset_type) \
+      ->Name(#dynamic_bitset_type " " name) \
+      ->ArgNames({"bits", "density_inverse", "sparse"}) \
+      ->ArgsProduct({benchmark::CreateRange(SPARSE_RANGE_START, SPARSE_RANGE_END, RANGE_MULTIPLIER), \
+                     {2, 8, 32, 128, 512, 2048}, \
+                     {0, 1}}) \
+      ->Unit(benchmark::kNanosecond)
+
+#define SUL_DYNAMIC_BITSET_SPARSE_BENCHMARK_RANGE(func, name) \
+    SPARSE_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint16_t>, name); \
+    SPARSE_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint32_t>, name); \
+    SPARSE_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint64_t>, name)
+
+#define FIX_ALIGNED_BITSET_SPARSE_BENCHMARK_RANGE(func, name) \
+    SPARSE_BENCHMARK_RANGE(func, fix::aligned_bitset<uint16_t>, name); \
+    SPARSE_BENCHMARK_RANGE(func, fix::aligned_bitset<uint32_t>, name); \
+    SPARSE_BENCHMARK_RANGE(func, fix::aligned_bitset<uint64_t>, name)
+
+#define FIX_SMALL_BITSET_SPARSE_BENCHMARK_RANGE(func, name) \
+    SPARSE_BENCHMARK_RANGE(func, fix::small_bitset<uint16_t>, name); \
+    SPARSE_BENCHMARK_RANGE(func, fix::small_bitset<uint32_t>, name); \
+    SPARSE_BENCHMARK_RANGE(func, fix::small_bitset<uint64_t>, name)
+
+#define BOOST_DYNAMIC_BITSET_SPARSE_BENCHMARK_RANGE(func, name) \
+    SPARSE_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint16_t>, name); \
+    SPARSE_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint32_t>, name); \
+    SPARSE_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint64_t>, name)
+
+#define STD_TR2_DYNAMIC_BITSET_SPARSE_BENCHMARK_RANGE(func, name) \
+    SPARSE_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint16_t>, name); \
+    SPARSE_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint32_t>, name); \
+    SPARSE_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint64_t>, name)
+
+#define STD_VECTOR_BOOL_SPARSE_BENCHMARK_RANGE(func, name) SPARSE_BENCHMARK_RANGE(func, std::vector<bool>, name)
+
+static void set_sparse_counters(benchmark::State& state, size_t bits)
+{
+    state.counters["1_bit_time"] =
+      benchmark::Counter(static_cast<double>(bits),
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] = benchmark::Counter(
+      static_cast<double>(bits), benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+template<typename dynamic_bitset_t>
+std::vector<size_t> bits_on(const dynamic_bitset_t& bitset)
+{
+    std::vector<size_t> indices;
+    fix::dynamic_bitset::do_iterate_bits_on(bitset, [&](size_t bit_pos) { indices.push_back(bit_pos); });
+    return indices;
+}
+
+template<typename dynamic_bitset_t>
+void sparse_or_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const double density = 1.0 / static_cast<double>(state.range(1));
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset1 = random_bitset<dynamic_bitset_t>(gen, bits);
+    const dynamic_bitset_t bitset2 = random_bitset<dynamic_bitset_t>(gen, bits, density);
+    const std::vector<size_t> indices2 = bits_on(bitset2);
+    benchmark::ClobberMemory();
+
+    if(state.range(2) != 0)
+    {
+        for(auto _: state)
+        {
+            fix::dynamic_bitset::do_sparse_or_equal(bitset1, std::span<const size_t>(indices2));
+            benchmark::ClobberMemory();
+        }
+    }
+    else
+    {
+        for(auto _: state)
+        {
+            fix::dynamic_bitset::do_or_equal(bitset1, bitset2);
+            benchmark::ClobberMemory();
+        }
+    }
+
+    set_sparse_counters(state, bits);
+}
+
+template<typename dynamic_bitset_t>
+void sparse_andnot_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const double density = 1.0 / static_cast<double>(state.range(1));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset1 = random_bitset<dynamic_bitset_t>(gen, bits, density);
+    const dynamic_bitset_t bitset2 = random_bitset<dynamic_bitset_t>(gen, bits);
+    const std::vector<size_t> indices1 = bits_on(bitset1);
+    benchmark::ClobberMemory();
+
+    if(state.range(2) != 0)
+    {
+        for(auto _: state)
+        {
+            benchmark::DoNotOptimize(
+              fix::dynamic_bitset::do_sparse_andnot_count(std::span<const size_t>(indices1), bitset2));
+        }
+    }
+    else
+    {
+        for(auto _: state)
+        {
+            benchmark::DoNotOptimize(fix::dynamic_bitset::do_andnot_count(bitset1, bitset2));
+        }
+    }
+
+    set_sparse_counters(state, bits);
+}
+
+SUL_DYNAMIC_BITSET_SPARSE_BENCHMARK_RANGE(sparse_or_equal, "sparse_or_equal");
+SUL_DYNAMIC_BITSET_SPARSE_BENCHMARK_RANGE(sparse_andnot_count, "sparse_andnot_count");
+FIX_ALIGNED_BITSET_SPARSE_BENCHMARK_RANGE(sparse_or_equal, "sparse_or_equal");
+FIX_ALIGNED_BITSET_SPARSE_BENCHMARK_RANGE(sparse_andnot_count, "sparse_andnot_count");
+FIX_SMALL_BITSET_SPARSE_BENCHMARK_RANGE(sparse_or_equal, "sparse_or_equal");
+FIX_SMALL_BITSET_SPARSE_BENCHMARK_RANGE(sparse_andnot_count, "sparse_andnot_count");
+
+#ifdef HAS_BOOST
+BOOST_DYNAMIC_BITSET_SPARSE_BENCHMARK_RANGE(sparse_or_equal, "sparse_or_equal");
+BOOST_DYNAMIC_BITSET_SPARSE_BENCHMARK_RANGE(sparse_andnot_count, "sparse_andnot_count");
+#endif
+
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+STD_TR2_DYNAMIC_BITSET_SPARSE_BENCHMARK_RANGE(sparse_or_equal, "sparse_or_equal");
+STD_TR2_DYNAMIC_BITSET_SPARSE_BENCHMARK_RANGE(sparse_andnot_count, "sparse_andnot_count");
+#endif
+
+STD_VECTOR_BOOL_SPARSE_BENCHMARK_RANGE(sparse_or_equal, "sparse_or_equal");
+STD_VECTOR_BOOL_SPARSE_BENCHMARK_RANGE(sparse_andnot_count, "sparse_andnot_count");
@@ -0,0 +1,143 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+#include <utils.hpp>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/small_bitset.hpp>
+#include <fix/streaming.hpp>
+
+#include <benchmark/benchmark.h>
+#include <sul/dynamic_bitset.hpp>
+#ifdef HAS_BOOST
+#    include <boost/dynamic_bitset.hpp>
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+#    include <tr2/dynamic_bitset>
+#endif
+
+#include <limits>
+#include <random>
+#include <vector>
+
+// streaming adapters with regular stores (streaming:0) and non-temporal stores (streaming:1) on each size, to find the
+// size from which the non-temporal stores are worth it
+// the stores do not depend on the block type, only 64 bits blocks are benchmarked
+#define STREAMING_BENCHMARK_RANGE(func, dynamic_bitset_type, name) \
+    BENCHMARK_TEMPLATE(func, dynamic_bitset_type) \
+      ->Name(#dynamic_bitset_type " " name) \
+      ->ArgNames({"bits", "streaming"}) \
+      ->ArgsProduct({benchmark::CreateRange(STREAMING_RANGE_START, STREAMING_RANGE_END, RANGE_MULTIPLIER), {0, 1}}) \
+      ->Unit(benchmark::kMicrosecond)
+
+#define SUL_DYNAMIC_BITSET_STREAMING_BENCHMARK_RANGE(func, name) \
+    STREAMING_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint64_t>, name)
+
+#define FIX_ALIGNED_BITSET_STREAMING_BENCHMARK_RANGE(func, name) \
+    STREAMING_BENCHMARK_RANGE(func, fix::aligned_bitset<uint64_t>, name)
+
+#define FIX_SMALL_BITSET_STREAMING_BENCHMARK_RANGE(func, name) \
+    STREAMING_BENCHMARK_RANGE(func, fix::small_bitset<uint64_t>, name)
+
+#define BOOST_DYNAMIC_BITSET_STREAMING_BENCHMARK_RANGE(func, name) \
+    STREAMING_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint64_t>, name)
+
+#define STD_TR2_DYNAMIC_BITSET_STREAMING_BENCHMARK_RANGE(func, name) \
+    STREAMING_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint64_t>, name)
+
+#define STD_VECTOR_BOOL_STREAMING_BENCHMARK_RANGE(func, name) STREAMING_BENCHMARK_RANGE(func, std::vector<bool>, name)
+
+// threshold of the streaming adapters for the streaming argument, restored at the end of the benchmark
+class streaming_threshold final
+{
+public:
+    explicit streaming_threshold(const benchmark::State& state) noexcept
+      : m_previous(fix::dynamic_bitset::streaming::threshold())
+    {
+        fix::dynamic_bitset::streaming::set_threshold(state.range(1) != 0 ? 0 : std::numeric_limits<size_t>::max());
+    }
+
+    streaming_threshold(const streaming_threshold&) = delete;
+    streaming_threshold& operator=(const streaming_threshold&) = delete;
+
+    ~streaming_threshold() noexcept
+    {
+        fix::dynamic_bitset::streaming::set_threshold(m_previous);
+    }
+
+private:
+    size_t m_previous;
+};
+
+static void set_streaming_counters(benchmark::State& state, size_t bits)
+{
+    state.counters["1_bit_time"] =
+      benchmark::Counter(static_cast<double>(bits),
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] = benchmark::Counter(
+      static_cast<double>(bits), benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+// bitset.clear() of the backends releases the bits, clearing the bits of a bitset is do_reset
+template<typename dynamic_bitset_t>
+void streaming_reset(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const streaming_threshold threshold(state);
+    dynamic_bitset_t bitset(bits);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::streaming::do_reset(bitset);
+        benchmark::ClobberMemory();
+    }
+
+    set_streaming_counters(state, bits);
+}
+
+template<typename dynamic_bitset_t>
+void streaming_or_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const streaming_threshold threshold(state);
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset1 = random_bitset<dynamic_bitset_t>(gen, bits);
+    const dynamic_bitset_t bitset2 = random_bitset<dynamic_bitset_t>(gen, bits);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        fix::dynamic_bitset::streaming::do_or_equal(bitset1, bitset2);
+        benchmark::ClobberMemory();
+    }
+
+    set_streaming_counters(state, bits);
+}
+
+SUL_DYNAMIC_BITSET_STREAMING_BENCHMARK_RANGE(streaming_reset, "streaming_reset");
+SUL_DYNAMIC_BITSET_STREAMING_BENCHMARK_RANGE(streaming_or_equal, "streaming_or_equal");
+FIX_ALIGNED_BITSET_STREAMING_BENCHMARK_RANGE(streaming_reset, "streaming_reset");
+FIX_ALIGNED_BITSET_STREAMING_BENCHMARK_RANGE(streaming_or_equal, "streaming_or_equal");
+FIX_SMALL_BITSET_STREAMING_BENCHMARK_RANGE(streaming_reset, "streaming_reset");
+FIX_SMALL_BITSET_STREAMING_BENCHMARK_RANGE(streaming_or_equal, "streaming_or_equal");
+
+#ifdef HAS_BOOST
+BOOST_DYNAMIC_BITSET_STREAMING_BENCHMARK_RANGE(streaming_reset, "streaming_reset");
+BOOST_DYNAMIC_BITSET_STREAMING_BENCHMARK_RANGE(streaming_or_equal, "streaming_or_equal");
+#endif
+
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+STD_TR2_DYNAMIC_BITSET_STREAMING_BENCHMARK_RANGE(streaming_reset, "streaming_reset");
+STD_TR2_DYNAMIC_BITSET_STREAMING_BENCHMARK_RANGE(streaming_or_equal, "streaming_or_equal");
+#endif
+
+STD_VECTOR_BOOL_STREAMING_BENCHMARK_RANGE(streaming_reset, "streaming_reset");
+STD_VECTOR_BOOL_STREAMING_BENCHMARK_RANGE(streaming_or_equal, "streaming_or_equal");
@@ -0,0 +1,143 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+#include <utils.hpp>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/small_bitset.hpp>
+#include <fix/transpose.hpp>
+
+#include <benchmark/benchmark.h>
+#include <sul/dynamic_bitset.hpp>
+#ifdef HAS_BOOST
+#    include <boost/dynamic_bitset.hpp>
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+#    include <tr2/dynamic_bitset>
+#endif
+
+#include <array>
+#include <random>
+#include <span>
+#include <vector>
+
+// indices of the rows with each column on for a matrix of rows bitsets of columns bits, one bit on in 32 like the
+// set cover instances: one push_back per bit on of each row (transpose:0) or 64x64 tiles transposes (transpose:1)
+#define TRANSPOSE_BENCHMARK_RANGE(func, dynamic_bitset_type, name) \
+    BENCHMARK_TEMPLATE(func, dynamic_bitset_type) \
+      ->Name(#dynamic_bitset_type " " name) \
+      ->ArgNames({"columns", "rows", "transpose"}) \
+      ->ArgsProduct({benchmark::CreateRange(TRANSPOSE_RANGE_START, TRANSPOSE_RANGE_END, RANGE_MULTIPLIER * 8), \
+                     {64, 512}, \
+                     {0, 1}}) \
+      ->Unit(benchmark::kMillisecond)
+
+#define SUL_DYNAMIC_BITSET_TRANSPOSE_BENCHMARK_RANGE(func, name) \
+    TRANSPOSE_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint16_t>, name); \
+    TRANSPOSE_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint32_t>, name); \
+    TRANSPOSE_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint64_t>, name)
+
+#define FIX_ALIGNED_BITSET_TRANSPOSE_BENCHMARK_RANGE(func, name) \
+    TRANSPOSE_BENCHMARK_RANGE(func, fix::aligned_bitset<uint16_t>, name); \
+    TRANSPOSE_BENCHMARK_RANGE(func, fix::aligned_bitset<uint32_t>, name); \
+    TRANSPOSE_BENCHMARK_RANGE(func, fix::aligned_bitset<uint64_t>, name)
+
+#define FIX_SMALL_BITSET_TRANSPOSE_BENCHMARK_RANGE(func, name) \
+    TRANSPOSE_BENCHMARK_RANGE(func, fix::small_bitset<uint16_t>, name); \
+    TRANSPOSE_BENCHMARK_RANGE(func, fix::small_bitset<uint32_t>, name); \
+    TRANSPOSE_BENCHMARK_RANGE(func, fix::small_bitset<uint64_t>, name)
+
+#define BOOST_DYNAMIC_BITSET_TRANSPOSE_BENCHMARK_RANGE(func, name) \
+    TRANSPOSE_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint16_t>, name); \
+    TRANSPOSE_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint32_t>, name); \
+    TRANSPOSE_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint64_t>, name)
+
+#define STD_TR2_DYNAMIC_BITSET_TRANSPOSE_BENCHMARK_RANGE(func, name) \
+    TRANSPOSE_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint16_t>, name); \
+    TRANSPOSE_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint32_t>, name); \
+    TRANSPOSE_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint64_t>, name)
+
+#define STD_VECTOR_BOOL_TRANSPOSE_BENCHMARK_RANGE(func, name) TRANSPOSE_BENCHMARK_RANGE(func, std::vector<bool>, name)
+
+static void set_transpose_counters(benchmark::State& state, size_t bits)
+{
+    state.counters["1_bit_time"] =
+      benchmark::Counter(static_cast<double>(bits),
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] = benchmark::Counter(
+      static_cast<double>(bits), benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+template<typename dynamic_bitset_t>
+std::vector<std::vector<size_t>> scatter_bits_on(std::span<const dynamic_bitset_t> rows, size_t columns)
+{
+    std::vector<std::vector<size_t>> result(columns);
+    std::array<size_t, 256> bits_on_buffer;
+    for(size_t i = 0; i < rows.size(); ++i)
+    {
+        fix::dynamic_bitset::do_iterate_bits_on_batched(rows[i],
+                                                        bits_on_buffer,
+                                                        [&](std::span<const size_t> bits_on) noexcept
+                                                        {
+                                                            for(const size_t bit_on: bits_on)
+                                                            {
+                                                                result[bit_on].push_back(i);
+                                                            }
+                                                        });
+    }
+    return result;
+}
+
+template<typename dynamic_bitset_t>
+void transpose_bits_on(benchmark::State& state)
+{
+    const size_t columns = static_cast<size_t>(state.range(0));
+    const size_t rows_number = static_cast<size_t>(state.range(1));
+    std::minstd_rand gen(SEED);
+    std::vector<dynamic_bitset_t> rows;
+    rows.reserve(rows_number);
+    for(size_t i = 0; i < rows_number; ++i)
+    {
+        rows.push_back(random_bitset<dynamic_bitset_t>(gen, columns, 1.0 / 32));
+    }
+    const std::span<const dynamic_bitset_t> matrix(rows);
+    benchmark::ClobberMemory();
+
+    if(state.range(2) != 0)
+    {
+        for(auto _: state)
+        {
+            benchmark::DoNotOptimize(fix::dynamic_bitset::transpose_bits_on(matrix, columns));
+        }
+    }
+    else
+    {
+        for(auto _: state)
+        {
+            benchmark::DoNotOptimize(scatter_bits_on(matrix, columns));
+        }
+    }
+
+    set_transpose_counters(state, columns * rows_number);
+}
+
+SUL_DYNAMIC_BITSET_TRANSPOSE_BENCHMARK_RANGE(transpose_bits_on, "transpose_bits_on");
+FIX_ALIGNED_BITSET_TRANSPOSE_BENCHMARK_RANGE(transpose_bits_on, "transpose_bits_on");
+FIX_SMALL_BITSET_TRANSPOSE_BENCHMARK_RANGE(transpose_bits_on, "transpose_bits_on");
+
+#ifdef HAS_BOOST
+BOOST_DYNAMIC_BITSET_TRANSPOSE_BENCHMARK_RANGE(transpose_bits_on, "transpose_bits_on");
+#endif
+
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+STD_TR2_DYNAMIC_BITSET_TRANSPOSE_BENCHMARK_RANGE(transpose_bits_on, "transpose_bits_on");
+#endif
+
+STD_VECTOR_BOOL_TRANSPOSE_BENCHMARK_RANGE(transpose_bits_on, "transpose_bits_on");
@@ -0,0 +1,137 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <config.hpp>
+#include <utils.hpp>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/small_bitset.hpp>
+#include <fix/view.hpp>
+
+#include <benchmark/benchmark.h>
+#include <sul/dynamic_bitset.hpp>
+#ifdef HAS_BOOST
+#    include <boost/dynamic_bitset.hpp>
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+#    include <tr2/dynamic_bitset>
+#endif
+
+#include <random>
+#include <vector>
+
+// operations on views of bits [lhs_first, lhs_first + bits) and [rhs_first, rhs_first + bits) of two bitsets
+// - lhs_first:0 rhs_first:0, aligned: kernels on all blocks
+// - lhs_first:3 rhs_first:3, same offset in the first block: head block then kernels on the other blocks
+// - lhs_first:0 rhs_first:3 and lhs_first:3 rhs_first:0, unaligned: the operand blocks are shifted one at a time
+#define VIEW_BENCHMARK_RANGE(func, dynamic_bitset_type, name) \
+    BENCHMARK_TEMPLATE(func, dynamic_bitset_type) \
+      ->Name(#dynamic_bitset_type " " name) \
+      ->ArgNames({"bits", "lhs_first", "rhs_first"}) \
+      ->ArgsProduct({benchmark::CreateRange(RANGE_START, RANGE_END, RANGE_MULTIPLIER), {0, 3}, {0, 3}})
+
+#define SUL_DYNAMIC_BITSET_VIEW_BENCHMARK_RANGE(func, name) \
+    VIEW_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint16_t>, name); \
+    VIEW_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint32_t>, name); \
+    VIEW_BENCHMARK_RANGE(func, sul::dynamic_bitset<uint64_t>, name)
+
+#define FIX_ALIGNED_BITSET_VIEW_BENCHMARK_RANGE(func, name) \
+    VIEW_BENCHMARK_RANGE(func, fix::aligned_bitset<uint16_t>, name); \
+    VIEW_BENCHMARK_RANGE(func, fix::aligned_bitset<uint32_t>, name); \
+    VIEW_BENCHMARK_RANGE(func, fix::aligned_bitset<uint64_t>, name)
+
+#define FIX_SMALL_BITSET_VIEW_BENCHMARK_RANGE(func, name) \
+    VIEW_BENCHMARK_RANGE(func, fix::small_bitset<uint16_t>, name); \
+    VIEW_BENCHMARK_RANGE(func, fix::small_bitset<uint32_t>, name); \
+    VIEW_BENCHMARK_RANGE(func, fix::small_bitset<uint64_t>, name)
+
+#define BOOST_DYNAMIC_BITSET_VIEW_BENCHMARK_RANGE(func, name) \
+    VIEW_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint16_t>, name); \
+    VIEW_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint32_t>, name); \
+    VIEW_BENCHMARK_RANGE(func, boost::dynamic_bitset<uint64_t>, name)
+
+#define STD_TR2_DYNAMIC_BITSET_VIEW_BENCHMARK_RANGE(func, name) \
+    VIEW_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint16_t>, name); \
+    VIEW_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint32_t>, name); \
+    VIEW_BENCHMARK_RANGE(func, std::tr2::dynamic_bitset<uint64_t>, name)
+
+#define STD_VECTOR_BOOL_VIEW_BENCHMARK_RANGE(func, name) VIEW_BENCHMARK_RANGE(func, std::vector<bool>, name)
+
+static void set_view_counters(benchmark::State& state, size_t bits)
+{
+    state.counters["1_bit_time"] =
+      benchmark::Counter(static_cast<double>(bits),
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["bits_per_second"] = benchmark::Counter(
+      static_cast<double>(bits), benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+template<typename dynamic_bitset_t>
+void view_or_equal(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const size_t lhs_first = static_cast<size_t>(state.range(1));
+    const size_t rhs_first = static_cast<size_t>(state.range(2));
+    std::minstd_rand gen(SEED);
+    dynamic_bitset_t bitset1 = random_bitset<dynamic_bitset_t>(gen, lhs_first + bits);
+    const dynamic_bitset_t bitset2 = random_bitset<dynamic_bitset_t>(gen, rhs_first + bits);
+    const auto view1 = fix::dynamic_bitset::make_view(bitset1, lhs_first, bits);
+    const auto view2 = fix::dynamic_bitset::make_view(bitset2, rhs_first, bits);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        view1.or_equal(view2);
+        benchmark::ClobberMemory();
+    }
+
+    set_view_counters(state, bits);
+}
+
+template<typename dynamic_bitset_t>
+void view_andnot_count(benchmark::State& state)
+{
+    const size_t bits = static_cast<size_t>(state.range(0));
+    const size_t lhs_first = static_cast<size_t>(state.range(1));
+    const size_t rhs_first = static_cast<size_t>(state.range(2));
+    std::minstd_rand gen(SEED);
+    const dynamic_bitset_t bitset1 = random_bitset<dynamic_bitset_t>(gen, lhs_first + bits);
+    const dynamic_bitset_t bitset2 = random_bitset<dynamic_bitset_t>(gen, rhs_first + bits);
+    const auto view1 = fix::dynamic_bitset::make_view(bitset1, lhs_first, bits);
+    const auto view2 = fix::dynamic_bitset::make_view(bitset2, rhs_first, bits);
+    benchmark::ClobberMemory();
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(view1.andnot_count(view2));
+        benchmark::ClobberMemory();
+    }
+
+    set_view_counters(state, bits);
+}
+
+SUL_DYNAMIC_BITSET_VIEW_BENCHMARK_RANGE(view_or_equal, "view_or_equal");
+SUL_DYNAMIC_BITSET_VIEW_BENCHMARK_RANGE(view_andnot_count, "view_andnot_count");
+FIX_ALIGNED_BITSET_VIEW_BENCHMARK_RANGE(view_or_equal, "view_or_equal");
+FIX_ALIGNED_BITSET_VIEW_BENCHMARK_RANGE(view_andnot_count, "view_andnot_count");
+FIX_SMALL_BITSET_VIEW_BENCHMARK_RANGE(view_or_equal, "view_or_equal");
+FIX_SMALL_BITSET_VIEW_BENCHMARK_RANGE(view_andnot_count, "view_andnot_count");
+
+#ifdef HAS_BOOST
+BOOST_DYNAMIC_BITSET_VIEW_BENCHMARK_RANGE(view_or_equal, "view_or_equal");
+BOOST_DYNAMIC_BITSET_VIEW_BENCHMARK_RANGE(view_andnot_count, "view_andnot_count");
+#endif
+
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+STD_TR2_DYNAMIC_BITSET_VIEW_BENCHMARK_RANGE(view_or_equal, "view_or_equal");
+STD_TR2_DYNAMIC_BITSET_VIEW_BENCHMARK_RANGE(view_andnot_count, "view_andnot_count");
+#endif
+
+STD_VECTOR_BOOL_VIEW_BENCHMARK_RANGE(view_or_equal, "view_or_equal");
+STD_VECTOR_BOOL_VIEW_BENCHMARK_RANGE(view_andnot_count, "view_andnot_count");
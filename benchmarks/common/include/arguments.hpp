@@ -0,0 +1,46 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+// value of the --name=value argument, removed from the arguments, empty if absent
+// called before benchmark::Initialize(), which rejects the arguments it does not know
+inline std::string extract_argument(int& argc, char** argv, std::string_view name)
+{
+    const std::string prefix = std::string(name) + "=";
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string_view argument(argv[i]);
+        if(argument.starts_with(prefix))
+        {
+            std::string value(argument.substr(prefix.size()));
+            std::copy(argv + i + 1, argv + argc, argv + i);
+            --argc;
+            return value;
+        }
+    }
+    return {};
+}
+
+// value of the --name=value argument, kept in the arguments, empty if absent
+inline std::string find_argument(int argc, char** argv, std::string_view name)
+{
+    const std::string prefix = std::string(name) + "=";
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string_view argument(argv[i]);
+        if(argument.starts_with(prefix))
+        {
+            return std::string(argument.substr(prefix.size()));
+        }
+    }
+    return {};
+}
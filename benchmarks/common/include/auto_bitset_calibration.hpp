@@ -0,0 +1,37 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/auto_bitset.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// load the calibration table of fix::auto_bitset written by the calibration mode of dynamic_bitset_benchmarks_base,
+// before the benchmarks construct their bitsets, and record it in the benchmarks context
+inline bool load_auto_bitset_calibration(const std::string& calibration_path)
+{
+    std::ifstream calibration_file(calibration_path);
+    if(!calibration_file)
+    {
+        std::cerr << "failed to open fix::auto_bitset calibration: " << calibration_path << '\n';
+        return false;
+    }
+    if(!fix::auto_bitset_default_calibration().load(calibration_file))
+    {
+        std::cerr << "invalid fix::auto_bitset calibration: " << calibration_path << '\n';
+        return false;
+    }
+    std::cerr << "fix::auto_bitset calibration loaded from: " << calibration_path << ", "
+              << fix::auto_bitset_default_calibration().entries().size() << " entries\n";
+    benchmark::AddCustomContext("auto_bitset_calibration", calibration_path);
+    return true;
+}
@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/census.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Reporter adding the census of the fix adapters of each benchmark as user counters, for each operation called: its
+// share of the adapters calls and cycles, its average bits and cycles per call.
+// The display reporter takes the census of a benchmark on its first report, google benchmark reports to it before the
+// file reporter which adds the same census. The census is reset after being taken, it also covers the iterations
+// estimation runs and the setup code of the benchmark so absolute numbers are not reported.
+class census_reporter final : public benchmark::BenchmarkReporter
+{
+public:
+    // display reporter, taking the census
+    explicit census_reporter(benchmark::BenchmarkReporter* reporter) noexcept
+      : m_reporter(reporter)
+      , m_census_source(this)
+    {
+    }
+
+    // file reporter, adding the census taken by the display reporter
+    census_reporter(benchmark::BenchmarkReporter* reporter, const census_reporter& display_reporter) noexcept
+      : m_reporter(reporter)
+      , m_census_source(&display_reporter)
+    {
+    }
+
+    census_reporter(const census_reporter&) = delete;
+    census_reporter& operator=(const census_reporter&) = delete;
+
+    bool ReportContext(const Context& context) override
+    {
+        m_reporter->SetOutputStream(&GetOutputStream());
+        m_reporter->SetErrorStream(&GetErrorStream());
+        if(m_census_source == this)
+        {
+            fix::dynamic_bitset::census::reset();
+        }
+        return m_reporter->ReportContext(context);
+    }
+
+    void ReportRuns(const std::vector<Run>& runs) override
+    {
+        if(runs.empty())
+        {
+            m_reporter->ReportRuns(runs);
+            return;
+        }
+
+        // reports of the same benchmark (runs and aggregates) share its census
+        const std::string benchmark_name = runs.front().run_name.str();
+        if(m_census_source == this && benchmark_name != m_census_benchmark_name)
+        {
+            m_census = fix::dynamic_bitset::census::counters();
+            m_census_benchmark_name = benchmark_name;
+            fix::dynamic_bitset::census::reset();
+        }
+        if(benchmark_name != m_census_source->m_census_benchmark_name)
+        {
+            m_reporter->ReportRuns(runs);
+            return;
+        }
+        const fix::dynamic_bitset::census::census_counters& census = m_census_source->m_census;
+
+        uint64_t total_calls = 0;
+        uint64_t total_cycles = 0;
+        for(const fix::dynamic_bitset::census::operation_counters& counters: census)
+        {
+            total_calls += counters.calls;
+            total_cycles += counters.cycles;
+        }
+
+        std::vector<Run> census_runs = runs;
+        for(Run& run: census_runs)
+        {
+            if(total_calls == 0 || run.run_type == Run::RT_Aggregate)
+            {
+                continue;
+            }
+            for(size_t i = 0; i < census.size(); ++i)
+            {
+                const fix::dynamic_bitset::census::operation_counters& counters = census[i];
+                if(counters.calls == 0)
+                {
+                    continue;
+                }
+                const std::string name(
+                  fix::dynamic_bitset::census::operation_name(static_cast<fix::dynamic_bitset::census::operation>(i)));
+                const auto calls = static_cast<double>(counters.calls);
+                run.counters[name + "_calls_share"] = calls / static_cast<double>(total_calls);
+                run.counters[name + "_cycles_share"] =
+                  total_cycles == 0 ? 0.0 : static_cast<double>(counters.cycles) / static_cast<double>(total_cycles);
+                run.counters[name + "_bits_per_call"] = static_cast<double>(counters.bits) / calls;
+                run.counters[name + "_cycles_per_call"] = static_cast<double>(counters.cycles) / calls;
+            }
+        }
+        m_reporter->ReportRuns(census_runs);
+    }
+
+    void Finalize() override
+    {
+        m_reporter->Finalize();
+    }
+
+private:
+    std::unique_ptr<benchmark::BenchmarkReporter> m_reporter;
+    const census_reporter* m_census_source;
+    fix::dynamic_bitset::census::census_counters m_census{};
+    std::string m_census_benchmark_name;
+};
+
+// Runs the benchmarks with the census reporters, benchmark_out and benchmark_out_format are the values of the
+// --benchmark_out and --benchmark_out_format arguments, read before benchmark::Initialize() removes them: google
+// benchmark does not expose the file reporter it makes for them. The csv format is deprecated, the census is not added
+// to its file.
+inline void run_census_benchmarks(const std::string& benchmark_out, const std::string& benchmark_out_format)
+{
+    census_reporter display_reporter(benchmark::CreateDefaultDisplayReporter());
+    std::unique_ptr<census_reporter> file_reporter;
+    if(!benchmark_out.empty())
+    {
+        if(benchmark_out_format.empty() || benchmark_out_format == "json")
+        {
+            file_reporter = std::make_unique<census_reporter>(new benchmark::JSONReporter(), display_reporter);
+        }
+        else if(benchmark_out_format == "console")
+        {
+            file_reporter = std::make_unique<census_reporter>(
+              new benchmark::ConsoleReporter(benchmark::ConsoleReporter::OO_None), display_reporter);
+        }
+    }
+    benchmark::RunSpecifiedBenchmarks(&display_reporter, file_reporter.get());
+}
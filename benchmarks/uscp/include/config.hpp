@@ -7,13 +7,32 @@
 //
 #pragma once
 
+#include <cstddef>
 #include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 const std::minstd_rand::result_type SEED = std::random_device{}();
 static constexpr size_t RANGE_START = 64ull;
 static constexpr size_t RANGE_END = 1ull << 20u;
 static constexpr size_t RANGE_MULTIPLIER = 1ull << 2u;
 
+// size buckets of the std::bitset benchmarks, from scpcyc06 (240 points, 192 subsets) to scpcyc11 (28160 points,
+// 11264 subsets), the instance is loaded in the smallest one holding its points and its subsets
+using std_bitset_buckets = std::index_sequence<256, 512, 1024, 2048, 4096, 8192, 16384, 32768>;
+
+// call function(std::integral_constant<size_t, bits>()) for the smallest bucket of at least instance_bits bits,
+// return false if the instance is larger than all buckets
+template<typename Function>
+bool visit_std_bitset_bucket(size_t instance_bits, Function&& function)
+{
+    return [&]<size_t... buckets>(std::index_sequence<buckets...>)
+    {
+        return ((instance_bits <= buckets && (function(std::integral_constant<size_t, buckets>()), true)) || ...);
+    }(std_bitset_buckets());
+}
+
 // sul::dynamic_bitset benchmark
 #define SUL_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE(func, block_type, name) \
     benchmark::RegisterBenchmark("sul::dynamic_bitset<" #block_type "> " name, func<block_type>);
@@ -33,6 +52,16 @@ static constexpr size_t RANGE_MULTIPLIER = 1ull << 2u;
     SUL_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_RANGE(func, uint32_t, name); \
     SUL_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_RANGE(func, uint64_t, name)
 
+#define SUL_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, block_type, name, switch_name) \
+    benchmark::RegisterBenchmark("sul::dynamic_bitset<" #block_type "> " name, func<block_type>) \
+      ->ArgName(switch_name) \
+      ->DenseRange(0, 1)
+
+#define SUL_DYNAMIC_BITSET_REGISTER_BENCHMARK_SWITCH(func, name, switch_name) \
+    SUL_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint16_t, name, switch_name); \
+    SUL_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint32_t, name, switch_name); \
+    SUL_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint64_t, name, switch_name)
+
 // boost::dynamic_bitset benchmark
 #define BOOST_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE(func, block_type, name) \
     benchmark::RegisterBenchmark("boost::dynamic_bitset<" #block_type "> " name, func<block_type>);
@@ -52,6 +81,16 @@ static constexpr size_t RANGE_MULTIPLIER = 1ull << 2u;
     BOOST_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_RANGE(func, uint32_t, name); \
     BOOST_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_RANGE(func, uint64_t, name)
 
+#define BOOST_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, block_type, name, switch_name) \
+    benchmark::RegisterBenchmark("boost::dynamic_bitset<" #block_type "> " name, func<block_type>) \
+      ->ArgName(switch_name) \
+      ->DenseRange(0, 1)
+
+#define BOOST_DYNAMIC_BITSET_REGISTER_BENCHMARK_SWITCH(func, name, switch_name) \
+    BOOST_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint16_t, name, switch_name); \
+    BOOST_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint32_t, name, switch_name); \
+    BOOST_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint64_t, name, switch_name)
+
 // std::tr2::dynamic_bitset benchmark
 #define STD_TR2_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE(func, block_type, name) \
     benchmark::RegisterBenchmark("std::tr2::dynamic_bitset<" #block_type "> " name, func<block_type>);
@@ -71,6 +110,97 @@ static constexpr size_t RANGE_MULTIPLIER = 1ull << 2u;
     STD_TR2_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_RANGE(func, uint32_t, name); \
     STD_TR2_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_RANGE(func, uint64_t, name)
 
+#define STD_TR2_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, block_type, name, switch_name) \
+    benchmark::RegisterBenchmark("std::tr2::dynamic_bitset<" #block_type "> " name, func<block_type>) \
+      ->ArgName(switch_name) \
+      ->DenseRange(0, 1)
+
+#define STD_TR2_DYNAMIC_BITSET_REGISTER_BENCHMARK_SWITCH(func, name, switch_name) \
+    STD_TR2_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint16_t, name, switch_name); \
+    STD_TR2_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint32_t, name, switch_name); \
+    STD_TR2_DYNAMIC_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint64_t, name, switch_name)
+
+// fix::aligned_bitset benchmark
+#define FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_TEMPLATE(func, block_type, name) \
+    benchmark::RegisterBenchmark("fix::aligned_bitset<" #block_type "> " name, func<block_type>);
+
+#define FIX_ALIGNED_BITSET_REGISTER_BENCHMARK(func, name) \
+    FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_TEMPLATE(func, uint16_t, name); \
+    FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_TEMPLATE(func, uint32_t, name); \
+    FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_TEMPLATE(func, uint64_t, name)
+
+#define FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_TEMPLATE_RANGE(func, block_type, name) \
+    benchmark::RegisterBenchmark("fix::aligned_bitset<" #block_type "> " name, func<block_type>) \
+      ->RangeMultiplier(RANGE_MULTIPLIER) \
+      ->Range(RANGE_START, RANGE_END)
+
+#define FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_RANGE(func, name) \
+    FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_TEMPLATE_RANGE(func, uint16_t, name); \
+    FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_TEMPLATE_RANGE(func, uint32_t, name); \
+    FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_TEMPLATE_RANGE(func, uint64_t, name)
+
+#define FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, block_type, name, switch_name) \
+    benchmark::RegisterBenchmark("fix::aligned_bitset<" #block_type "> " name, func<block_type>) \
+      ->ArgName(switch_name) \
+      ->DenseRange(0, 1)
+
+#define FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_SWITCH(func, name, switch_name) \
+    FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint16_t, name, switch_name); \
+    FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint32_t, name, switch_name); \
+    FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint64_t, name, switch_name)
+
+// fix::small_bitset benchmark
+#define FIX_SMALL_BITSET_REGISTER_BENCHMARK_TEMPLATE(func, block_type, name) \
+    benchmark::RegisterBenchmark("fix::small_bitset<" #block_type "> " name, func<block_type>);
+
+#define FIX_SMALL_BITSET_REGISTER_BENCHMARK(func, name) \
+    FIX_SMALL_BITSET_REGISTER_BENCHMARK_TEMPLATE(func, uint16_t, name); \
+    FIX_SMALL_BITSET_REGISTER_BENCHMARK_TEMPLATE(func, uint32_t, name); \
+    FIX_SMALL_BITSET_REGISTER_BENCHMARK_TEMPLATE(func, uint64_t, name)
+
+#define FIX_SMALL_BITSET_REGISTER_BENCHMARK_TEMPLATE_RANGE(func, block_type, name) \
+    benchmark::RegisterBenchmark("fix::small_bitset<" #block_type "> " name, func<block_type>) \
+      ->RangeMultiplier(RANGE_MULTIPLIER) \
+      ->Range(RANGE_START, RANGE_END)
+
+#define FIX_SMALL_BITSET_REGISTER_BENCHMARK_RANGE(func, name) \
+    FIX_SMALL_BITSET_REGISTER_BENCHMARK_TEMPLATE_RANGE(func, uint16_t, name); \
+    FIX_SMALL_BITSET_REGISTER_BENCHMARK_TEMPLATE_RANGE(func, uint32_t, name); \
+    FIX_SMALL_BITSET_REGISTER_BENCHMARK_TEMPLATE_RANGE(func, uint64_t, name)
+
+#define FIX_SMALL_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, block_type, name, switch_name) \
+    benchmark::RegisterBenchmark("fix::small_bitset<" #block_type "> " name, func<block_type>) \
+      ->ArgName(switch_name) \
+      ->DenseRange(0, 1)
+
+#define FIX_SMALL_BITSET_REGISTER_BENCHMARK_SWITCH(func, name, switch_name) \
+    FIX_SMALL_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint16_t, name, switch_name); \
+    FIX_SMALL_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint32_t, name, switch_name); \
+    FIX_SMALL_BITSET_REGISTER_BENCHMARK_TEMPLATE_SWITCH(func, uint64_t, name, switch_name)
+
+// fix::roaring_bitset benchmark
+#define FIX_ROARING_BITSET_REGISTER_BENCHMARK(func, name) \
+    benchmark::RegisterBenchmark("fix::roaring_bitset " name, func);
+
+#define FIX_ROARING_BITSET_REGISTER_BENCHMARK_RANGE(func, name) \
+    benchmark::RegisterBenchmark("fix::roaring_bitset " name, func) \
+      ->RangeMultiplier(RANGE_MULTIPLIER) \
+      ->Range(RANGE_START, RANGE_END)
+
+#define FIX_ROARING_BITSET_REGISTER_BENCHMARK_SWITCH(func, name, switch_name) \
+    benchmark::RegisterBenchmark("fix::roaring_bitset " name, func)->ArgName(switch_name)->DenseRange(0, 1)
+
+// fix::auto_bitset benchmark
+#define FIX_AUTO_BITSET_REGISTER_BENCHMARK(func, name) benchmark::RegisterBenchmark("fix::auto_bitset " name, func);
+
+#define FIX_AUTO_BITSET_REGISTER_BENCHMARK_RANGE(func, name) \
+    benchmark::RegisterBenchmark("fix::auto_bitset " name, func) \
+      ->RangeMultiplier(RANGE_MULTIPLIER) \
+      ->Range(RANGE_START, RANGE_END)
+
+#define FIX_AUTO_BITSET_REGISTER_BENCHMARK_SWITCH(func, name, switch_name) \
+    benchmark::RegisterBenchmark("fix::auto_bitset " name, func)->ArgName(switch_name)->DenseRange(0, 1)
+
 // std::vector<bool> benchmark
 #define STD_VECTOR_BOOL_REGISTER_BENCHMARK(func, name) benchmark::RegisterBenchmark("std::vector<bool> " name, func);
 
@@ -78,3 +208,27 @@ static constexpr size_t RANGE_MULTIPLIER = 1ull << 2u;
     benchmark::RegisterBenchmark("std::vector<bool> " name, func) \
       ->RangeMultiplier(RANGE_MULTIPLIER) \
       ->Range(RANGE_START, RANGE_END)
+
+#define STD_VECTOR_BOOL_REGISTER_BENCHMARK_SWITCH(func, name, switch_name) \
+    benchmark::RegisterBenchmark("std::vector<bool> " name, func)->ArgName(switch_name)->DenseRange(0, 1)
+
+// std::bitset benchmark, for the size bucket of the instance
+// the arguments after name are appended to the registration
+#define STD_BITSET_REGISTER_BENCHMARK_TEMPLATE(func, instance_bits, name, ...) \
+    visit_std_bitset_bucket(instance_bits, \
+                            []<size_t bits>(std::integral_constant<size_t, bits>) \
+                            { \
+                                benchmark::RegisterBenchmark( \
+                                  ("std::bitset<" + std::to_string(bits) + "> " name).c_str(), func<bits>) \
+                                  __VA_ARGS__; \
+                            })
+
+#define STD_BITSET_REGISTER_BENCHMARK(func, instance_bits, name) \
+    STD_BITSET_REGISTER_BENCHMARK_TEMPLATE(func, instance_bits, name);
+
+#define STD_BITSET_REGISTER_BENCHMARK_RANGE(func, instance_bits, name) \
+    STD_BITSET_REGISTER_BENCHMARK_TEMPLATE( \
+      func, instance_bits, name, ->RangeMultiplier(RANGE_MULTIPLIER)->Range(RANGE_START, RANGE_END))
+
+#define STD_BITSET_REGISTER_BENCHMARK_SWITCH(func, instance_bits, name, switch_name) \
+    STD_BITSET_REGISTER_BENCHMARK_TEMPLATE(func, instance_bits, name, ->ArgName(switch_name)->DenseRange(0, 1))
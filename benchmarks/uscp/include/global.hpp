@@ -7,6 +7,10 @@
 //
 #pragma once
 
+#include <fix/aligned_bitset.hpp>
+#include <fix/auto_bitset.hpp>
+#include <fix/roaring_bitset.hpp>
+#include <fix/small_bitset.hpp>
 #include <sul/dynamic_bitset.hpp>
 #ifdef HAS_BOOST
 #    include <boost/dynamic_bitset.hpp>
@@ -17,6 +21,7 @@
 
 #include <uscp/instance.hpp>
 
+#include <bitset>
 #include <vector>
 
 namespace global
@@ -48,5 +53,28 @@ extern template uscp::problem::instance<std::tr2::dynamic_bitset<uint32_t>>
 extern template uscp::problem::instance<std::tr2::dynamic_bitset<uint64_t>>
   global::benchmark_instance<std::tr2::dynamic_bitset<uint64_t>>;
 #    endif
+extern template uscp::problem::instance<fix::aligned_bitset<uint16_t>>
+  global::benchmark_instance<fix::aligned_bitset<uint16_t>>;
+extern template uscp::problem::instance<fix::aligned_bitset<uint32_t>>
+  global::benchmark_instance<fix::aligned_bitset<uint32_t>>;
+extern template uscp::problem::instance<fix::aligned_bitset<uint64_t>>
+  global::benchmark_instance<fix::aligned_bitset<uint64_t>>;
+extern template uscp::problem::instance<fix::small_bitset<uint16_t>>
+  global::benchmark_instance<fix::small_bitset<uint16_t>>;
+extern template uscp::problem::instance<fix::small_bitset<uint32_t>>
+  global::benchmark_instance<fix::small_bitset<uint32_t>>;
+extern template uscp::problem::instance<fix::small_bitset<uint64_t>>
+  global::benchmark_instance<fix::small_bitset<uint64_t>>;
+extern template uscp::problem::instance<fix::roaring_bitset> global::benchmark_instance<fix::roaring_bitset>;
+extern template uscp::problem::instance<fix::auto_bitset> global::benchmark_instance<fix::auto_bitset>;
 extern template uscp::problem::instance<std::vector<bool>> global::benchmark_instance<std::vector<bool>>;
+// std::bitset size buckets of config.hpp
+extern template uscp::problem::instance<std::bitset<256>> global::benchmark_instance<std::bitset<256>>;
+extern template uscp::problem::instance<std::bitset<512>> global::benchmark_instance<std::bitset<512>>;
+extern template uscp::problem::instance<std::bitset<1024>> global::benchmark_instance<std::bitset<1024>>;
+extern template uscp::problem::instance<std::bitset<2048>> global::benchmark_instance<std::bitset<2048>>;
+extern template uscp::problem::instance<std::bitset<4096>> global::benchmark_instance<std::bitset<4096>>;
+extern template uscp::problem::instance<std::bitset<8192>> global::benchmark_instance<std::bitset<8192>>;
+extern template uscp::problem::instance<std::bitset<16384>> global::benchmark_instance<std::bitset<16384>>;
+extern template uscp::problem::instance<std::bitset<32768>> global::benchmark_instance<std::bitset<32768>>;
 #endif
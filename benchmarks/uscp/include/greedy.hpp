@@ -12,6 +12,10 @@
 
 #include <benchmark/benchmark.h>
 
+#include <fix/aligned_bitset.hpp>
+#include <fix/auto_bitset.hpp>
+#include <fix/roaring_bitset.hpp>
+#include <fix/small_bitset.hpp>
 #include <sul/dynamic_bitset.hpp>
 #ifdef HAS_BOOST
 #    include <boost/dynamic_bitset.hpp>
@@ -20,6 +24,7 @@
 #    include <tr2/dynamic_bitset>
 #endif
 
+#include <bitset>
 #include <vector>
 
 template<typename block_type_t>
@@ -33,6 +38,28 @@ void sul_dynamic_bitset_uscp_greedy(benchmark::State& state)
     }
 }
 
+template<typename block_type_t>
+void fix_aligned_bitset_uscp_greedy(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        uscp::solution<fix::aligned_bitset<block_type_t>> solution =
+          uscp::greedy::solve(global::benchmark_instance<fix::aligned_bitset<block_type_t>>);
+        benchmark::DoNotOptimize(solution);
+    }
+}
+
+template<typename block_type_t>
+void fix_small_bitset_uscp_greedy(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        uscp::solution<fix::small_bitset<block_type_t>> solution =
+          uscp::greedy::solve(global::benchmark_instance<fix::small_bitset<block_type_t>>);
+        benchmark::DoNotOptimize(solution);
+    }
+}
+
 #ifdef HAS_BOOST
 template<typename block_type_t>
 void boost_dynamic_bitset_uscp_greedy(benchmark::State& state)
@@ -59,6 +86,35 @@ void std_tr2_dynamic_bitset_uscp_greedy(benchmark::State& state)
 }
 #endif
 
+inline void fix_roaring_bitset_uscp_greedy(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        uscp::solution<fix::roaring_bitset> solution =
+          uscp::greedy::solve(global::benchmark_instance<fix::roaring_bitset>);
+        benchmark::DoNotOptimize(solution);
+    }
+}
+
+inline void fix_auto_bitset_uscp_greedy(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        uscp::solution<fix::auto_bitset> solution = uscp::greedy::solve(global::benchmark_instance<fix::auto_bitset>);
+        benchmark::DoNotOptimize(solution);
+    }
+}
+
+template<size_t bits>
+void std_bitset_uscp_greedy(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        uscp::solution<std::bitset<bits>> solution = uscp::greedy::solve(global::benchmark_instance<std::bitset<bits>>);
+        benchmark::DoNotOptimize(solution);
+    }
+}
+
 inline void std_vector_bool_uscp_greedy(benchmark::State& state)
 {
     for(auto _: state)
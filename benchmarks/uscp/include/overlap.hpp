@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include "global.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/auto_bitset.hpp>
+#include <fix/roaring_bitset.hpp>
+#include <fix/small_bitset.hpp>
+#include <sul/dynamic_bitset.hpp>
+#ifdef HAS_BOOST
+#    include <boost/dynamic_bitset.hpp>
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+#    include <tr2/dynamic_bitset>
+#endif
+
+#include "uscp/overlap.hpp"
+
+#include <bitset>
+#include <vector>
+
+// subset-overlap graph of the first range(0) subsets of the instance
+template<typename dynamic_bitset_t>
+void uscp_overlap_graph(benchmark::State& state)
+{
+    const uscp::problem::instance<dynamic_bitset_t>& instance = global::benchmark_instance<dynamic_bitset_t>;
+    const size_t subsets_number = static_cast<size_t>(state.range(0));
+    if(subsets_number > instance.subsets_number)
+    {
+        state.SkipWithError("less subsets in the instance");
+        return;
+    }
+
+    uscp::problem::instance<dynamic_bitset_t> sub_instance = instance;
+    sub_instance.subsets_number = subsets_number;
+    sub_instance.subsets_points.resize(subsets_number);
+    sub_instance.subsets_points_indices.resize(subsets_number);
+
+    size_t edges_number = 0;
+    for(auto _: state)
+    {
+        const uscp::overlap::graph graph = uscp::overlap::build(sub_instance);
+        edges_number = graph.edges_number();
+        benchmark::DoNotOptimize(graph);
+    }
+
+    state.counters["edges"] = static_cast<double>(edges_number);
+    state.counters["pairs_per_second"] =
+      benchmark::Counter(static_cast<double>(subsets_number * (subsets_number - 1) / 2),
+                         benchmark::Counter::kIsIterationInvariantRate,
+                         benchmark::Counter::OneK::kIs1000);
+}
+
+template<typename block_type_t>
+void sul_dynamic_bitset_uscp_overlap_graph(benchmark::State& state)
+{
+    uscp_overlap_graph<sul::dynamic_bitset<block_type_t>>(state);
+}
+
+template<typename block_type_t>
+void fix_aligned_bitset_uscp_overlap_graph(benchmark::State& state)
+{
+    uscp_overlap_graph<fix::aligned_bitset<block_type_t>>(state);
+}
+
+template<typename block_type_t>
+void fix_small_bitset_uscp_overlap_graph(benchmark::State& state)
+{
+    uscp_overlap_graph<fix::small_bitset<block_type_t>>(state);
+}
+
+#ifdef HAS_BOOST
+template<typename block_type_t>
+void boost_dynamic_bitset_uscp_overlap_graph(benchmark::State& state)
+{
+    uscp_overlap_graph<boost::dynamic_bitset<block_type_t>>(state);
+}
+#endif
+
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+template<typename block_type_t>
+void std_tr2_dynamic_bitset_uscp_overlap_graph(benchmark::State& state)
+{
+    uscp_overlap_graph<std::tr2::dynamic_bitset<block_type_t>>(state);
+}
+#endif
+
+inline void fix_roaring_bitset_uscp_overlap_graph(benchmark::State& state)
+{
+    uscp_overlap_graph<fix::roaring_bitset>(state);
+}
+
+inline void fix_auto_bitset_uscp_overlap_graph(benchmark::State& state)
+{
+    uscp_overlap_graph<fix::auto_bitset>(state);
+}
+
+template<size_t bits>
+void std_bitset_uscp_overlap_graph(benchmark::State& state)
+{
+    uscp_overlap_graph<std::bitset<bits>>(state);
+}
+
+inline void std_vector_bool_uscp_overlap_graph(benchmark::State& state)
+{
+    uscp_overlap_graph<std::vector<bool>>(state);
+}
@@ -12,6 +12,10 @@
 
 #include <benchmark/benchmark.h>
 
+#include <fix/aligned_bitset.hpp>
+#include <fix/auto_bitset.hpp>
+#include <fix/roaring_bitset.hpp>
+#include <fix/small_bitset.hpp>
 #include <sul/dynamic_bitset.hpp>
 #ifdef HAS_BOOST
 #    include <boost/dynamic_bitset.hpp>
@@ -22,6 +26,9 @@
 
 #include "uscp/rwls.hpp"
 
+#include <array>
+#include <bitset>
+#include <span>
 #include <vector>
 
 template<typename block_type_t>
@@ -52,6 +59,60 @@ void sul_dynamic_bitset_uscp_rwls(benchmark::State& state)
       benchmark::Counter(steps, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
 }
 
+template<typename block_type_t>
+void fix_aligned_bitset_uscp_rwls(benchmark::State& state)
+{
+    const size_t steps = static_cast<size_t>(state.range(0));
+    uscp::random_engine random_engine(SEED);
+
+    uscp::rwls::rwls<fix::aligned_bitset<block_type_t>> rwls(
+      global::benchmark_instance<fix::aligned_bitset<block_type_t>>);
+    rwls.initialize();
+
+    uscp::solution<fix::aligned_bitset<block_type_t>> initial_solution =
+      uscp::greedy::solve(global::benchmark_instance<fix::aligned_bitset<block_type_t>>);
+
+    for(auto _: state)
+    {
+        uscp::solution<fix::aligned_bitset<block_type_t>> solution =
+          rwls.improve(initial_solution, random_engine, steps);
+        benchmark::DoNotOptimize(solution);
+    }
+
+    state.counters["1_step_time"] =
+      benchmark::Counter(steps,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["steps_per_second"] =
+      benchmark::Counter(steps, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+template<typename block_type_t>
+void fix_small_bitset_uscp_rwls(benchmark::State& state)
+{
+    const size_t steps = static_cast<size_t>(state.range(0));
+    uscp::random_engine random_engine(SEED);
+
+    uscp::rwls::rwls<fix::small_bitset<block_type_t>> rwls(global::benchmark_instance<fix::small_bitset<block_type_t>>);
+    rwls.initialize();
+
+    uscp::solution<fix::small_bitset<block_type_t>> initial_solution =
+      uscp::greedy::solve(global::benchmark_instance<fix::small_bitset<block_type_t>>);
+
+    for(auto _: state)
+    {
+        uscp::solution<fix::small_bitset<block_type_t>> solution = rwls.improve(initial_solution, random_engine, steps);
+        benchmark::DoNotOptimize(solution);
+    }
+
+    state.counters["1_step_time"] =
+      benchmark::Counter(steps,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["steps_per_second"] =
+      benchmark::Counter(steps, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
 #ifdef HAS_BOOST
 template<typename block_type_t>
 void boost_dynamic_bitset_uscp_rwls(benchmark::State& state)
@@ -112,6 +173,82 @@ void std_tr2_dynamic_bitset_uscp_rwls(benchmark::State& state)
 }
 #endif
 
+inline void fix_roaring_bitset_uscp_rwls(benchmark::State& state)
+{
+    const size_t steps = static_cast<size_t>(state.range(0));
+    uscp::random_engine random_engine(SEED);
+
+    uscp::rwls::rwls<fix::roaring_bitset> rwls(global::benchmark_instance<fix::roaring_bitset>);
+    rwls.initialize();
+
+    uscp::solution<fix::roaring_bitset> initial_solution =
+      uscp::greedy::solve(global::benchmark_instance<fix::roaring_bitset>);
+
+    for(auto _: state)
+    {
+        uscp::solution<fix::roaring_bitset> solution = rwls.improve(initial_solution, random_engine, steps);
+        benchmark::DoNotOptimize(solution);
+    }
+
+    state.counters["1_step_time"] =
+      benchmark::Counter(steps,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["steps_per_second"] =
+      benchmark::Counter(steps, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+inline void fix_auto_bitset_uscp_rwls(benchmark::State& state)
+{
+    const size_t steps = static_cast<size_t>(state.range(0));
+    uscp::random_engine random_engine(SEED);
+
+    uscp::rwls::rwls<fix::auto_bitset> rwls(global::benchmark_instance<fix::auto_bitset>);
+    rwls.initialize();
+
+    uscp::solution<fix::auto_bitset> initial_solution =
+      uscp::greedy::solve(global::benchmark_instance<fix::auto_bitset>);
+
+    for(auto _: state)
+    {
+        uscp::solution<fix::auto_bitset> solution = rwls.improve(initial_solution, random_engine, steps);
+        benchmark::DoNotOptimize(solution);
+    }
+
+    state.counters["1_step_time"] =
+      benchmark::Counter(steps,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["steps_per_second"] =
+      benchmark::Counter(steps, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+template<size_t bits>
+void std_bitset_uscp_rwls(benchmark::State& state)
+{
+    const size_t steps = static_cast<size_t>(state.range(0));
+    uscp::random_engine random_engine(SEED);
+
+    uscp::rwls::rwls<std::bitset<bits>> rwls(global::benchmark_instance<std::bitset<bits>>);
+    rwls.initialize();
+
+    uscp::solution<std::bitset<bits>> initial_solution =
+      uscp::greedy::solve(global::benchmark_instance<std::bitset<bits>>);
+
+    for(auto _: state)
+    {
+        uscp::solution<std::bitset<bits>> solution = rwls.improve(initial_solution, random_engine, steps);
+        benchmark::DoNotOptimize(solution);
+    }
+
+    state.counters["1_step_time"] =
+      benchmark::Counter(steps,
+                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                         benchmark::Counter::OneK::kIs1000);
+    state.counters["steps_per_second"] =
+      benchmark::Counter(steps, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
 inline void std_vector_bool_uscp_rwls(benchmark::State& state)
 {
     const size_t steps = static_cast<size_t>(state.range(0));
@@ -136,3 +273,104 @@ inline void std_vector_bool_uscp_rwls(benchmark::State& state)
     state.counters["steps_per_second"] =
       benchmark::Counter(steps, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
 }
+
+// RWLS initialization: one push_back per point of each subset (transpose:0, previous initialize()) or 64x64 tiles
+// transposes of the subsets matrix (transpose:1, rwls::initialize())
+template<typename dynamic_bitset_t>
+void uscp_rwls_initialize(benchmark::State& state)
+{
+    const uscp::problem::instance<dynamic_bitset_t>& instance = global::benchmark_instance<dynamic_bitset_t>;
+    if(state.range(0) != 0)
+    {
+        for(auto _: state)
+        {
+            uscp::rwls::rwls<dynamic_bitset_t> rwls(instance);
+            rwls.initialize();
+            benchmark::DoNotOptimize(rwls);
+        }
+    }
+    else
+    {
+        std::array<size_t, uscp::rwls::BITS_ON_BATCH_SIZE> bits_on_buffer;
+        for(auto _: state)
+        {
+            std::vector<std::vector<size_t>> subsets_points(instance.subsets_number);
+            std::vector<std::vector<size_t>> subsets_covering_points(instance.points_number);
+            for(size_t i = 0; i < instance.subsets_number; ++i)
+            {
+                fix::dynamic_bitset::do_iterate_bits_on_batched(
+                  instance.subsets_points[i],
+                  bits_on_buffer,
+                  [&](std::span<const size_t> bits_on) noexcept
+                  {
+                      subsets_points[i].insert(subsets_points[i].end(), bits_on.begin(), bits_on.end());
+                      for(const size_t bit_on: bits_on)
+                      {
+                          subsets_covering_points[bit_on].push_back(i);
+                      }
+                  });
+            }
+            benchmark::DoNotOptimize(subsets_points);
+            benchmark::DoNotOptimize(subsets_covering_points);
+        }
+    }
+
+    state.counters["points_per_second"] = benchmark::Counter(static_cast<double>(instance.points_number),
+                                                             benchmark::Counter::kIsIterationInvariantRate,
+                                                             benchmark::Counter::OneK::kIs1000);
+}
+
+template<typename block_type_t>
+void sul_dynamic_bitset_uscp_rwls_initialize(benchmark::State& state)
+{
+    uscp_rwls_initialize<sul::dynamic_bitset<block_type_t>>(state);
+}
+
+template<typename block_type_t>
+void fix_aligned_bitset_uscp_rwls_initialize(benchmark::State& state)
+{
+    uscp_rwls_initialize<fix::aligned_bitset<block_type_t>>(state);
+}
+
+template<typename block_type_t>
+void fix_small_bitset_uscp_rwls_initialize(benchmark::State& state)
+{
+    uscp_rwls_initialize<fix::small_bitset<block_type_t>>(state);
+}
+
+#ifdef HAS_BOOST
+template<typename block_type_t>
+void boost_dynamic_bitset_uscp_rwls_initialize(benchmark::State& state)
+{
+    uscp_rwls_initialize<boost::dynamic_bitset<block_type_t>>(state);
+}
+#endif
+
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+template<typename block_type_t>
+void std_tr2_dynamic_bitset_uscp_rwls_initialize(benchmark::State& state)
+{
+    uscp_rwls_initialize<std::tr2::dynamic_bitset<block_type_t>>(state);
+}
+#endif
+
+inline void fix_roaring_bitset_uscp_rwls_initialize(benchmark::State& state)
+{
+    uscp_rwls_initialize<fix::roaring_bitset>(state);
+}
+
+inline void fix_auto_bitset_uscp_rwls_initialize(benchmark::State& state)
+{
+    uscp_rwls_initialize<fix::auto_bitset>(state);
+}
+
+template<size_t bits>
+void std_bitset_uscp_rwls_initialize(benchmark::State& state)
+{
+    uscp_rwls_initialize<std::bitset<bits>>(state);
+}
+
+inline void std_vector_bool_uscp_rwls_initialize(benchmark::State& state)
+{
+    uscp_rwls_initialize<std::vector<bool>>(state);
+}
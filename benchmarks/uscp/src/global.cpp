@@ -8,6 +8,10 @@
 #define GLOBAL_BENCHMARK_INSTANCE_DEFINITION
 #include <global.hpp>
 
+#include <fix/aligned_bitset.hpp>
+#include <fix/auto_bitset.hpp>
+#include <fix/roaring_bitset.hpp>
+#include <fix/small_bitset.hpp>
 #include <sul/dynamic_bitset.hpp>
 #ifdef HAS_BOOST
 #    include <boost/dynamic_bitset.hpp>
@@ -16,6 +20,7 @@
 #    include <tr2/dynamic_bitset>
 #endif
 
+#include <bitset>
 #include <vector>
 
 template<>
@@ -46,5 +51,43 @@ uscp::problem::instance<std::tr2::dynamic_bitset<uint64_t>>
   global::benchmark_instance<std::tr2::dynamic_bitset<uint64_t>>;
 #endif
 
+template<>
+uscp::problem::instance<fix::aligned_bitset<uint16_t>> global::benchmark_instance<fix::aligned_bitset<uint16_t>>;
+template<>
+uscp::problem::instance<fix::aligned_bitset<uint32_t>> global::benchmark_instance<fix::aligned_bitset<uint32_t>>;
+template<>
+uscp::problem::instance<fix::aligned_bitset<uint64_t>> global::benchmark_instance<fix::aligned_bitset<uint64_t>>;
+
+template<>
+uscp::problem::instance<fix::small_bitset<uint16_t>> global::benchmark_instance<fix::small_bitset<uint16_t>>;
+template<>
+uscp::problem::instance<fix::small_bitset<uint32_t>> global::benchmark_instance<fix::small_bitset<uint32_t>>;
+template<>
+uscp::problem::instance<fix::small_bitset<uint64_t>> global::benchmark_instance<fix::small_bitset<uint64_t>>;
+
+template<>
+uscp::problem::instance<fix::roaring_bitset> global::benchmark_instance<fix::roaring_bitset>;
+
+template<>
+uscp::problem::instance<fix::auto_bitset> global::benchmark_instance<fix::auto_bitset>;
+
 template<>
 uscp::problem::instance<std::vector<bool>> global::benchmark_instance<std::vector<bool>>;
+
+// std::bitset size buckets of config.hpp
+template<>
+uscp::problem::instance<std::bitset<256>> global::benchmark_instance<std::bitset<256>>;
+template<>
+uscp::problem::instance<std::bitset<512>> global::benchmark_instance<std::bitset<512>>;
+template<>
+uscp::problem::instance<std::bitset<1024>> global::benchmark_instance<std::bitset<1024>>;
+template<>
+uscp::problem::instance<std::bitset<2048>> global::benchmark_instance<std::bitset<2048>>;
+template<>
+uscp::problem::instance<std::bitset<4096>> global::benchmark_instance<std::bitset<4096>>;
+template<>
+uscp::problem::instance<std::bitset<8192>> global::benchmark_instance<std::bitset<8192>>;
+template<>
+uscp::problem::instance<std::bitset<16384>> global::benchmark_instance<std::bitset<16384>>;
+template<>
+uscp::problem::instance<std::bitset<32768>> global::benchmark_instance<std::bitset<32768>>;
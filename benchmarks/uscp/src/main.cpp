@@ -5,11 +5,21 @@
 // See accompanying file LICENSE or copy at
 // https://opensource.org/licenses/MIT
 //
+#include <arguments.hpp>
+#include <auto_bitset_calibration.hpp>
+#include <census_reporter.hpp>
 #include <config.hpp>
 #include <global.hpp>
 #include <greedy.hpp>
+#include <overlap.hpp>
 #include <rwls.hpp>
 
+#include <fix/aligned_bitset.hpp>
+#include <fix/auto_bitset.hpp>
+#include <fix/census.hpp>
+#include <fix/kernels_simd.hpp>
+#include <fix/roaring_bitset.hpp>
+#include <fix/small_bitset.hpp>
 #include <uscp/or_library.hpp>
 
 #include <sul/dynamic_bitset.hpp>
@@ -24,8 +34,11 @@
 #include <fmt/core.h>
 #include <fmt/std.h>
 
+#include <algorithm>
+#include <bitset>
 #include <chrono>
 #include <filesystem>
+#include <string>
 
 bool load_instance(const std::filesystem::path& instance_path) noexcept
 {
@@ -53,13 +66,54 @@ bool load_instance(const std::filesystem::path& instance_path) noexcept
     LOAD_INSTANCE_FOR(std::tr2::dynamic_bitset<uint32_t>);
     LOAD_INSTANCE_FOR(std::tr2::dynamic_bitset<uint64_t>);
 #endif
+    LOAD_INSTANCE_FOR(fix::aligned_bitset<uint16_t>);
+    LOAD_INSTANCE_FOR(fix::aligned_bitset<uint32_t>);
+    LOAD_INSTANCE_FOR(fix::aligned_bitset<uint64_t>);
+    LOAD_INSTANCE_FOR(fix::small_bitset<uint16_t>);
+    LOAD_INSTANCE_FOR(fix::small_bitset<uint32_t>);
+    LOAD_INSTANCE_FOR(fix::small_bitset<uint64_t>);
+    LOAD_INSTANCE_FOR(fix::roaring_bitset);
+    LOAD_INSTANCE_FOR(fix::auto_bitset);
     LOAD_INSTANCE_FOR(std::vector<bool>);
 #undef LOAD_INSTANCE_FOR
 
-    return true;
+    // representation chosen by fix::auto_bitset for the points bitsets of the subsets
+    if(const auto& auto_instance = global::benchmark_instance<fix::auto_bitset>; !auto_instance.subsets_points.empty())
+    {
+        fmt::print(stderr,
+                   "     fix::auto_bitset representation: {}\n",
+                   fix::auto_bitset_representation_name(auto_instance.subsets_points.front().representation()));
+    }
+
+    // std::bitset of the smallest size bucket holding the instance, the buckets are instantiated at compile time
+    const uscp::problem::instance<sul::dynamic_bitset<uint16_t>>& instance =
+      global::benchmark_instance<sul::dynamic_bitset<uint16_t>>;
+    bool loaded = true;
+    const bool bucket_found = visit_std_bitset_bucket(
+      std::max(instance.points_number, instance.subsets_number),
+      [&]<size_t bits>(std::integral_constant<size_t, bits>)
+      {
+          if(auto std_bitset_instance = uscp::problem::or_library::instance_from<std::bitset<bits>>(instance_path))
+          {
+              fmt::print(stderr, " [✓] std::bitset<{}>\n", bits);
+              global::benchmark_instance<std::bitset<bits>> = *std_bitset_instance;
+          }
+          else
+          {
+              fmt::print(stderr, "failed load instance: {}\n", std_bitset_instance.error());
+              loaded = false;
+          }
+      });
+    if(!bucket_found)
+    {
+        fmt::print(stderr, " [ ] std::bitset: instance larger than the largest size bucket\n");
+    }
+
+    return loaded;
 }
 
-int main(int argc, char** argv)
+// instance_bits: largest of the points and subsets numbers of the instance, selects the std::bitset size bucket
+static void register_benchmarks(size_t instance_bits)
 {
     // Register greedy benchmark for each dynamic bitset type
     SUL_DYNAMIC_BITSET_REGISTER_BENCHMARK(sul_dynamic_bitset_uscp_greedy, "greedy");
@@ -69,7 +123,12 @@ int main(int argc, char** argv)
 #ifdef HAS_STD_TR2_DYNAMIC_BITSET
     STD_TR2_DYNAMIC_BITSET_REGISTER_BENCHMARK(std_tr2_dynamic_bitset_uscp_greedy, "greedy");
 #endif
+    FIX_ALIGNED_BITSET_REGISTER_BENCHMARK(fix_aligned_bitset_uscp_greedy, "greedy");
+    FIX_SMALL_BITSET_REGISTER_BENCHMARK(fix_small_bitset_uscp_greedy, "greedy");
+    FIX_ROARING_BITSET_REGISTER_BENCHMARK(fix_roaring_bitset_uscp_greedy, "greedy");
+    FIX_AUTO_BITSET_REGISTER_BENCHMARK(fix_auto_bitset_uscp_greedy, "greedy");
     STD_VECTOR_BOOL_REGISTER_BENCHMARK(std_vector_bool_uscp_greedy, "greedy");
+    STD_BITSET_REGISTER_BENCHMARK(std_bitset_uscp_greedy, instance_bits, "greedy");
 
     // Register RWLS benchmark for each dynamic bitset type
     SUL_DYNAMIC_BITSET_REGISTER_BENCHMARK_RANGE(sul_dynamic_bitset_uscp_rwls, "RWLS");
@@ -79,9 +138,61 @@ int main(int argc, char** argv)
 #ifdef HAS_STD_TR2_DYNAMIC_BITSET
     STD_TR2_DYNAMIC_BITSET_REGISTER_BENCHMARK_RANGE(std_tr2_dynamic_bitset_uscp_rwls, "RWLS");
 #endif
+    FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_RANGE(fix_aligned_bitset_uscp_rwls, "RWLS");
+    FIX_SMALL_BITSET_REGISTER_BENCHMARK_RANGE(fix_small_bitset_uscp_rwls, "RWLS");
+    FIX_ROARING_BITSET_REGISTER_BENCHMARK_RANGE(fix_roaring_bitset_uscp_rwls, "RWLS");
+    FIX_AUTO_BITSET_REGISTER_BENCHMARK_RANGE(fix_auto_bitset_uscp_rwls, "RWLS");
     STD_VECTOR_BOOL_REGISTER_BENCHMARK_RANGE(std_vector_bool_uscp_rwls, "RWLS");
+    STD_BITSET_REGISTER_BENCHMARK_RANGE(std_bitset_uscp_rwls, instance_bits, "RWLS");
+
+    // Register RWLS initialization benchmark for each dynamic bitset type
+    SUL_DYNAMIC_BITSET_REGISTER_BENCHMARK_SWITCH(
+      sul_dynamic_bitset_uscp_rwls_initialize, "RWLS initialize", "transpose");
+#ifdef HAS_BOOST
+    BOOST_DYNAMIC_BITSET_REGISTER_BENCHMARK_SWITCH(
+      boost_dynamic_bitset_uscp_rwls_initialize, "RWLS initialize", "transpose");
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+    STD_TR2_DYNAMIC_BITSET_REGISTER_BENCHMARK_SWITCH(
+      std_tr2_dynamic_bitset_uscp_rwls_initialize, "RWLS initialize", "transpose");
+#endif
+    FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_SWITCH(
+      fix_aligned_bitset_uscp_rwls_initialize, "RWLS initialize", "transpose");
+    FIX_SMALL_BITSET_REGISTER_BENCHMARK_SWITCH(fix_small_bitset_uscp_rwls_initialize, "RWLS initialize", "transpose");
+    FIX_ROARING_BITSET_REGISTER_BENCHMARK_SWITCH(
+      fix_roaring_bitset_uscp_rwls_initialize, "RWLS initialize", "transpose");
+    FIX_AUTO_BITSET_REGISTER_BENCHMARK_SWITCH(fix_auto_bitset_uscp_rwls_initialize, "RWLS initialize", "transpose");
+    STD_VECTOR_BOOL_REGISTER_BENCHMARK_SWITCH(std_vector_bool_uscp_rwls_initialize, "RWLS initialize", "transpose");
+    STD_BITSET_REGISTER_BENCHMARK_SWITCH(
+      std_bitset_uscp_rwls_initialize, instance_bits, "RWLS initialize", "transpose");
 
-    // Process arguments
+    // Register subset-overlap graph benchmark for each dynamic bitset type
+    SUL_DYNAMIC_BITSET_REGISTER_BENCHMARK_RANGE(sul_dynamic_bitset_uscp_overlap_graph, "overlap graph");
+#ifdef HAS_BOOST
+    BOOST_DYNAMIC_BITSET_REGISTER_BENCHMARK_RANGE(boost_dynamic_bitset_uscp_overlap_graph, "overlap graph");
+#endif
+#ifdef HAS_STD_TR2_DYNAMIC_BITSET
+    STD_TR2_DYNAMIC_BITSET_REGISTER_BENCHMARK_RANGE(std_tr2_dynamic_bitset_uscp_overlap_graph, "overlap graph");
+#endif
+    FIX_ALIGNED_BITSET_REGISTER_BENCHMARK_RANGE(fix_aligned_bitset_uscp_overlap_graph, "overlap graph");
+    FIX_SMALL_BITSET_REGISTER_BENCHMARK_RANGE(fix_small_bitset_uscp_overlap_graph, "overlap graph");
+    FIX_ROARING_BITSET_REGISTER_BENCHMARK_RANGE(fix_roaring_bitset_uscp_overlap_graph, "overlap graph");
+    FIX_AUTO_BITSET_REGISTER_BENCHMARK_RANGE(fix_auto_bitset_uscp_overlap_graph, "overlap graph");
+    STD_VECTOR_BOOL_REGISTER_BENCHMARK_RANGE(std_vector_bool_uscp_overlap_graph, "overlap graph");
+    STD_BITSET_REGISTER_BENCHMARK_RANGE(std_bitset_uscp_overlap_graph, instance_bits, "overlap graph");
+}
+
+int main(int argc, char** argv)
+{
+    // Record the instruction set used by the fix kernels
+    benchmark::AddCustomContext(
+      "fix_kernels_isa",
+      std::string(fix::dynamic_bitset::kernels::isa_name(fix::dynamic_bitset::kernels::selected_isa())));
+
+    // Process arguments, the fix::auto_bitset calibration is loaded before the instance bitsets are made
+    const std::string auto_bitset_calibration = extract_argument(argc, argv, "--auto_bitset_calibration");
+    const std::string benchmark_out = find_argument(argc, argv, "--benchmark_out");
+    const std::string benchmark_out_format = find_argument(argc, argv, "--benchmark_out_format");
     benchmark::Initialize(&argc, argv);
     if(argc != 2)
     {
@@ -118,6 +229,15 @@ int main(int argc, char** argv)
         return 1;
     }
 
+    // Load the fix::auto_bitset calibration, the default representations are used without it
+    if(!auto_bitset_calibration.empty())
+    {
+        if(!load_auto_bitset_calibration(auto_bitset_calibration))
+        {
+            return 1;
+        }
+    }
+
     // Load the instance
     fmt::print(stderr, "load OR-Library instance from: {}\n", instance_path);
     if(!load_instance(instance_path))
@@ -129,8 +249,19 @@ int main(int argc, char** argv)
                global::benchmark_instance<sul::dynamic_bitset<uint16_t>>.points_number,
                global::benchmark_instance<sul::dynamic_bitset<uint16_t>>.subsets_number);
 
-    // Run benchmarks
-    benchmark::RunSpecifiedBenchmarks();
+    // Register the benchmarks, once the instance size is known
+    register_benchmarks(std::max(global::benchmark_instance<sul::dynamic_bitset<uint16_t>>.points_number,
+                                 global::benchmark_instance<sul::dynamic_bitset<uint16_t>>.subsets_number));
+
+    // Run benchmarks, with the census of the fix adapters when enabled
+    if constexpr(fix::dynamic_bitset::census::enabled)
+    {
+        run_census_benchmarks(benchmark_out, benchmark_out_format);
+    }
+    else
+    {
+        benchmark::RunSpecifiedBenchmarks();
+    }
     benchmark::Shutdown();
 
     return 0;
@@ -9,6 +9,20 @@ cmake_minimum_required(VERSION 3.25)
 
 include_guard()
 
+# The fix block kernels select their SIMD variants at runtime (FIX_DYNAMIC_BITSET_SIMD_DISPATCH), the binaries target a
+# portable x86-64 baseline unless they are only meant to run on the build machine
+option(CUSTOM_NATIVE_ARCHITECTURE "Optimize for the CPU of the build machine, the binaries may not run on others" OFF)
+
+# GCC and CLANG target architecture flags, the ones the compiler does not support (as on other architectures) are
+# removed by the flags check
+macro(custom_cxx_compiler_architecture_flags var)
+    if(CUSTOM_NATIVE_ARCHITECTURE)
+        set(${var} -march=native -mtune=native)
+    else()
+        set(${var} -march=x86-64-v2 -mtune=generic)
+    endif()
+endmacro()
+
 # MSVC optimization flags
 macro(custom_msvc_cxx_compiler_optimization_flags var)
     set(${var}
@@ -27,12 +41,12 @@ endmacro()
 
 # CLANG optimization flags
 macro(custom_clang_cxx_compiler_optimization_flags var)
+    custom_cxx_compiler_architecture_flags(custom_clang_architecture_flags)
     set(${var}
       ################################
       # https://clang.llvm.org/docs/CommandGuide/clang.html
       -O3
-      -march=native
-      -mtune=native
+      ${custom_clang_architecture_flags}
       ################################
       # https://clang.llvm.org/docs/UsersManual.html
       -fstrict-vtable-pointers # Turned off by default, because it is still experimental
@@ -53,12 +67,12 @@ endmacro()
 
 # GCC optimization flags
 macro(custom_gcc_cxx_compiler_optimization_flags var)
+    custom_cxx_compiler_architecture_flags(custom_gcc_architecture_flags)
     set(${var}
       ################################
       # https://gcc.gnu.org/onlinedocs/gcc/x86-Options.html
       -O3
-      -march=native
-      -mtune=native
+      ${custom_gcc_architecture_flags}
       ################################
       # https://gcc.gnu.org/onlinedocs/gcc/Optimize-Options.html
       -fmodulo-sched
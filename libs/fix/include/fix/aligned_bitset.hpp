@@ -0,0 +1,555 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/bitset_traits.hpp>
+#include <fix/kernels.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// Reference dynamic bitset for the fix kernels.
+//
+// The blocks are stored in whole cache lines aligned on a cache line, the bits after size() up to the end of the
+// last line are always off. The bulk operations run on whole lines: no masking of the last block, no scalar tail,
+// the SIMD kernels selected at runtime (see kernels_simd.hpp) process all the blocks with aligned vectors.
+// The fix adapters use these operations through the bitset_traits hooks, and the fix kernels for the others.
+namespace fix
+{
+    namespace detail
+    {
+        // allocator of storage aligned on alignment bytes, not final: std::vector derives from its allocator
+        template<typename T, size_t alignment>
+        struct aligned_allocator
+        {
+            using value_type = T;
+
+            template<typename U>
+            struct rebind
+            {
+                using other = aligned_allocator<U, alignment>;
+            };
+
+            aligned_allocator() noexcept = default;
+            template<typename U>
+            aligned_allocator(const aligned_allocator<U, alignment>&) noexcept
+            {
+            }
+
+            [[nodiscard]] T* allocate(size_t n)
+            {
+                return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignment)));
+            }
+
+            void deallocate(T* pointer, size_t) noexcept
+            {
+                ::operator delete(pointer, std::align_val_t(alignment));
+            }
+
+            template<typename U>
+            [[nodiscard]] bool operator==(const aligned_allocator<U, alignment>&) const noexcept
+            {
+                return true;
+            }
+        };
+    } // namespace detail
+
+    template<std::unsigned_integral block_t = uint64_t>
+    class aligned_bitset final
+    {
+    public:
+        using block_type = block_t;
+        using size_type = size_t;
+
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+        static constexpr size_t bits_per_block = dynamic_bitset::kernels::bits_per_block<block_t>;
+        // bytes of a cache line, the unit of allocation and of the bulk operations
+        static constexpr size_t line_size = 64;
+        static constexpr size_t blocks_per_line = line_size / sizeof(block_t);
+        static constexpr size_t bits_per_line = line_size * CHAR_BIT;
+
+        class reference final
+        {
+        public:
+            reference(aligned_bitset& bitset, size_t pos) noexcept
+              : m_bitset(bitset)
+              , m_pos(pos)
+            {
+            }
+
+            reference(const reference&) noexcept = default;
+
+            reference& operator=(bool value) noexcept
+            {
+                m_bitset.set(m_pos, value);
+                return *this;
+            }
+
+            reference& operator=(const reference& other) noexcept
+            {
+                m_bitset.set(m_pos, static_cast<bool>(other));
+                return *this;
+            }
+
+            [[nodiscard]] operator bool() const noexcept
+            {
+                return m_bitset.test(m_pos);
+            }
+
+            [[nodiscard]] bool operator~() const noexcept
+            {
+                return !m_bitset.test(m_pos);
+            }
+
+            reference& flip() noexcept
+            {
+                m_bitset.flip(m_pos);
+                return *this;
+            }
+
+        private:
+            aligned_bitset& m_bitset;
+            size_t m_pos;
+        };
+
+        aligned_bitset() noexcept = default;
+
+        // the first bits of init_val, the other bits off
+        explicit aligned_bitset(size_t nbits, unsigned long long init_val = 0)
+          : m_blocks(lines_blocks(nbits), block_t(0))
+          , m_size(nbits)
+        {
+            for(size_t i = 0; i < std::min(nbits, bits_number<unsigned long long>); ++i)
+            {
+                set(i, ((init_val >> i) & 1u) != 0);
+            }
+        }
+
+        // all bits of the blocks, the first block is the first bits
+        aligned_bitset(std::initializer_list<block_t> init_vals)
+          : m_blocks(lines_blocks(init_vals.size() * bits_per_block), block_t(0))
+          , m_size(init_vals.size() * bits_per_block)
+        {
+            std::copy(init_vals.begin(), init_vals.end(), m_blocks.begin());
+        }
+
+        // the last character is the first bit, characters other than one are off
+        explicit aligned_bitset(std::string_view str, char one = '1')
+          : m_blocks(lines_blocks(str.size()), block_t(0))
+          , m_size(str.size())
+        {
+            for(size_t i = 0; i < m_size; ++i)
+            {
+                if(str[m_size - 1 - i] == one)
+                {
+                    set(i);
+                }
+            }
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        // blocks holding the bits of the bitset, the padding blocks of the last line are not included
+        [[nodiscard]] size_t num_blocks() const noexcept
+        {
+            return (m_size + bits_per_block - 1) / bits_per_block;
+        }
+
+        [[nodiscard]] block_t* data() noexcept
+        {
+            return std::assume_aligned<line_size>(m_blocks.data());
+        }
+
+        [[nodiscard]] const block_t* data() const noexcept
+        {
+            return std::assume_aligned<line_size>(m_blocks.data());
+        }
+
+        // blocks up to the end of the last line
+        [[nodiscard]] std::span<block_t> lines() noexcept
+        {
+            return {data(), m_blocks.size()};
+        }
+
+        [[nodiscard]] std::span<const block_t> lines() const noexcept
+        {
+            return {data(), m_blocks.size()};
+        }
+
+        [[nodiscard]] size_t capacity() const noexcept
+        {
+            return m_blocks.capacity() * bits_per_block;
+        }
+
+        void reserve(size_t nbits)
+        {
+            m_blocks.reserve(lines_blocks(nbits));
+        }
+
+        void resize(size_t nbits, bool value = false)
+        {
+            const size_t old_size = m_size;
+            m_blocks.resize(lines_blocks(nbits), block_t(0));
+            m_size = nbits;
+            if(value && nbits > old_size)
+            {
+                const size_t first_block = old_size / bits_per_block;
+                m_blocks[first_block] |= static_cast<block_t>(~block_t(0) << (old_size % bits_per_block));
+                std::fill(m_blocks.begin() + static_cast<ptrdiff_t>(first_block + 1),
+                          m_blocks.begin() + static_cast<ptrdiff_t>(num_blocks()),
+                          static_cast<block_t>(~block_t(0)));
+            }
+            clear_padding();
+        }
+
+        void clear() noexcept
+        {
+            m_blocks.clear();
+            m_size = 0;
+        }
+
+        void push_back(bool value)
+        {
+            if(m_size == m_blocks.size() * bits_per_block)
+            {
+                m_blocks.resize(m_blocks.size() + blocks_per_line, block_t(0));
+            }
+            ++m_size;
+            set(m_size - 1, value);
+        }
+
+        void pop_back() noexcept
+        {
+            assert(!empty());
+            reset(m_size - 1);
+            --m_size;
+        }
+
+        [[nodiscard]] bool test(size_t pos) const noexcept
+        {
+            assert(pos < m_size);
+            return (m_blocks[pos / bits_per_block] & (block_t(1) << (pos % bits_per_block))) != 0;
+        }
+
+        [[nodiscard]] bool operator[](size_t pos) const noexcept
+        {
+            return test(pos);
+        }
+
+        [[nodiscard]] reference operator[](size_t pos) noexcept
+        {
+            assert(pos < m_size);
+            return reference(*this, pos);
+        }
+
+        aligned_bitset& set(size_t pos, bool value = true) noexcept
+        {
+            assert(pos < m_size);
+            const block_t mask = static_cast<block_t>(block_t(1) << (pos % bits_per_block));
+            block_t& block = m_blocks[pos / bits_per_block];
+            block = value ? static_cast<block_t>(block | mask) : static_cast<block_t>(block & ~mask);
+            return *this;
+        }
+
+        aligned_bitset& set() noexcept
+        {
+            std::fill_n(m_blocks.begin(), num_blocks(), static_cast<block_t>(~block_t(0)));
+            clear_padding();
+            return *this;
+        }
+
+        aligned_bitset& reset(size_t pos) noexcept
+        {
+            return set(pos, false);
+        }
+
+        aligned_bitset& reset() noexcept
+        {
+            std::fill(m_blocks.begin(), m_blocks.end(), block_t(0));
+            return *this;
+        }
+
+        aligned_bitset& flip(size_t pos) noexcept
+        {
+            assert(pos < m_size);
+            m_blocks[pos / bits_per_block] ^= static_cast<block_t>(block_t(1) << (pos % bits_per_block));
+            return *this;
+        }
+
+        aligned_bitset& flip() noexcept
+        {
+            for(block_t& block: lines())
+            {
+                block = static_cast<block_t>(~block);
+            }
+            clear_padding();
+            return *this;
+        }
+
+        [[nodiscard]] size_t count() const noexcept
+        {
+            const std::span<const std::byte> bytes = std::as_bytes(lines());
+            size_t result = 0;
+            const size_t done = dynamic_bitset::kernels::simd::count(bytes.data(), bytes.size(), result);
+            const std::span<const block_t> remaining = lines().subspan(done / sizeof(block_t));
+            return result + dynamic_bitset::kernels::count(remaining, remaining.size() * bits_per_block);
+        }
+
+        [[nodiscard]] bool any() const noexcept
+        {
+            const std::span<const std::byte> bytes = std::as_bytes(lines());
+            bool result = false;
+            const size_t done = dynamic_bitset::kernels::simd::any(bytes.data(), bytes.size(), result);
+            const std::span<const block_t> remaining = lines().subspan(done / sizeof(block_t));
+            return result || dynamic_bitset::kernels::any(remaining, remaining.size() * bits_per_block);
+        }
+
+        [[nodiscard]] bool none() const noexcept
+        {
+            return !any();
+        }
+
+        [[nodiscard]] bool all() const noexcept
+        {
+            return dynamic_bitset::kernels::all(lines().first(num_blocks()), m_size);
+        }
+
+        // position of the first bit on, npos if none
+        [[nodiscard]] size_t find_first() const noexcept
+        {
+            return dynamic_bitset::kernels::find_first(lines(), lines().size() * bits_per_block);
+        }
+
+        // position of the first bit on after prev, npos if none
+        [[nodiscard]] size_t find_next(size_t prev) const noexcept
+        {
+            const size_t pos = prev + 1;
+            if(pos >= m_size)
+            {
+                return npos;
+            }
+            const size_t block_index = pos / bits_per_block;
+            const block_t block = static_cast<block_t>(m_blocks[block_index] >> (pos % bits_per_block));
+            if(block != block_t(0))
+            {
+                return pos + static_cast<size_t>(std::countr_zero(block));
+            }
+            const std::span<const block_t> next_blocks = lines().subspan(block_index + 1);
+            const size_t next = dynamic_bitset::kernels::find_first(next_blocks, next_blocks.size() * bits_per_block);
+            return next == npos ? npos : (block_index + 1) * bits_per_block + next;
+        }
+
+        // call function(bit_pos, parameters...) for each bit on, stop early if function returns false
+        template<typename Function, typename... Parameters>
+        void iterate_bits_on(Function&& function, Parameters&&... parameters) const
+        {
+            dynamic_bitset::kernels::iterate_bits_on(lines().first(num_blocks()),
+                                                     m_size,
+                                                     std::forward<Function>(function),
+                                                     std::forward<Parameters>(parameters)...);
+        }
+
+        aligned_bitset& operator|=(const aligned_bitset& rhs) noexcept
+        {
+            assert(m_size == rhs.m_size);
+            dynamic_bitset::kernels::or_equal(lines(), rhs.lines());
+            return *this;
+        }
+
+        aligned_bitset& operator&=(const aligned_bitset& rhs) noexcept
+        {
+            assert(m_size == rhs.m_size);
+            dynamic_bitset::kernels::and_equal(lines(), rhs.lines());
+            return *this;
+        }
+
+        aligned_bitset& operator^=(const aligned_bitset& rhs) noexcept
+        {
+            assert(m_size == rhs.m_size);
+            dynamic_bitset::kernels::xor_equal(lines(), rhs.lines());
+            return *this;
+        }
+
+        aligned_bitset& operator-=(const aligned_bitset& rhs) noexcept
+        {
+            assert(m_size == rhs.m_size);
+            dynamic_bitset::kernels::minus_equal(lines(), rhs.lines());
+            return *this;
+        }
+
+        [[nodiscard]] aligned_bitset operator~() const
+        {
+            aligned_bitset result = *this;
+            result.flip();
+            return result;
+        }
+
+        // count(*this | rhs) without materializing the result
+        [[nodiscard]] size_t or_count(const aligned_bitset& rhs) const noexcept
+        {
+            assert(m_size == rhs.m_size);
+            return lines_transform_count<dynamic_bitset::kernels::simd::operation::bit_or>(rhs);
+        }
+
+        // count(*this & rhs) without materializing the result
+        [[nodiscard]] size_t and_count(const aligned_bitset& rhs) const noexcept
+        {
+            assert(m_size == rhs.m_size);
+            return lines_transform_count<dynamic_bitset::kernels::simd::operation::bit_and>(rhs);
+        }
+
+        // count(*this & ~rhs) without materializing the result
+        [[nodiscard]] size_t andnot_count(const aligned_bitset& rhs) const noexcept
+        {
+            assert(m_size == rhs.m_size);
+            return lines_transform_count<dynamic_bitset::kernels::simd::operation::bit_andnot>(rhs);
+        }
+
+        [[nodiscard]] bool operator==(const aligned_bitset& rhs) const noexcept
+        {
+            return m_size == rhs.m_size && m_blocks == rhs.m_blocks;
+        }
+
+    private:
+        // count of *this op rhs on whole lines, the SIMD kernels process all the lines when an instruction set is
+        // selected, the word kernels otherwise
+        template<dynamic_bitset::kernels::simd::operation op>
+        [[nodiscard]] size_t lines_transform_count(const aligned_bitset& rhs) const noexcept
+        {
+            const std::span<const std::byte> lhs_bytes = std::as_bytes(lines());
+            const std::span<const std::byte> rhs_bytes = std::as_bytes(rhs.lines());
+            size_t result = 0;
+            const size_t done = dynamic_bitset::kernels::simd::transform_count<op>(
+              lhs_bytes.data(), rhs_bytes.data(), lhs_bytes.size(), result);
+            const std::span<const block_t> lhs_remaining = lines().subspan(done / sizeof(block_t));
+            const std::span<const block_t> rhs_remaining = rhs.lines().subspan(done / sizeof(block_t));
+            return result
+                   + dynamic_bitset::kernels::detail::transform_count<op>(
+                     lhs_remaining, rhs_remaining, lhs_remaining.size() * bits_per_block);
+        }
+
+        template<typename T>
+        static constexpr size_t bits_number = sizeof(T) * CHAR_BIT;
+
+        // blocks of the whole lines holding nbits
+        [[nodiscard]] static constexpr size_t lines_blocks(size_t nbits) noexcept
+        {
+            return (nbits + bits_per_line - 1) / bits_per_line * blocks_per_line;
+        }
+
+        // turn off the bits after size()
+        void clear_padding() noexcept
+        {
+            const size_t blocks_number = num_blocks();
+            if(blocks_number > 0)
+            {
+                m_blocks[blocks_number - 1] &= dynamic_bitset::kernels::last_block_mask<block_t>(m_size);
+            }
+            std::fill(m_blocks.begin() + static_cast<ptrdiff_t>(blocks_number), m_blocks.end(), block_t(0));
+        }
+
+        std::vector<block_t, detail::aligned_allocator<block_t, line_size>> m_blocks;
+        size_t m_size = 0;
+    };
+} // namespace fix
+
+// the adapters use the whole lines operations of aligned_bitset, the fix kernels on its blocks for the others
+template<std::unsigned_integral block_t>
+struct fix::dynamic_bitset::bitset_traits<fix::aligned_bitset<block_t>>
+{
+    static constexpr storage_kind storage = storage_kind::bitset;
+
+    [[nodiscard]] static std::span<block_t> blocks(fix::aligned_bitset<block_t>& bitset) noexcept
+    {
+        return {bitset.data(), bitset.num_blocks()};
+    }
+
+    [[nodiscard]] static std::span<const block_t> blocks(const fix::aligned_bitset<block_t>& bitset) noexcept
+    {
+        return {bitset.data(), bitset.num_blocks()};
+    }
+
+    [[nodiscard]] static size_t count(const fix::aligned_bitset<block_t>& bitset) noexcept
+    {
+        return bitset.count();
+    }
+
+    static void or_equal(fix::aligned_bitset<block_t>& lhs, const fix::aligned_bitset<block_t>& rhs) noexcept
+    {
+        lhs |= rhs;
+    }
+
+    static void and_equal(fix::aligned_bitset<block_t>& lhs, const fix::aligned_bitset<block_t>& rhs) noexcept
+    {
+        lhs &= rhs;
+    }
+
+    static void xor_equal(fix::aligned_bitset<block_t>& lhs, const fix::aligned_bitset<block_t>& rhs) noexcept
+    {
+        lhs ^= rhs;
+    }
+
+    static void minus_equal(fix::aligned_bitset<block_t>& lhs, const fix::aligned_bitset<block_t>& rhs) noexcept
+    {
+        lhs -= rhs;
+    }
+
+    [[nodiscard]] static size_t or_count(const fix::aligned_bitset<block_t>& lhs,
+                                         const fix::aligned_bitset<block_t>& rhs) noexcept
+    {
+        return lhs.or_count(rhs);
+    }
+
+    [[nodiscard]] static size_t and_count(const fix::aligned_bitset<block_t>& lhs,
+                                          const fix::aligned_bitset<block_t>& rhs) noexcept
+    {
+        return lhs.and_count(rhs);
+    }
+
+    [[nodiscard]] static size_t andnot_count(const fix::aligned_bitset<block_t>& lhs,
+                                             const fix::aligned_bitset<block_t>& rhs) noexcept
+    {
+        return lhs.andnot_count(rhs);
+    }
+
+    [[nodiscard]] static bool all(const fix::aligned_bitset<block_t>& bitset) noexcept
+    {
+        return bitset.all();
+    }
+
+    [[nodiscard]] static bool none(const fix::aligned_bitset<block_t>& bitset) noexcept
+    {
+        return bitset.none();
+    }
+
+    [[nodiscard]] static bool any(const fix::aligned_bitset<block_t>& bitset) noexcept
+    {
+        return bitset.any();
+    }
+};
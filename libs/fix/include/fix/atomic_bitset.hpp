@@ -0,0 +1,585 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/bitset_traits.hpp>
+#include <fix/kernels.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Dynamic bitset updated concurrently by several threads.
+//
+// The blocks are atomics stored in whole cache lines aligned on a cache line, the bits after size() are always off.
+// Single bit operations are lock-free read-modify-writes (fetch_or, fetch_and, fetch_xor) with the given memory order,
+// test_and_set and test_and_reset tell which thread changed a bit first. Bulk operations are atomic per block with
+// relaxed ordering: they do not lose the concurrent single bit writes but are not a snapshot of the whole bitset,
+// synchronize (join, fence or release/acquire single bit operation) to publish them. The blocks unchanged by a bulk
+// operation are only loaded, so that sparse operands do not take the cache lines of the other threads.
+// Construction, assignment, resize and clear need exclusive access.
+namespace fix
+{
+    template<std::unsigned_integral block_t = uint64_t>
+    class atomic_bitset final
+    {
+    public:
+        using block_type = block_t;
+        using size_type = size_t;
+
+        static_assert(std::atomic<block_t>::is_always_lock_free, "atomic_bitset blocks must be lock-free");
+
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+        static constexpr size_t bits_per_block = dynamic_bitset::kernels::bits_per_block<block_t>;
+        // bytes of a cache line, the unit of allocation: bitsets never share a cache line
+        static constexpr size_t line_size = 64;
+        static constexpr size_t blocks_per_line = line_size / sizeof(block_t);
+        static constexpr size_t bits_per_line = line_size * CHAR_BIT;
+
+        atomic_bitset() noexcept = default;
+
+        // the first bits of init_val, the other bits off
+        explicit atomic_bitset(size_t nbits, unsigned long long init_val = 0)
+          : m_blocks(lines_blocks(nbits))
+          , m_size(nbits)
+        {
+            for(size_t i = 0; i < std::min(nbits, bits_number<unsigned long long>); ++i)
+            {
+                set(i, ((init_val >> i) & 1u) != 0, std::memory_order_relaxed);
+            }
+        }
+
+        // the last character is the first bit, characters other than one are off
+        explicit atomic_bitset(std::string_view str, char one = '1')
+          : m_blocks(lines_blocks(str.size()))
+          , m_size(str.size())
+        {
+            for(size_t i = 0; i < m_size; ++i)
+            {
+                if(str[m_size - 1 - i] == one)
+                {
+                    set(i, true, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        atomic_bitset(const atomic_bitset& other)
+          : m_blocks(other.m_blocks.size())
+          , m_size(other.m_size)
+        {
+            copy_blocks(other);
+        }
+
+        atomic_bitset(atomic_bitset&& other) noexcept
+          : m_blocks(std::move(other.m_blocks))
+          , m_size(std::exchange(other.m_size, 0))
+        {
+        }
+
+        atomic_bitset& operator=(const atomic_bitset& other)
+        {
+            if(this != &other)
+            {
+                if(m_blocks.size() != other.m_blocks.size())
+                {
+                    blocks_vector blocks(other.m_blocks.size());
+                    m_blocks.swap(blocks);
+                }
+                m_size = other.m_size;
+                copy_blocks(other);
+            }
+            return *this;
+        }
+
+        atomic_bitset& operator=(atomic_bitset&& other) noexcept
+        {
+            m_blocks = std::move(other.m_blocks);
+            m_size = std::exchange(other.m_size, 0);
+            return *this;
+        }
+
+        ~atomic_bitset() noexcept = default;
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        // blocks holding the bits of the bitset, the padding blocks of the last line are not included
+        [[nodiscard]] size_t num_blocks() const noexcept
+        {
+            return (m_size + bits_per_block - 1) / bits_per_block;
+        }
+
+        // block at index, loaded with order
+        [[nodiscard]] block_t block(size_t index, std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            assert(index < num_blocks());
+            return m_blocks[index].load(order);
+        }
+
+        // atomics are not movable: the blocks are copied to a new storage
+        void resize(size_t nbits, bool value = false)
+        {
+            const size_t old_size = m_size;
+            if(lines_blocks(nbits) != m_blocks.size())
+            {
+                blocks_vector blocks(lines_blocks(nbits));
+                const size_t kept_blocks = std::min(blocks.size(), m_blocks.size());
+                for(size_t i = 0; i < kept_blocks; ++i)
+                {
+                    blocks[i].store(m_blocks[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                }
+                m_blocks.swap(blocks);
+            }
+            m_size = nbits;
+            if(value && nbits > old_size)
+            {
+                const size_t first_block = old_size / bits_per_block;
+                m_blocks[first_block].fetch_or(static_cast<block_t>(~block_t(0) << (old_size % bits_per_block)),
+                                               std::memory_order_relaxed);
+                for(size_t i = first_block + 1; i < num_blocks(); ++i)
+                {
+                    m_blocks[i].store(static_cast<block_t>(~block_t(0)), std::memory_order_relaxed);
+                }
+            }
+            clear_padding();
+        }
+
+        void clear() noexcept
+        {
+            m_blocks.clear();
+            m_size = 0;
+        }
+
+        [[nodiscard]] bool test(size_t pos, std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            assert(pos < m_size);
+            return (m_blocks[pos / bits_per_block].load(order) & bit_mask(pos)) != 0;
+        }
+
+        [[nodiscard]] bool operator[](size_t pos) const noexcept
+        {
+            return test(pos);
+        }
+
+        atomic_bitset& set(size_t pos, bool value = true, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            if(value)
+            {
+                test_and_set(pos, order);
+            }
+            else
+            {
+                test_and_reset(pos, order);
+            }
+            return *this;
+        }
+
+        // set all bits, each block is stored once, the last one without the bits after size() so that concurrent
+        // readers never see them
+        atomic_bitset& set() noexcept
+        {
+            const size_t blocks_number = num_blocks();
+            if(blocks_number == 0)
+            {
+                return *this;
+            }
+            for(size_t i = 0; i < blocks_number - 1; ++i)
+            {
+                m_blocks[i].store(static_cast<block_t>(~block_t(0)), std::memory_order_relaxed);
+            }
+            m_blocks[blocks_number - 1].store(dynamic_bitset::kernels::last_block_mask<block_t>(m_size),
+                                              std::memory_order_relaxed);
+            return *this;
+        }
+
+        atomic_bitset& reset(size_t pos, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            test_and_reset(pos, order);
+            return *this;
+        }
+
+        atomic_bitset& reset() noexcept
+        {
+            for(std::atomic<block_t>& block: m_blocks)
+            {
+                block.store(block_t(0), std::memory_order_relaxed);
+            }
+            return *this;
+        }
+
+        atomic_bitset& flip(size_t pos, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            test_and_flip(pos, order);
+            return *this;
+        }
+
+        atomic_bitset& flip() noexcept
+        {
+            const size_t blocks_number = num_blocks();
+            for(size_t i = 0; i < blocks_number; ++i)
+            {
+                const block_t mask = i == blocks_number - 1
+                                       ? dynamic_bitset::kernels::last_block_mask<block_t>(m_size)
+                                       : static_cast<block_t>(~block_t(0));
+                m_blocks[i].fetch_xor(mask, std::memory_order_relaxed);
+            }
+            return *this;
+        }
+
+        // set the bit, return its previous value: only one of the threads setting an off bit gets false
+        bool test_and_set(size_t pos, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            assert(pos < m_size);
+            const block_t mask = bit_mask(pos);
+            return (m_blocks[pos / bits_per_block].fetch_or(mask, order) & mask) != 0;
+        }
+
+        // reset the bit, return its previous value: only one of the threads resetting an on bit gets true
+        bool test_and_reset(size_t pos, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            assert(pos < m_size);
+            const block_t mask = bit_mask(pos);
+            return (m_blocks[pos / bits_per_block].fetch_and(static_cast<block_t>(~mask), order) & mask) != 0;
+        }
+
+        // flip the bit, return its previous value
+        bool test_and_flip(size_t pos, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            assert(pos < m_size);
+            const block_t mask = bit_mask(pos);
+            return (m_blocks[pos / bits_per_block].fetch_xor(mask, order) & mask) != 0;
+        }
+
+        [[nodiscard]] size_t count() const noexcept
+        {
+            size_t result = 0;
+            for_each_block([&](size_t, block_t block) noexcept
+                           { result += static_cast<size_t>(std::popcount(block)); });
+            return result;
+        }
+
+        [[nodiscard]] bool any() const noexcept
+        {
+            return find_first() != npos;
+        }
+
+        [[nodiscard]] bool none() const noexcept
+        {
+            return !any();
+        }
+
+        [[nodiscard]] bool all() const noexcept
+        {
+            const size_t blocks_number = num_blocks();
+            for(size_t i = 0; i < blocks_number; ++i)
+            {
+                const block_t mask = i == blocks_number - 1
+                                       ? dynamic_bitset::kernels::last_block_mask<block_t>(m_size)
+                                       : static_cast<block_t>(~block_t(0));
+                if(m_blocks[i].load(std::memory_order_relaxed) != mask)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // position of the first bit on, npos if none
+        [[nodiscard]] size_t find_first() const noexcept
+        {
+            return find_from_block(0);
+        }
+
+        // position of the first bit on after prev, npos if none
+        [[nodiscard]] size_t find_next(size_t prev) const noexcept
+        {
+            const size_t pos = prev + 1;
+            if(pos >= m_size)
+            {
+                return npos;
+            }
+            const size_t block_index = pos / bits_per_block;
+            const block_t block =
+              static_cast<block_t>(m_blocks[block_index].load(std::memory_order_relaxed) >> (pos % bits_per_block));
+            if(block != block_t(0))
+            {
+                return pos + static_cast<size_t>(std::countr_zero(block));
+            }
+            return find_from_block(block_index + 1);
+        }
+
+        // call function(bit_pos, parameters...) for each bit on, stop early if function returns false
+        // each block is loaded once, bits changed in a block already visited are not seen
+        template<typename Function, typename... Parameters>
+        void iterate_bits_on(Function&& function, Parameters&&... parameters) const
+        {
+            const size_t blocks_number = num_blocks();
+            for(size_t i = 0; i < blocks_number; ++i)
+            {
+                block_t block = m_blocks[i].load(std::memory_order_relaxed);
+                while(block != block_t(0))
+                {
+                    const size_t bit_pos = i * bits_per_block + static_cast<size_t>(std::countr_zero(block));
+                    block &= static_cast<block_t>(block - 1);
+                    if constexpr(std::same_as<std::invoke_result_t<Function, size_t, Parameters...>, void>)
+                    {
+                        std::invoke(std::forward<Function>(function), bit_pos, std::forward<Parameters>(parameters)...);
+                    }
+                    else
+                    {
+                        if(!std::invoke(
+                             std::forward<Function>(function), bit_pos, std::forward<Parameters>(parameters)...))
+                        {
+                            return;
+                        }
+                    }
+                }
+            }
+        }
+
+        atomic_bitset& operator|=(const atomic_bitset& rhs) noexcept
+        {
+            assert(m_size == rhs.m_size);
+            update_blocks(
+              rhs,
+              [](block_t block, block_t rhs_block) noexcept { return static_cast<block_t>(block | rhs_block); },
+              [](std::atomic<block_t>& block, block_t rhs_block) noexcept
+              { block.fetch_or(rhs_block, std::memory_order_relaxed); });
+            return *this;
+        }
+
+        atomic_bitset& operator&=(const atomic_bitset& rhs) noexcept
+        {
+            assert(m_size == rhs.m_size);
+            update_blocks(
+              rhs,
+              [](block_t block, block_t rhs_block) noexcept { return static_cast<block_t>(block & rhs_block); },
+              [](std::atomic<block_t>& block, block_t rhs_block) noexcept
+              { block.fetch_and(rhs_block, std::memory_order_relaxed); });
+            return *this;
+        }
+
+        atomic_bitset& operator^=(const atomic_bitset& rhs) noexcept
+        {
+            assert(m_size == rhs.m_size);
+            update_blocks(
+              rhs,
+              [](block_t block, block_t rhs_block) noexcept { return static_cast<block_t>(block ^ rhs_block); },
+              [](std::atomic<block_t>& block, block_t rhs_block) noexcept
+              { block.fetch_xor(rhs_block, std::memory_order_relaxed); });
+            return *this;
+        }
+
+        atomic_bitset& operator-=(const atomic_bitset& rhs) noexcept
+        {
+            assert(m_size == rhs.m_size);
+            update_blocks(
+              rhs,
+              [](block_t block, block_t rhs_block) noexcept { return static_cast<block_t>(block & ~rhs_block); },
+              [](std::atomic<block_t>& block, block_t rhs_block) noexcept
+              { block.fetch_and(static_cast<block_t>(~rhs_block), std::memory_order_relaxed); });
+            return *this;
+        }
+
+        [[nodiscard]] atomic_bitset operator~() const
+        {
+            atomic_bitset result = *this;
+            result.flip();
+            return result;
+        }
+
+        // count(*this | rhs) without materializing the result
+        [[nodiscard]] size_t or_count(const atomic_bitset& rhs) const noexcept
+        {
+            assert(m_size == rhs.m_size);
+            return transform_count(
+              rhs, [](block_t block, block_t rhs_block) noexcept { return static_cast<block_t>(block | rhs_block); });
+        }
+
+        // count(*this & rhs) without materializing the result
+        [[nodiscard]] size_t and_count(const atomic_bitset& rhs) const noexcept
+        {
+            assert(m_size == rhs.m_size);
+            return transform_count(
+              rhs, [](block_t block, block_t rhs_block) noexcept { return static_cast<block_t>(block & rhs_block); });
+        }
+
+        // count(*this & ~rhs) without materializing the result
+        [[nodiscard]] size_t andnot_count(const atomic_bitset& rhs) const noexcept
+        {
+            assert(m_size == rhs.m_size);
+            return transform_count(
+              rhs, [](block_t block, block_t rhs_block) noexcept { return static_cast<block_t>(block & ~rhs_block); });
+        }
+
+        [[nodiscard]] bool operator==(const atomic_bitset& rhs) const noexcept
+        {
+            if(m_size != rhs.m_size)
+            {
+                return false;
+            }
+            const size_t blocks_number = num_blocks();
+            for(size_t i = 0; i < blocks_number; ++i)
+            {
+                if(m_blocks[i].load(std::memory_order_relaxed) != rhs.m_blocks[i].load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        // std::atomic is neither copyable nor movable: the vector is only created with its size, swapped or moved
+        using blocks_vector =
+          std::vector<std::atomic<block_t>, detail::aligned_allocator<std::atomic<block_t>, line_size>>;
+
+        template<typename T>
+        static constexpr size_t bits_number = sizeof(T) * CHAR_BIT;
+
+        // blocks of the whole lines holding nbits
+        [[nodiscard]] static constexpr size_t lines_blocks(size_t nbits) noexcept
+        {
+            return (nbits + bits_per_line - 1) / bits_per_line * blocks_per_line;
+        }
+
+        [[nodiscard]] static constexpr block_t bit_mask(size_t pos) noexcept
+        {
+            return static_cast<block_t>(block_t(1) << (pos % bits_per_block));
+        }
+
+        // call function(index, block) for each block holding bits of the bitset, blocks loaded relaxed
+        template<typename Function>
+        void for_each_block(Function&& function) const noexcept
+        {
+            const size_t blocks_number = num_blocks();
+            for(size_t i = 0; i < blocks_number; ++i)
+            {
+                function(i, m_blocks[i].load(std::memory_order_relaxed));
+            }
+        }
+
+        // position of the first bit on from the block at first_block, npos if none
+        [[nodiscard]] size_t find_from_block(size_t first_block) const noexcept
+        {
+            const size_t blocks_number = num_blocks();
+            for(size_t i = first_block; i < blocks_number; ++i)
+            {
+                const block_t block = m_blocks[i].load(std::memory_order_relaxed);
+                if(block != block_t(0))
+                {
+                    return i * bits_per_block + static_cast<size_t>(std::countr_zero(block));
+                }
+            }
+            return npos;
+        }
+
+        // block = block op rhs_block for each block, with update(block, rhs_block) only when the loaded block changes:
+        // a block that would be unchanged is not written, the operation is ordered before concurrent writes to it
+        template<typename Operation, typename Update>
+        void update_blocks(const atomic_bitset& rhs, Operation&& operation, Update&& update) noexcept
+        {
+            const size_t blocks_number = num_blocks();
+            for(size_t i = 0; i < blocks_number; ++i)
+            {
+                const block_t rhs_block = rhs.m_blocks[i].load(std::memory_order_relaxed);
+                const block_t block = m_blocks[i].load(std::memory_order_relaxed);
+                if(operation(block, rhs_block) != block)
+                {
+                    update(m_blocks[i], rhs_block);
+                }
+            }
+        }
+
+        // popcount of operation(block, rhs_block) over the blocks, blocks loaded relaxed
+        template<typename Operation>
+        [[nodiscard]] size_t transform_count(const atomic_bitset& rhs, Operation&& operation) const noexcept
+        {
+            size_t result = 0;
+            for_each_block(
+              [&](size_t i, block_t block) noexcept
+              {
+                  const block_t rhs_block = rhs.m_blocks[i].load(std::memory_order_relaxed);
+                  result += static_cast<size_t>(std::popcount(operation(block, rhs_block)));
+              });
+            return result;
+        }
+
+        // m_blocks has the size of other.m_blocks
+        void copy_blocks(const atomic_bitset& other) noexcept
+        {
+            for(size_t i = 0; i < m_blocks.size(); ++i)
+            {
+                m_blocks[i].store(other.m_blocks[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+        }
+
+        // turn off the bits after size()
+        void clear_padding() noexcept
+        {
+            const size_t blocks_number = num_blocks();
+            if(blocks_number > 0)
+            {
+                m_blocks[blocks_number - 1].fetch_and(dynamic_bitset::kernels::last_block_mask<block_t>(m_size),
+                                                      std::memory_order_relaxed);
+            }
+            for(size_t i = blocks_number; i < m_blocks.size(); ++i)
+            {
+                m_blocks[i].store(block_t(0), std::memory_order_relaxed);
+            }
+        }
+
+        blocks_vector m_blocks;
+        size_t m_size = 0;
+    };
+} // namespace fix
+
+// the blocks are atomics, not exposed to the kernels: the adapters use the members of atomic_bitset, the hooks avoid
+// the temporary bitset of the fused counts
+template<std::unsigned_integral block_t>
+struct fix::dynamic_bitset::bitset_traits<fix::atomic_bitset<block_t>>
+{
+    static constexpr storage_kind storage = storage_kind::bitset;
+
+    [[nodiscard]] static size_t or_count(const fix::atomic_bitset<block_t>& lhs,
+                                         const fix::atomic_bitset<block_t>& rhs) noexcept
+    {
+        return lhs.or_count(rhs);
+    }
+
+    [[nodiscard]] static size_t and_count(const fix::atomic_bitset<block_t>& lhs,
+                                          const fix::atomic_bitset<block_t>& rhs) noexcept
+    {
+        return lhs.and_count(rhs);
+    }
+
+    [[nodiscard]] static size_t andnot_count(const fix::atomic_bitset<block_t>& lhs,
+                                             const fix::atomic_bitset<block_t>& rhs) noexcept
+    {
+        return lhs.andnot_count(rhs);
+    }
+};
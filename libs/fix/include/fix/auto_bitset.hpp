@@ -0,0 +1,886 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/aligned_bitset.hpp>
+#include <fix/bitset_traits.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/roaring_bitset.hpp>
+#include <fix/small_bitset.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Dynamic bitset choosing its representation among the fix backends when it gets its size.
+//
+// The representations are dense blocks of 16, 32 or 64 bits (fix::aligned_bitset), a small buffer
+// (fix::small_bitset) or a compressed bitset (fix::roaring_bitset). The one of a bitset is picked from the default
+// calibration table at construction, or when an empty bitset is resized, for its size and the expected density of its
+// bits on given to them (0.5 without it), and is kept afterwards. The table gives the fastest representation measured
+// for each size and density by the calibration mode of dynamic_bitset_benchmarks_base, it is loaded at startup before
+// constructing bitsets.
+// The operations go through the fix adapters of the representation, the ones between two bitsets of different
+// representations go through the bits on of one of them, without converting it.
+namespace fix
+{
+    enum class auto_bitset_representation : uint8_t
+    {
+        aligned_uint16,
+        aligned_uint32,
+        aligned_uint64,
+        small_uint64,
+        roaring,
+    };
+
+    constexpr size_t auto_bitset_representations_number = static_cast<size_t>(auto_bitset_representation::roaring) + 1;
+
+    // name of the backend of the representation, as in the benchmarks and the calibration tables
+    [[nodiscard]] constexpr std::string_view
+    auto_bitset_representation_name(auto_bitset_representation representation) noexcept
+    {
+        constexpr std::array<std::string_view, auto_bitset_representations_number> names = {
+          "fix::aligned_bitset<uint16_t>",
+          "fix::aligned_bitset<uint32_t>",
+          "fix::aligned_bitset<uint64_t>",
+          "fix::small_bitset<uint64_t>",
+          "fix::roaring_bitset",
+        };
+        return names[static_cast<size_t>(representation)];
+    }
+
+    [[nodiscard]] constexpr std::optional<auto_bitset_representation>
+    auto_bitset_representation_from_name(std::string_view name) noexcept
+    {
+        for(size_t i = 0; i < auto_bitset_representations_number; ++i)
+        {
+            const auto representation = static_cast<auto_bitset_representation>(i);
+            if(auto_bitset_representation_name(representation) == name)
+            {
+                return representation;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // Fastest representation of fix::auto_bitset for each calibrated bitset size and density.
+    //
+    // Text format: one "bits density_inverse representation_name" line per entry, with one bit on in density_inverse,
+    // empty lines and lines starting with # are ignored.
+    class auto_bitset_calibration final
+    {
+    public:
+        struct entry
+        {
+            size_t bits;
+            size_t density_inverse;
+            auto_bitset_representation representation;
+        };
+
+        // representation without calibration: the small buffer for the sizes it stores inline, 64 bits blocks otherwise
+        [[nodiscard]] static constexpr auto_bitset_representation default_representation(size_t bits) noexcept
+        {
+            return bits <= small_bitset<uint64_t>::inline_blocks * small_bitset<uint64_t>::bits_per_block
+                     ? auto_bitset_representation::small_uint64
+                     : auto_bitset_representation::aligned_uint64;
+        }
+
+        // representation of the entries of the smallest calibrated size of at least bits bits, of the largest size for
+        // larger bitsets, with the density inverse closest to 1 / density
+        [[nodiscard]] auto_bitset_representation representation(size_t bits, double density = 0.5) const noexcept
+        {
+            if(m_entries.empty())
+            {
+                return default_representation(bits);
+            }
+
+            auto size_entries = std::ranges::lower_bound(m_entries, bits, {}, &entry::bits);
+            if(size_entries == m_entries.end())
+            {
+                size_entries = std::ranges::lower_bound(m_entries, m_entries.back().bits, {}, &entry::bits);
+            }
+            const double log_density_inverse =
+              density > 0 ? -std::log(density) : std::log(std::numeric_limits<double>::max());
+            const auto distance = [&](const entry& size_entry) noexcept
+            { return std::abs(std::log(static_cast<double>(size_entry.density_inverse)) - log_density_inverse); };
+
+            auto best = size_entries;
+            for(auto it = size_entries; it != m_entries.end() && it->bits == size_entries->bits; ++it)
+            {
+                if(distance(*it) < distance(*best))
+                {
+                    best = it;
+                }
+            }
+            return best->representation;
+        }
+
+        // add the entry, or replace the one of the same size and density
+        void set(size_t bits, size_t density_inverse, auto_bitset_representation representation)
+        {
+            assert(density_inverse > 0);
+            const auto it = std::ranges::lower_bound(m_entries,
+                                                     std::pair(bits, density_inverse),
+                                                     {},
+                                                     [](const entry& e) noexcept
+                                                     { return std::pair(e.bits, e.density_inverse); });
+            if(it != m_entries.end() && it->bits == bits && it->density_inverse == density_inverse)
+            {
+                it->representation = representation;
+            }
+            else
+            {
+                m_entries.insert(it, entry{bits, density_inverse, representation});
+            }
+        }
+
+        // entries sorted by size then density inverse
+        [[nodiscard]] std::span<const entry> entries() const noexcept
+        {
+            return m_entries;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_entries.empty();
+        }
+
+        void clear() noexcept
+        {
+            m_entries.clear();
+        }
+
+        // false if the table is invalid, the calibration is then left unchanged
+        [[nodiscard]] bool load(std::istream& input)
+        {
+            auto_bitset_calibration loaded;
+            std::string line;
+            while(std::getline(input, line))
+            {
+                if(line.empty() || line.front() == '#')
+                {
+                    continue;
+                }
+                std::istringstream line_stream(line);
+                size_t bits = 0;
+                size_t density_inverse = 0;
+                std::string name;
+                if(!(line_stream >> bits >> density_inverse >> name) || density_inverse == 0)
+                {
+                    return false;
+                }
+                const std::optional<auto_bitset_representation> representation =
+                  auto_bitset_representation_from_name(name);
+                if(!representation)
+                {
+                    return false;
+                }
+                loaded.set(bits, density_inverse, *representation);
+            }
+            if(input.bad())
+            {
+                return false;
+            }
+            *this = std::move(loaded);
+            return true;
+        }
+
+        void save(std::ostream& output) const
+        {
+            output << "# fix::auto_bitset calibration: bits density_inverse representation\n";
+            for(const entry& e: m_entries)
+            {
+                output << e.bits << ' ' << e.density_inverse << ' ' << auto_bitset_representation_name(e.representation)
+                       << '\n';
+            }
+        }
+
+    private:
+        std::vector<entry> m_entries;
+    };
+
+    // calibration used by fix::auto_bitset, not synchronized: load it before constructing bitsets in other threads
+    [[nodiscard]] inline auto_bitset_calibration& auto_bitset_default_calibration() noexcept
+    {
+        static auto_bitset_calibration calibration;
+        return calibration;
+    }
+
+    class auto_bitset final
+    {
+    public:
+        using size_type = size_t;
+
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+        class reference final
+        {
+        public:
+            reference(auto_bitset& bitset, size_t pos) noexcept
+              : m_bitset(bitset)
+              , m_pos(pos)
+            {
+            }
+
+            reference(const reference&) noexcept = default;
+
+            reference& operator=(bool value)
+            {
+                m_bitset.set(m_pos, value);
+                return *this;
+            }
+
+            reference& operator=(const reference& other)
+            {
+                m_bitset.set(m_pos, static_cast<bool>(other));
+                return *this;
+            }
+
+            [[nodiscard]] operator bool() const noexcept
+            {
+                return m_bitset.test(m_pos);
+            }
+
+            [[nodiscard]] bool operator~() const noexcept
+            {
+                return !m_bitset.test(m_pos);
+            }
+
+            reference& flip()
+            {
+                m_bitset.flip(m_pos);
+                return *this;
+            }
+
+        private:
+            auto_bitset& m_bitset;
+            size_t m_pos;
+        };
+
+        // expected fraction of the bits on, hint of the representation of the calibration
+        struct expected_density final
+        {
+            double value;
+        };
+
+        auto_bitset() noexcept = default;
+
+        // the first bits of init_val, the other bits off, in the representation of the calibration for nbits bits
+        explicit auto_bitset(size_t nbits, unsigned long long init_val = 0)
+          : auto_bitset(nbits, expected_density{0.5}, init_val)
+        {
+        }
+
+        // the first bits of init_val, the other bits off, in the representation of the calibration for nbits bits of
+        // the given density
+        auto_bitset(size_t nbits, expected_density density, unsigned long long init_val = 0)
+          : auto_bitset(nbits, auto_bitset_default_calibration().representation(nbits, density.value), init_val)
+        {
+        }
+
+        // the first bits of init_val, the other bits off, in the given representation
+        auto_bitset(size_t nbits, auto_bitset_representation representation, unsigned long long init_val = 0)
+          : m_bitset(make_bitset(representation, nbits, init_val))
+        {
+        }
+
+        // the last character is the first bit, characters other than one are off
+        explicit auto_bitset(std::string_view str, char one = '1')
+          : auto_bitset(str.size())
+        {
+            for(size_t i = 0; i < str.size(); ++i)
+            {
+                if(str[str.size() - 1 - i] == one)
+                {
+                    set(i);
+                }
+            }
+        }
+
+        [[nodiscard]] auto_bitset_representation representation() const noexcept
+        {
+            return static_cast<auto_bitset_representation>(m_bitset.index());
+        }
+
+        // function(bitset) with the bitset of the representation, as a fix::aligned_bitset, fix::small_bitset or
+        // fix::roaring_bitset
+        template<typename Function>
+        decltype(auto) visit(Function&& function)
+        {
+            return std::visit(std::forward<Function>(function), m_bitset);
+        }
+
+        template<typename Function>
+        decltype(auto) visit(Function&& function) const
+        {
+            return std::visit(std::forward<Function>(function), m_bitset);
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return visit([](const auto& bitset) noexcept { return bitset.size(); });
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        // bytes used by the bitset: the object and the storage of the representation
+        [[nodiscard]] size_t memory_footprint() const noexcept
+        {
+            return visit(
+              [](const auto& bitset) noexcept
+              {
+                  using bitset_t = std::remove_cvref_t<decltype(bitset)>;
+                  if constexpr(requires { bitset.memory_footprint(); })
+                  {
+                      return sizeof(auto_bitset) - sizeof(bitset_t) + bitset.memory_footprint();
+                  }
+                  else if constexpr(requires { bitset.is_inline(); })
+                  {
+                      return sizeof(auto_bitset) + (bitset.is_inline() ? 0 : bitset.capacity() / CHAR_BIT);
+                  }
+                  else
+                  {
+                      return sizeof(auto_bitset) + bitset.capacity() / CHAR_BIT;
+                  }
+              });
+        }
+
+        // an empty bitset takes the representation of the calibration for nbits bits
+        void resize(size_t nbits, bool value = false)
+        {
+            resize(nbits, expected_density{0.5}, value);
+        }
+
+        // an empty bitset takes the representation of the calibration for nbits bits of the given density
+        void resize(size_t nbits, expected_density density, bool value = false)
+        {
+            if(empty() && nbits != 0)
+            {
+                m_bitset = make_bitset(auto_bitset_default_calibration().representation(nbits, density.value), 0, 0);
+            }
+            visit([&](auto& bitset) { bitset.resize(nbits, value); });
+        }
+
+        // an empty bitset takes the representation of the calibration for nbits bits
+        void reserve(size_t nbits)
+        {
+            reserve(nbits, expected_density{0.5});
+        }
+
+        // an empty bitset takes the representation of the calibration for nbits bits of the given density
+        void reserve(size_t nbits, expected_density density)
+        {
+            if(empty() && nbits != 0)
+            {
+                m_bitset = make_bitset(auto_bitset_default_calibration().representation(nbits, density.value), 0, 0);
+            }
+            visit(
+              [&](auto& bitset)
+              {
+                  if constexpr(requires { bitset.reserve(nbits); })
+                  {
+                      bitset.reserve(nbits);
+                  }
+              });
+        }
+
+        void clear() noexcept
+        {
+            visit([](auto& bitset) noexcept { bitset.clear(); });
+        }
+
+        // a default constructed bitset takes the representation of the calibration for its first bit
+        void push_back(bool value)
+        {
+            if(const aligned_bitset<uint16_t>* bitset = std::get_if<aligned_bitset<uint16_t>>(&m_bitset);
+               bitset != nullptr && bitset->empty() && bitset->capacity() == 0)
+            {
+                m_bitset = make_bitset(auto_bitset_default_calibration().representation(1), 0, 0);
+            }
+            visit([&](auto& bitset) { bitset.push_back(value); });
+        }
+
+        void pop_back()
+        {
+            visit([](auto& bitset) { bitset.pop_back(); });
+        }
+
+        [[nodiscard]] bool test(size_t pos) const noexcept
+        {
+            return visit([&](const auto& bitset) noexcept { return bitset.test(pos); });
+        }
+
+        [[nodiscard]] bool operator[](size_t pos) const noexcept
+        {
+            return test(pos);
+        }
+
+        [[nodiscard]] reference operator[](size_t pos) noexcept
+        {
+            return reference(*this, pos);
+        }
+
+        auto_bitset& set(size_t pos, bool value = true)
+        {
+            visit([&](auto& bitset) { bitset.set(pos, value); });
+            return *this;
+        }
+
+        auto_bitset& set()
+        {
+            visit([](auto& bitset) { bitset.set(); });
+            return *this;
+        }
+
+        auto_bitset& reset(size_t pos)
+        {
+            visit([&](auto& bitset) { bitset.reset(pos); });
+            return *this;
+        }
+
+        auto_bitset& reset() noexcept
+        {
+            visit([](auto& bitset) noexcept { bitset.reset(); });
+            return *this;
+        }
+
+        auto_bitset& flip(size_t pos)
+        {
+            visit([&](auto& bitset) { bitset.flip(pos); });
+            return *this;
+        }
+
+        auto_bitset& flip()
+        {
+            visit([](auto& bitset) { bitset.flip(); });
+            return *this;
+        }
+
+        [[nodiscard]] size_t count() const noexcept
+        {
+            return visit([](const auto& bitset) noexcept { return dynamic_bitset::do_count(bitset); });
+        }
+
+        [[nodiscard]] bool any() const noexcept
+        {
+            return visit([](const auto& bitset) noexcept { return dynamic_bitset::do_any(bitset); });
+        }
+
+        [[nodiscard]] bool none() const noexcept
+        {
+            return visit([](const auto& bitset) noexcept { return dynamic_bitset::do_none(bitset); });
+        }
+
+        [[nodiscard]] bool all() const noexcept
+        {
+            return visit([](const auto& bitset) noexcept { return dynamic_bitset::do_all(bitset); });
+        }
+
+        [[nodiscard]] size_t find_first() const noexcept
+        {
+            return visit(
+              [](const auto& bitset) noexcept
+              {
+                  const size_t first = dynamic_bitset::do_find_first(bitset);
+                  return first < bitset.size() ? first : npos;
+              });
+        }
+
+        [[nodiscard]] size_t find_next(size_t prev) const noexcept
+        {
+            return visit(
+              [&](const auto& bitset) noexcept
+              {
+                  const size_t next = bitset.find_next(prev);
+                  return next < bitset.size() ? next : npos;
+              });
+        }
+
+        // call function(bit_pos, parameters...) for each bit on, stop early if function returns false
+        template<typename Function, typename... Parameters>
+        void iterate_bits_on(Function&& function, Parameters&&... parameters) const
+        {
+            visit(
+              [&](const auto& bitset)
+              {
+                  dynamic_bitset::do_iterate_bits_on(
+                    bitset, std::forward<Function>(function), std::forward<Parameters>(parameters)...);
+              });
+        }
+
+        // give a fix::roaring_bitset representation its smallest form, nothing for the others
+        void optimize()
+        {
+            if(roaring_bitset* bitset = std::get_if<roaring_bitset>(&m_bitset))
+            {
+                bitset->optimize();
+            }
+        }
+
+        auto_bitset& operator|=(const auto_bitset& rhs)
+        {
+            assert(size() == rhs.size());
+            visit_with(
+              *this,
+              rhs,
+              [](auto& lhs_bitset, const auto& rhs_bitset) { dynamic_bitset::do_or_equal(lhs_bitset, rhs_bitset); },
+              [](auto& lhs_bitset, const auto& rhs_bitset) { mixed_or_equal(lhs_bitset, rhs_bitset); });
+            return *this;
+        }
+
+        auto_bitset& operator&=(const auto_bitset& rhs)
+        {
+            assert(size() == rhs.size());
+            visit_with(
+              *this,
+              rhs,
+              [](auto& lhs_bitset, const auto& rhs_bitset) { dynamic_bitset::do_and_equal(lhs_bitset, rhs_bitset); },
+              [](auto& lhs_bitset, const auto& rhs_bitset) { mixed_and_equal(lhs_bitset, rhs_bitset); });
+            return *this;
+        }
+
+        auto_bitset& operator^=(const auto_bitset& rhs)
+        {
+            assert(size() == rhs.size());
+            visit_with(
+              *this,
+              rhs,
+              [](auto& lhs_bitset, const auto& rhs_bitset) { dynamic_bitset::do_xor_equal(lhs_bitset, rhs_bitset); },
+              [](auto& lhs_bitset, const auto& rhs_bitset) { mixed_xor_equal(lhs_bitset, rhs_bitset); });
+            return *this;
+        }
+
+        auto_bitset& operator-=(const auto_bitset& rhs)
+        {
+            assert(size() == rhs.size());
+            visit_with(
+              *this,
+              rhs,
+              [](auto& lhs_bitset, const auto& rhs_bitset) { dynamic_bitset::do_minus_equal(lhs_bitset, rhs_bitset); },
+              [](auto& lhs_bitset, const auto& rhs_bitset) { mixed_minus_equal(lhs_bitset, rhs_bitset); });
+            return *this;
+        }
+
+        [[nodiscard]] auto_bitset operator~() const
+        {
+            auto_bitset result;
+            result.m_bitset = visit([](const auto& bitset) { return variant_type(~bitset); });
+            return result;
+        }
+
+        [[nodiscard]] size_t and_count(const auto_bitset& rhs) const
+        {
+            assert(size() == rhs.size());
+            return visit_with(*this,
+                              rhs,
+                              [](const auto& lhs_bitset, const auto& rhs_bitset) noexcept
+                              { return dynamic_bitset::do_and_count(lhs_bitset, rhs_bitset); },
+                              [](const auto& lhs_bitset, const auto& rhs_bitset) noexcept
+                              { return mixed_and_count(lhs_bitset, rhs_bitset); });
+        }
+
+        [[nodiscard]] size_t or_count(const auto_bitset& rhs) const
+        {
+            assert(size() == rhs.size());
+            return visit_with(*this,
+                              rhs,
+                              [](const auto& lhs_bitset, const auto& rhs_bitset) noexcept
+                              { return dynamic_bitset::do_or_count(lhs_bitset, rhs_bitset); },
+                              [](const auto& lhs_bitset, const auto& rhs_bitset) noexcept
+                              { return mixed_or_count(lhs_bitset, rhs_bitset); });
+        }
+
+        [[nodiscard]] size_t andnot_count(const auto_bitset& rhs) const
+        {
+            assert(size() == rhs.size());
+            return visit_with(*this,
+                              rhs,
+                              [](const auto& lhs_bitset, const auto& rhs_bitset) noexcept
+                              { return dynamic_bitset::do_andnot_count(lhs_bitset, rhs_bitset); },
+                              [](const auto& lhs_bitset, const auto& rhs_bitset) noexcept
+                              { return mixed_andnot_count(lhs_bitset, rhs_bitset); });
+        }
+
+        [[nodiscard]] bool operator==(const auto_bitset& rhs) const
+        {
+            return size() == rhs.size()
+                   && visit_with(*this,
+                                 rhs,
+                                 [](const auto& lhs_bitset, const auto& rhs_bitset) noexcept
+                                 { return lhs_bitset == rhs_bitset; },
+                                 [](const auto& lhs_bitset, const auto& rhs_bitset) noexcept
+                                 {
+                                     const size_t lhs_count = dynamic_bitset::do_count(lhs_bitset);
+                                     return lhs_count == dynamic_bitset::do_count(rhs_bitset)
+                                            && lhs_count == mixed_and_count(lhs_bitset, rhs_bitset);
+                                 });
+        }
+
+    private:
+        // alternatives in the order of auto_bitset_representation
+        using variant_type = std::variant<aligned_bitset<uint16_t>,
+                                          aligned_bitset<uint32_t>,
+                                          aligned_bitset<uint64_t>,
+                                          small_bitset<uint64_t>,
+                                          roaring_bitset>;
+
+        [[nodiscard]] static variant_type
+        make_bitset(auto_bitset_representation representation, size_t nbits, unsigned long long init_val)
+        {
+            switch(representation)
+            {
+                case auto_bitset_representation::aligned_uint16:
+                    return aligned_bitset<uint16_t>(nbits, init_val);
+                case auto_bitset_representation::aligned_uint32:
+                    return aligned_bitset<uint32_t>(nbits, init_val);
+                case auto_bitset_representation::aligned_uint64:
+                    return aligned_bitset<uint64_t>(nbits, init_val);
+                case auto_bitset_representation::small_uint64:
+                    return small_bitset<uint64_t>(nbits, init_val);
+                case auto_bitset_representation::roaring:
+                    return roaring_bitset(nbits, init_val);
+            }
+            assert(false);
+            return {};
+        }
+
+        // function(pos) for each bit on of bitset, through the adapter if function does not throw
+        template<typename bitset_t, typename Function>
+        static void for_each_bit_on(const bitset_t& bitset,
+                                    Function&& function) noexcept(std::is_nothrow_invocable_v<Function, size_t>)
+        {
+            if constexpr(std::is_nothrow_invocable_v<Function, size_t>)
+            {
+                dynamic_bitset::do_iterate_bits_on(bitset, std::forward<Function>(function));
+            }
+            else
+            {
+                const size_t bits = bitset.size();
+                for(size_t pos = dynamic_bitset::do_find_first(bitset); pos < bits; pos = bitset.find_next(pos))
+                {
+                    function(pos);
+                }
+            }
+        }
+
+        // operations between different representations, the bits on of rhs are applied to lhs one at a time
+
+        template<typename bitset_t, typename rhs_bitset_t>
+        static void mixed_or_equal(bitset_t& lhs, const rhs_bitset_t& rhs)
+        {
+            for_each_bit_on(rhs, [&](size_t pos) noexcept(noexcept(lhs.set(pos))) { lhs.set(pos); });
+        }
+
+        template<typename bitset_t, typename rhs_bitset_t>
+        static void mixed_xor_equal(bitset_t& lhs, const rhs_bitset_t& rhs)
+        {
+            for_each_bit_on(rhs, [&](size_t pos) noexcept(noexcept(lhs.flip(pos))) { lhs.flip(pos); });
+        }
+
+        template<typename bitset_t, typename rhs_bitset_t>
+        static void mixed_minus_equal(bitset_t& lhs, const rhs_bitset_t& rhs)
+        {
+            for_each_bit_on(rhs, [&](size_t pos) noexcept(noexcept(lhs.reset(pos))) { lhs.reset(pos); });
+        }
+
+        // the bits on of lhs are turned off one at a time, lhs is modified while going through them
+        template<typename bitset_t, typename rhs_bitset_t>
+        static void mixed_and_equal(bitset_t& lhs, const rhs_bitset_t& rhs)
+        {
+            for(size_t pos = dynamic_bitset::do_find_first(lhs); pos < lhs.size(); pos = lhs.find_next(pos))
+            {
+                if(!rhs.test(pos))
+                {
+                    lhs.reset(pos);
+                }
+            }
+        }
+
+        // goes through the bits on of the compressed bitset if any, as it is the sparse one, of rhs otherwise
+        template<typename bitset_t, typename rhs_bitset_t>
+        [[nodiscard]] static size_t mixed_and_count(const bitset_t& lhs, const rhs_bitset_t& rhs) noexcept
+        {
+            if constexpr(std::is_same_v<bitset_t, roaring_bitset>)
+            {
+                return mixed_and_count(rhs, lhs);
+            }
+            else
+            {
+                size_t count = 0;
+                for_each_bit_on(rhs, [&](size_t pos) noexcept { count += lhs.test(pos) ? 1 : 0; });
+                return count;
+            }
+        }
+
+        template<typename bitset_t, typename rhs_bitset_t>
+        [[nodiscard]] static size_t mixed_or_count(const bitset_t& lhs, const rhs_bitset_t& rhs) noexcept
+        {
+            return dynamic_bitset::do_count(lhs) + dynamic_bitset::do_count(rhs) - mixed_and_count(lhs, rhs);
+        }
+
+        template<typename bitset_t, typename rhs_bitset_t>
+        [[nodiscard]] static size_t mixed_andnot_count(const bitset_t& lhs, const rhs_bitset_t& rhs) noexcept
+        {
+            return dynamic_bitset::do_count(lhs) - mixed_and_count(lhs, rhs);
+        }
+
+        // function(bitset, rhs_bitset) with the bitsets of self and rhs if they have the same representation,
+        // mixed_function(bitset, rhs_bitset) otherwise, self is const or not
+        template<typename Self, typename Function, typename MixedFunction>
+        static auto visit_with(Self& self, const auto_bitset& rhs, Function&& function, MixedFunction&& mixed_function)
+          -> std::invoke_result_t<Function,
+                                  std::conditional_t<std::is_const_v<Self>,
+                                                     const aligned_bitset<uint16_t>&,
+                                                     aligned_bitset<uint16_t>&>,
+                                  const aligned_bitset<uint16_t>&>
+        {
+            return std::visit(
+              [&]<typename bitset_t, typename rhs_bitset_t>(bitset_t& bitset,
+                                                            const rhs_bitset_t& rhs_bitset) -> decltype(auto)
+              {
+                  if constexpr(std::is_same_v<std::remove_const_t<bitset_t>, rhs_bitset_t>)
+                  {
+                      return function(bitset, rhs_bitset);
+                  }
+                  else
+                  {
+                      return mixed_function(bitset, rhs_bitset);
+                  }
+              },
+              self.m_bitset,
+              rhs.m_bitset);
+        }
+
+        variant_type m_bitset;
+    };
+} // namespace fix
+
+// the adapters go through the adapters of the representation: the fix kernels for the dense and small buffer ones, the
+// own operations of fix::roaring_bitset
+template<>
+struct fix::dynamic_bitset::bitset_traits<fix::auto_bitset>
+{
+    static constexpr storage_kind storage = storage_kind::bitset;
+
+    [[nodiscard]] static size_t count(const fix::auto_bitset& bitset) noexcept
+    {
+        return bitset.count();
+    }
+
+    static void or_equal(fix::auto_bitset& lhs, const fix::auto_bitset& rhs)
+    {
+        lhs |= rhs;
+    }
+
+    static void and_equal(fix::auto_bitset& lhs, const fix::auto_bitset& rhs)
+    {
+        lhs &= rhs;
+    }
+
+    static void xor_equal(fix::auto_bitset& lhs, const fix::auto_bitset& rhs)
+    {
+        lhs ^= rhs;
+    }
+
+    static void minus_equal(fix::auto_bitset& lhs, const fix::auto_bitset& rhs)
+    {
+        lhs -= rhs;
+    }
+
+    [[nodiscard]] static size_t or_count(const fix::auto_bitset& lhs, const fix::auto_bitset& rhs)
+    {
+        return lhs.or_count(rhs);
+    }
+
+    [[nodiscard]] static size_t and_count(const fix::auto_bitset& lhs, const fix::auto_bitset& rhs)
+    {
+        return lhs.and_count(rhs);
+    }
+
+    [[nodiscard]] static size_t andnot_count(const fix::auto_bitset& lhs, const fix::auto_bitset& rhs)
+    {
+        return lhs.andnot_count(rhs);
+    }
+
+    static void sparse_or_equal(fix::auto_bitset& dense, std::span<const size_t> indices)
+    {
+        dense.visit([&](auto& bitset) { fix::dynamic_bitset::do_sparse_or_equal(bitset, indices); });
+    }
+
+    static void sparse_minus_equal(fix::auto_bitset& dense, std::span<const size_t> indices)
+    {
+        dense.visit([&](auto& bitset) { fix::dynamic_bitset::do_sparse_minus_equal(bitset, indices); });
+    }
+
+    [[nodiscard]] static size_t sparse_andnot_count(std::span<const size_t> indices, const fix::auto_bitset& dense)
+    {
+        return dense.visit([&](const auto& bitset)
+                           { return fix::dynamic_bitset::do_sparse_andnot_count(indices, bitset); });
+    }
+
+    [[nodiscard]] static bool all(const fix::auto_bitset& bitset) noexcept
+    {
+        return bitset.all();
+    }
+
+    [[nodiscard]] static bool none(const fix::auto_bitset& bitset) noexcept
+    {
+        return bitset.none();
+    }
+
+    [[nodiscard]] static bool any(const fix::auto_bitset& bitset) noexcept
+    {
+        return bitset.any();
+    }
+
+    [[nodiscard]] static size_t find_first(const fix::auto_bitset& bitset) noexcept
+    {
+        return bitset.find_first();
+    }
+
+    template<typename Function, typename... Parameters>
+    static void iterate_bits_on(const fix::auto_bitset& bitset, Function&& function, Parameters&&... parameters)
+    {
+        bitset.iterate_bits_on(std::forward<Function>(function), std::forward<Parameters>(parameters)...);
+    }
+
+    template<typename Function, typename... Parameters>
+    static void iterate_bits_on_batched(const fix::auto_bitset& bitset,
+                                        std::span<size_t> buffer,
+                                        Function&& function,
+                                        Parameters&&... parameters)
+    {
+        bitset.visit(
+          [&](const auto& representation_bitset)
+          {
+              fix::dynamic_bitset::do_iterate_bits_on_batched(representation_bitset,
+                                                              buffer,
+                                                              std::forward<Function>(function),
+                                                              std::forward<Parameters>(parameters)...);
+          });
+    }
+};
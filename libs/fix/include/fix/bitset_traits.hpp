@@ -0,0 +1,248 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/kernels.hpp>
+
+#include <bitset>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fix::dynamic_bitset
+{
+    // API used by the adapters when no bitset_traits hook nor kernels are available for an operation
+    enum class storage_kind
+    {
+        bitset,       // boost-like members: size(), count(), set(pos, value), test(pos), |=, find_first()...
+        bool_sequence // std::vector<bool>-like: size(), operator[], iterators over bool values
+    };
+
+    namespace detail
+    {
+        template<typename dynamic_bitset_t>
+        concept vector_bool = std::same_as<std::remove_cvref_t<dynamic_bitset_t>, std::vector<bool>>;
+
+        // libstdc++ std::vector<bool> iterators expose a pointer to the underlying storage words
+        template<typename dynamic_bitset_t>
+        concept vector_bool_with_words = vector_bool<dynamic_bitset_t> && requires(const dynamic_bitset_t& bitset) {
+            { bitset.begin()._M_p } -> std::convertible_to<const void*>;
+        };
+
+        // sul::dynamic_bitset, fix::small_bitset
+        template<typename dynamic_bitset_t>
+        concept data_blocks = !vector_bool<dynamic_bitset_t> && requires(dynamic_bitset_t& bitset) {
+            { bitset.data() } -> std::convertible_to<const void*>;
+            { bitset.num_blocks() } -> std::convertible_to<size_t>;
+        };
+
+        // boost::dynamic_bitset, members are only accessible with BOOST_DYNAMIC_BITSET_DONT_USE_FRIENDS defined, as by
+        // the fix target for its consumers, the adapters use the boost::dynamic_bitset members without it
+        template<typename dynamic_bitset_t>
+        concept member_blocks = requires(dynamic_bitset_t& bitset) {
+            { bitset.m_bits.data() } -> std::convertible_to<const void*>;
+            { bitset.m_bits.size() } -> std::convertible_to<size_t>;
+        }
+#if !defined(BOOST_DYNAMIC_BITSET_DONT_USE_FRIENDS)
+                                && false
+#endif
+          ;
+
+        // std::tr2::dynamic_bitset, blocks are stored in a private base
+        template<typename dynamic_bitset_t>
+        concept base_blocks = requires { typename std::remove_cvref_t<dynamic_bitset_t>::_Base; }
+                              && requires(const typename std::remove_cvref_t<dynamic_bitset_t>::_Base& base) {
+                                     { base._M_w.data() } -> std::convertible_to<const void*>;
+                                 };
+
+        // number of bits of a std::bitset
+        template<typename dynamic_bitset_t>
+        struct std_bitset_size
+        {
+        };
+
+        template<size_t bits>
+        struct std_bitset_size<std::bitset<bits>> : std::integral_constant<size_t, bits>
+        {
+        };
+
+        template<typename dynamic_bitset_t>
+        concept std_bitset = requires { std_bitset_size<std::remove_cvref_t<dynamic_bitset_t>>::value; };
+
+        // libstdc++ std::bitset, blocks are stored in a private base, not in the debug mode wrapper
+        template<typename dynamic_bitset_t>
+        concept std_bitset_with_words = std_bitset<dynamic_bitset_t>
+#if !defined(__GLIBCXX__) || defined(_GLIBCXX_DEBUG)
+                                        && false
+#endif
+          ;
+
+        // backends whose blocks are found without bitset_traits specialization
+        template<typename dynamic_bitset_t>
+        concept known_blocks = vector_bool_with_words<dynamic_bitset_t> || data_blocks<dynamic_bitset_t>
+                               || member_blocks<dynamic_bitset_t> || base_blocks<dynamic_bitset_t>
+                               || std_bitset_with_words<dynamic_bitset_t>;
+
+        template<known_blocks dynamic_bitset_t>
+        [[nodiscard]] auto known_blocks_of(dynamic_bitset_t& bitset) noexcept
+        {
+            if constexpr(vector_bool_with_words<dynamic_bitset_t>)
+            {
+                using block_type = std::remove_pointer_t<decltype(bitset.begin()._M_p)>;
+                using span_type = std::conditional_t<std::is_const_v<dynamic_bitset_t>,
+                                                     std::span<const block_type>,
+                                                     std::span<block_type>>;
+                const size_t blocks_number =
+                  (bitset.size() + kernels::bits_per_block<block_type> - 1) / kernels::bits_per_block<block_type>;
+                // begin() of a std::vector<bool> is always at offset 0 of the first word
+                return span_type(bitset.begin()._M_p, blocks_number);
+            }
+            else if constexpr(data_blocks<dynamic_bitset_t>)
+            {
+                return std::span(bitset.data(), bitset.num_blocks());
+            }
+            else if constexpr(member_blocks<dynamic_bitset_t>)
+            {
+                return std::span(bitset.m_bits.data(), bitset.m_bits.size());
+            }
+#if defined(__GLIBCXX__) && !defined(_GLIBCXX_DEBUG)
+            else if constexpr(std_bitset_with_words<dynamic_bitset_t>)
+            {
+                using block_type = unsigned long;
+                constexpr size_t blocks_number =
+                  (std_bitset_size<std::remove_cvref_t<dynamic_bitset_t>>::value + kernels::bits_per_block<block_type>
+                   - 1)
+                  / kernels::bits_per_block<block_type>;
+                using base_type = std::_Base_bitset<blocks_number>;
+                using span_type = std::conditional_t<std::is_const_v<dynamic_bitset_t>,
+                                                     std::span<const block_type>,
+                                                     std::span<block_type>>;
+                if constexpr(blocks_number == 0)
+                {
+                    return span_type();
+                }
+                else
+                {
+                    using base_reference =
+                      std::conditional_t<std::is_const_v<dynamic_bitset_t>, const base_type&, base_type&>;
+                    // only a C-style cast is allowed to convert to an inaccessible base class
+#    if defined(__GNUC__)
+#        pragma GCC diagnostic push
+#        pragma GCC diagnostic ignored "-Wold-style-cast"
+#    endif
+                    base_reference base = (base_reference)(bitset);
+#    if defined(__GNUC__)
+#        pragma GCC diagnostic pop
+#    endif
+                    // the const base only gives a pointer to const blocks, the other one a reference to the first
+                    if constexpr(std::is_const_v<dynamic_bitset_t>)
+                    {
+                        return span_type(base._M_getdata(), blocks_number);
+                    }
+                    else
+                    {
+                        return span_type(&base._M_getword(0), blocks_number);
+                    }
+                }
+            }
+#endif
+            else
+            {
+                using base_type = typename std::remove_cvref_t<dynamic_bitset_t>::_Base;
+                using base_reference =
+                  std::conditional_t<std::is_const_v<dynamic_bitset_t>, const base_type&, base_type&>;
+                // only a C-style cast is allowed to convert to an inaccessible base class
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wold-style-cast"
+#endif
+                base_reference base = (base_reference)(bitset);
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#endif
+                return std::span(base._M_w.data(), base._M_w.size());
+            }
+        }
+    } // namespace detail
+
+    // Customization point describing a dynamic bitset backend to the fix adapters, specialize it for a new backend.
+    //
+    // - storage: the storage_kind used as last resort
+    // - blocks(bitset): optional, std::span over the underlying unsigned integer blocks (const and non-const
+    //   overloads), the bits after size() in the last block are unspecified; when present the fix kernels are used
+    // - optional operation hooks, used before the kernels when present, with the signature of the matching do_*
+    //   adapter without the do_ prefix: count, or_equal, and_equal, xor_equal, minus_equal, or_reduce, and_reduce,
+    //   or_count, and_count, andnot_count, sparse_or_equal, sparse_minus_equal, sparse_andnot_count, all, none, any,
+    //   find_first, iterate_bits_on and iterate_bits_on_batched
+    //
+    // Default: std::vector<bool> is a bool_sequence, everything else is a bitset, blocks are found for
+    // std::vector<bool> (libstdc++), sul::dynamic_bitset, fix::small_bitset, boost::dynamic_bitset,
+    // std::tr2::dynamic_bitset and std::bitset (libstdc++).
+    template<typename dynamic_bitset_t>
+    struct bitset_traits
+    {
+        static constexpr storage_kind storage =
+          detail::vector_bool<dynamic_bitset_t> ? storage_kind::bool_sequence : storage_kind::bitset;
+
+        [[nodiscard]] static auto blocks(dynamic_bitset_t& bitset) noexcept
+            requires detail::known_blocks<dynamic_bitset_t>
+        {
+            return detail::known_blocks_of(bitset);
+        }
+
+        [[nodiscard]] static auto blocks(const dynamic_bitset_t& bitset) noexcept
+            requires detail::known_blocks<dynamic_bitset_t>
+        {
+            return detail::known_blocks_of(bitset);
+        }
+    };
+
+    template<typename dynamic_bitset_t>
+    using bitset_traits_t = bitset_traits<std::remove_cvref_t<dynamic_bitset_t>>;
+
+    template<typename dynamic_bitset_t>
+    concept bool_sequence = bitset_traits_t<dynamic_bitset_t>::storage == storage_kind::bool_sequence;
+
+    // bitsets whose size is fixed at compile time (std::bitset): no resize(), the constructor from a size_t is an
+    // initial value, code with a size known at runtime uses the first bits and keeps the others off
+    template<typename dynamic_bitset_t>
+    concept fixed_size = detail::std_bitset<dynamic_bitset_t>;
+
+    namespace detail
+    {
+        // blocks of the fix kernels, loaded 64 bits at a time
+        template<typename block_t>
+        concept kernels_block = std::unsigned_integral<block_t> && kernels::bits_per_block<block_t> <= 64;
+    } // namespace detail
+
+    // bitsets whose blocks are exposed, the ones with wider blocks (as unsigned __int128) use their own operations
+    template<typename dynamic_bitset_t>
+    concept has_blocks =
+      requires(dynamic_bitset_t& bitset) { bitset_traits_t<dynamic_bitset_t>::blocks(bitset); }
+      && detail::kernels_block<
+        typename decltype(bitset_traits_t<dynamic_bitset_t>::blocks(std::declval<dynamic_bitset_t&>()))::value_type>;
+
+    // span over the underlying blocks of the bitset, the bits after size() in the last block are unspecified
+    template<has_blocks dynamic_bitset_t>
+    [[nodiscard]] auto blocks(dynamic_bitset_t& bitset) noexcept
+    {
+        return bitset_traits_t<dynamic_bitset_t>::blocks(bitset);
+    }
+
+    // use the fix kernels instead of the bitset own operations
+    // bool sequences always use them as they do not provide word level operations
+    template<typename dynamic_bitset_t>
+    concept use_kernels = has_blocks<dynamic_bitset_t>
+#ifdef FIX_DYNAMIC_BITSET_NATIVE_OPERATIONS
+                          && bool_sequence<dynamic_bitset_t>
+#endif
+      ;
+} // namespace fix::dynamic_bitset
@@ -0,0 +1,309 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+// Census of the fix adapters calls, enabled with FIX_DYNAMIC_BITSET_CENSUS (CMake option of the same name).
+//
+// Each do_* adapter records its calls, the bits of the bitsets it processes and the cycles spent in it in counters
+// of the calling thread, counters() sums the ones of all the threads, including the exited ones. Adapters called by
+// another adapter are not recorded, their cost is part of the calling one. Without FIX_DYNAMIC_BITSET_CENSUS the
+// adapters do not record anything and counters() stays empty.
+#ifdef FIX_DYNAMIC_BITSET_CENSUS
+#    include <atomic>
+#    include <mutex>
+#    if defined(__x86_64__) || defined(__i386__)
+#        include <x86intrin.h>
+#        define FIX_DYNAMIC_BITSET_CENSUS_RDTSC
+#    elif defined(_M_X64) || defined(_M_IX86)
+#        include <intrin.h>
+#        define FIX_DYNAMIC_BITSET_CENSUS_RDTSC
+#    else
+#        include <chrono>
+#    endif
+#endif
+
+namespace fix::dynamic_bitset::census
+{
+#ifdef FIX_DYNAMIC_BITSET_CENSUS
+    constexpr bool enabled = true;
+#else
+    constexpr bool enabled = false;
+#endif
+
+    enum class operation : size_t
+    {
+        count,
+        or_equal,
+        and_equal,
+        xor_equal,
+        minus_equal,
+        or_reduce,
+        and_reduce,
+        or_count,
+        and_count,
+        andnot_count,
+        sparse_or_equal,
+        sparse_minus_equal,
+        sparse_andnot_count,
+        set,
+        test,
+        reset,
+        all,
+        none,
+        any,
+        find_first,
+        iterate_bits_on,
+        iterate_bits_on_batched,
+    };
+
+    constexpr size_t operations_number = static_cast<size_t>(operation::iterate_bits_on_batched) + 1;
+
+    [[nodiscard]] constexpr std::string_view operation_name(operation value) noexcept
+    {
+        constexpr std::array<std::string_view, operations_number> names = {
+          "count",
+          "or_equal",
+          "and_equal",
+          "xor_equal",
+          "minus_equal",
+          "or_reduce",
+          "and_reduce",
+          "or_count",
+          "and_count",
+          "andnot_count",
+          "sparse_or_equal",
+          "sparse_minus_equal",
+          "sparse_andnot_count",
+          "set",
+          "test",
+          "reset",
+          "all",
+          "none",
+          "any",
+          "find_first",
+          "iterate_bits_on",
+          "iterate_bits_on_batched",
+        };
+        return names[static_cast<size_t>(value)];
+    }
+
+    struct operation_counters final
+    {
+        uint64_t calls = 0;
+        uint64_t bits = 0;
+        // rdtsc reference cycles, steady clock nanoseconds on other architectures
+        uint64_t cycles = 0;
+    };
+
+    using census_counters = std::array<operation_counters, operations_number>;
+
+    namespace detail
+    {
+#ifdef FIX_DYNAMIC_BITSET_CENSUS
+        struct thread_operation_counters final
+        {
+            std::atomic<uint64_t> calls = 0;
+            std::atomic<uint64_t> bits = 0;
+            std::atomic<uint64_t> cycles = 0;
+        };
+
+        // counters of a thread, only written by it and read by the other threads in counters()
+        struct thread_census final
+        {
+            std::array<thread_operation_counters, operations_number> counters{};
+            // adapters currently running on the thread, only the outermost one is recorded
+            size_t depth = 0;
+            // threads recording, linked in the registry
+            thread_census* previous = nullptr;
+            thread_census* next = nullptr;
+
+            thread_census() noexcept;
+            thread_census(const thread_census&) = delete;
+            thread_census& operator=(const thread_census&) = delete;
+            ~thread_census() noexcept;
+        };
+
+        // census of the exited threads and list of the threads recording
+        struct registry final
+        {
+            std::mutex mutex;
+            census_counters exited{};
+            thread_census* threads = nullptr;
+        };
+
+        [[nodiscard]] inline registry& global_registry() noexcept
+        {
+            static registry instance;
+            return instance;
+        }
+
+        // adds to a counter written by a single thread, without a read-modify-write
+        inline void add(std::atomic<uint64_t>& counter, uint64_t value) noexcept
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        inline void accumulate(census_counters& sum, const thread_census& census) noexcept
+        {
+            for(size_t i = 0; i < operations_number; ++i)
+            {
+                sum[i].calls += census.counters[i].calls.load(std::memory_order_relaxed);
+                sum[i].bits += census.counters[i].bits.load(std::memory_order_relaxed);
+                sum[i].cycles += census.counters[i].cycles.load(std::memory_order_relaxed);
+            }
+        }
+
+        // the registry is constructed before the first thread census, so destroyed after the last one
+        inline thread_census::thread_census() noexcept
+        {
+            registry& threads_registry = global_registry();
+            const std::lock_guard lock(threads_registry.mutex);
+            next = threads_registry.threads;
+            if(next != nullptr)
+            {
+                next->previous = this;
+            }
+            threads_registry.threads = this;
+        }
+
+        inline thread_census::~thread_census() noexcept
+        {
+            registry& threads_registry = global_registry();
+            const std::lock_guard lock(threads_registry.mutex);
+            accumulate(threads_registry.exited, *this);
+            if(previous != nullptr)
+            {
+                previous->next = next;
+            }
+            else
+            {
+                threads_registry.threads = next;
+            }
+            if(next != nullptr)
+            {
+                next->previous = previous;
+            }
+        }
+
+        [[nodiscard]] inline thread_census& local() noexcept
+        {
+            thread_local thread_census census;
+            return census;
+        }
+
+        [[nodiscard]] inline uint64_t now() noexcept
+        {
+#    ifdef FIX_DYNAMIC_BITSET_CENSUS_RDTSC
+            return static_cast<uint64_t>(__rdtsc());
+#    else
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                           std::chrono::steady_clock::now().time_since_epoch())
+                                           .count());
+#    endif
+        }
+#endif
+    } // namespace detail
+
+    // counters of all the threads since the last reset()
+    [[nodiscard]] inline census_counters counters() noexcept
+    {
+#ifdef FIX_DYNAMIC_BITSET_CENSUS
+        detail::registry& threads_registry = detail::global_registry();
+        const std::lock_guard lock(threads_registry.mutex);
+        census_counters sum = threads_registry.exited;
+        for(const detail::thread_census* census = threads_registry.threads; census != nullptr; census = census->next)
+        {
+            detail::accumulate(sum, *census);
+        }
+        return sum;
+#else
+        return {};
+#endif
+    }
+
+    // the counters of a thread recording during the reset may keep some of their previous values
+    inline void reset() noexcept
+    {
+#ifdef FIX_DYNAMIC_BITSET_CENSUS
+        detail::registry& threads_registry = detail::global_registry();
+        const std::lock_guard lock(threads_registry.mutex);
+        threads_registry.exited = {};
+        for(detail::thread_census* census = threads_registry.threads; census != nullptr; census = census->next)
+        {
+            for(detail::thread_operation_counters& counters: census->counters)
+            {
+                counters.calls.store(0, std::memory_order_relaxed);
+                counters.bits.store(0, std::memory_order_relaxed);
+                counters.cycles.store(0, std::memory_order_relaxed);
+            }
+        }
+#endif
+    }
+
+#ifdef FIX_DYNAMIC_BITSET_CENSUS
+    // records the adapter call it is declared in, constant evaluations are not recorded
+    class scope final
+    {
+    public:
+        constexpr scope(operation recorded, uint64_t bits) noexcept
+          : m_operation(recorded)
+          , m_bits(bits)
+        {
+            if(!std::is_constant_evaluated())
+            {
+                m_outermost = detail::local().depth++ == 0;
+                if(m_outermost)
+                {
+                    m_start = detail::now();
+                }
+            }
+        }
+
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+
+        constexpr ~scope() noexcept
+        {
+            if(!std::is_constant_evaluated())
+            {
+                detail::thread_census& census = detail::local();
+                --census.depth;
+                if(m_outermost)
+                {
+                    detail::thread_operation_counters& counters = census.counters[static_cast<size_t>(m_operation)];
+                    detail::add(counters.cycles, detail::now() - m_start);
+                    detail::add(counters.calls, 1);
+                    detail::add(counters.bits, m_bits);
+                }
+            }
+        }
+
+    private:
+        operation m_operation;
+        uint64_t m_bits;
+        uint64_t m_start = 0;
+        bool m_outermost = false;
+    };
+#endif
+} // namespace fix::dynamic_bitset::census
+
+// record the enclosing adapter call as recorded_operation on bits bits
+// expands to nothing without census, the bits expression is not evaluated
+#ifdef FIX_DYNAMIC_BITSET_CENSUS
+#    define FIX_DYNAMIC_BITSET_CENSUS_SCOPE(recorded_operation, bits) \
+        const ::fix::dynamic_bitset::census::scope fix_dynamic_bitset_census_scope( \
+          ::fix::dynamic_bitset::census::operation::recorded_operation, static_cast<uint64_t>(bits))
+#else
+#    define FIX_DYNAMIC_BITSET_CENSUS_SCOPE(recorded_operation, bits) static_cast<void>(0)
+#endif
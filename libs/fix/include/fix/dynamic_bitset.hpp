@@ -7,9 +7,20 @@
 //
 #pragma once
 
+#include <fix/bitset_traits.hpp>
+#include <fix/census.hpp>
+#include <fix/kernels.hpp>
+
 #include <algorithm>
 #include <concepts>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <numeric>
 #include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace fix::dynamic_bitset
@@ -22,8 +33,19 @@ namespace fix::dynamic_bitset
     template<typename dynamic_bitset_t>
     [[nodiscard]] constexpr size_t do_count(const dynamic_bitset_t& bitset) noexcept
     {
-        // if std::vector<bool>
-        if constexpr(std::same_as<std::remove_cvref_t<dynamic_bitset_t>, std::vector<bool>>)
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(count, bitset.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::count(bitset); })
+        {
+            return bitset_traits_t<dynamic_bitset_t>::count(bitset);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            return kernels::count(blocks(bitset), bitset.size());
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
         {
             return std::count(bitset.cbegin(), bitset.cend(), true);
         }
@@ -37,8 +59,19 @@ namespace fix::dynamic_bitset
     template<typename dynamic_bitset_t>
     constexpr void do_or_equal(dynamic_bitset_t& lhs, const dynamic_bitset_t& rhs) noexcept
     {
-        // if std::vector<bool>
-        if constexpr(std::same_as<std::remove_cvref_t<dynamic_bitset_t>, std::vector<bool>>)
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(or_equal, lhs.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::or_equal(lhs, rhs); })
+        {
+            bitset_traits_t<dynamic_bitset_t>::or_equal(lhs, rhs);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            kernels::or_equal(blocks(lhs), blocks(rhs));
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
         {
             // for(const size_t i: std::views::iota(0u, lhs.size()))
             // {
@@ -53,11 +86,74 @@ namespace fix::dynamic_bitset
         }
     }
 
+    template<typename dynamic_bitset_t>
+    constexpr void do_and_equal(dynamic_bitset_t& lhs, const dynamic_bitset_t& rhs) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(and_equal, lhs.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::and_equal(lhs, rhs); })
+        {
+            bitset_traits_t<dynamic_bitset_t>::and_equal(lhs, rhs);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            kernels::and_equal(blocks(lhs), blocks(rhs));
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
+        {
+            std::transform(lhs.cbegin(), lhs.cend(), rhs.cbegin(), lhs.begin(), std::logical_and<bool>());
+        }
+        // if sane dynamic_bitset
+        else
+        {
+            lhs &= rhs;
+        }
+    }
+
+    template<typename dynamic_bitset_t>
+    constexpr void do_xor_equal(dynamic_bitset_t& lhs, const dynamic_bitset_t& rhs) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(xor_equal, lhs.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::xor_equal(lhs, rhs); })
+        {
+            bitset_traits_t<dynamic_bitset_t>::xor_equal(lhs, rhs);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            kernels::xor_equal(blocks(lhs), blocks(rhs));
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
+        {
+            std::transform(lhs.cbegin(), lhs.cend(), rhs.cbegin(), lhs.begin(), std::not_equal_to<bool>());
+        }
+        // if sane dynamic_bitset
+        else
+        {
+            lhs ^= rhs;
+        }
+    }
+
     template<typename dynamic_bitset_t>
     constexpr void do_minus_equal(dynamic_bitset_t& lhs, const dynamic_bitset_t& rhs) noexcept
     {
-        // if std::vector<bool>
-        if constexpr(std::same_as<std::remove_cvref_t<dynamic_bitset_t>, std::vector<bool>>)
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(minus_equal, lhs.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::minus_equal(lhs, rhs); })
+        {
+            bitset_traits_t<dynamic_bitset_t>::minus_equal(lhs, rhs);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            kernels::minus_equal(blocks(lhs), blocks(rhs));
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
         {
             // for(const size_t i: std::views::iota(0u, lhs.size()))
             // {
@@ -76,11 +172,271 @@ namespace fix::dynamic_bitset
         }
     }
 
+    // lhs |= operand for each dynamic bitset of operands, one pass over lhs when kernels are used
+    template<typename dynamic_bitset_t, std::ranges::forward_range Operands>
+    constexpr void do_or_reduce(dynamic_bitset_t& lhs, Operands&& operands) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(or_reduce,
+                                        lhs.size() * static_cast<size_t>(std::ranges::distance(operands)));
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::or_reduce(lhs, operands); })
+        {
+            bitset_traits_t<dynamic_bitset_t>::or_reduce(lhs, std::forward<Operands>(operands));
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            kernels::or_reduce(blocks(lhs),
+                               std::views::transform(operands,
+                                                     [](const dynamic_bitset_t& operand) noexcept
+                                                     { return blocks(operand); }));
+        }
+        // one operation per operand
+        else
+        {
+            for(const dynamic_bitset_t& operand: operands)
+            {
+                do_or_equal(lhs, operand);
+            }
+        }
+    }
+
+    // lhs &= operand for each dynamic bitset of operands, one pass over lhs when kernels are used
+    template<typename dynamic_bitset_t, std::ranges::forward_range Operands>
+    constexpr void do_and_reduce(dynamic_bitset_t& lhs, Operands&& operands) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(and_reduce,
+                                        lhs.size() * static_cast<size_t>(std::ranges::distance(operands)));
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::and_reduce(lhs, operands); })
+        {
+            bitset_traits_t<dynamic_bitset_t>::and_reduce(lhs, std::forward<Operands>(operands));
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            kernels::and_reduce(blocks(lhs),
+                                std::views::transform(operands,
+                                                      [](const dynamic_bitset_t& operand) noexcept
+                                                      { return blocks(operand); }));
+        }
+        // one operation per operand
+        else
+        {
+            for(const dynamic_bitset_t& operand: operands)
+            {
+                do_and_equal(lhs, operand);
+            }
+        }
+    }
+
+    // count of lhs | rhs, without temporary bitset when kernels are used
+    template<typename dynamic_bitset_t>
+    [[nodiscard]] constexpr size_t do_or_count(const dynamic_bitset_t& lhs, const dynamic_bitset_t& rhs) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(or_count, lhs.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::or_count(lhs, rhs); })
+        {
+            return bitset_traits_t<dynamic_bitset_t>::or_count(lhs, rhs);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            return kernels::or_count(blocks(lhs), blocks(rhs), lhs.size());
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
+        {
+            return std::transform_reduce(lhs.cbegin(),
+                                         lhs.cend(),
+                                         rhs.cbegin(),
+                                         size_t(0),
+                                         std::plus<size_t>(),
+                                         [](bool lhs_value, bool rhs_value) noexcept
+                                         { return static_cast<size_t>(lhs_value || rhs_value); });
+        }
+        // if sane dynamic_bitset
+        else
+        {
+            dynamic_bitset_t result = lhs;
+            result |= rhs;
+            return result.count();
+        }
+    }
+
+    // count of lhs & rhs, without temporary bitset when kernels are used
+    template<typename dynamic_bitset_t>
+    [[nodiscard]] constexpr size_t do_and_count(const dynamic_bitset_t& lhs, const dynamic_bitset_t& rhs) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(and_count, lhs.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::and_count(lhs, rhs); })
+        {
+            return bitset_traits_t<dynamic_bitset_t>::and_count(lhs, rhs);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            return kernels::and_count(blocks(lhs), blocks(rhs), lhs.size());
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
+        {
+            return std::transform_reduce(lhs.cbegin(),
+                                         lhs.cend(),
+                                         rhs.cbegin(),
+                                         size_t(0),
+                                         std::plus<size_t>(),
+                                         [](bool lhs_value, bool rhs_value) noexcept
+                                         { return static_cast<size_t>(lhs_value && rhs_value); });
+        }
+        // if sane dynamic_bitset
+        else
+        {
+            dynamic_bitset_t result = lhs;
+            result &= rhs;
+            return result.count();
+        }
+    }
+
+    // count of lhs & ~rhs, without temporary bitset when kernels are used
+    template<typename dynamic_bitset_t>
+    [[nodiscard]] constexpr size_t do_andnot_count(const dynamic_bitset_t& lhs, const dynamic_bitset_t& rhs) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(andnot_count, lhs.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::andnot_count(lhs, rhs); })
+        {
+            return bitset_traits_t<dynamic_bitset_t>::andnot_count(lhs, rhs);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            return kernels::andnot_count(blocks(lhs), blocks(rhs), lhs.size());
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
+        {
+            return std::transform_reduce(lhs.cbegin(),
+                                         lhs.cend(),
+                                         rhs.cbegin(),
+                                         size_t(0),
+                                         std::plus<size_t>(),
+                                         [](bool lhs_value, bool rhs_value) noexcept
+                                         { return static_cast<size_t>(lhs_value && !rhs_value); });
+        }
+        // if sane dynamic_bitset
+        else
+        {
+            dynamic_bitset_t result = lhs;
+            result -= rhs;
+            return result.count();
+        }
+    }
+
+    // dense |= indices, indices are positions of bits on lower than dense.size()
+    template<typename dynamic_bitset_t>
+    constexpr void do_sparse_or_equal(dynamic_bitset_t& dense, std::span<const size_t> indices) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(sparse_or_equal, indices.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::sparse_or_equal(dense, indices); })
+        {
+            bitset_traits_t<dynamic_bitset_t>::sparse_or_equal(dense, indices);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            kernels::sparse_or_equal(blocks(dense), indices);
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
+        {
+            for(const size_t index: indices)
+            {
+                dense[index] = true;
+            }
+        }
+        // if sane dynamic_bitset
+        else
+        {
+            for(const size_t index: indices)
+            {
+                dense.set(index);
+            }
+        }
+    }
+
+    // dense &= ~indices, indices are positions of bits on lower than dense.size()
+    template<typename dynamic_bitset_t>
+    constexpr void do_sparse_minus_equal(dynamic_bitset_t& dense, std::span<const size_t> indices) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(sparse_minus_equal, indices.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::sparse_minus_equal(dense, indices); })
+        {
+            bitset_traits_t<dynamic_bitset_t>::sparse_minus_equal(dense, indices);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            kernels::sparse_minus_equal(blocks(dense), indices);
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
+        {
+            for(const size_t index: indices)
+            {
+                dense[index] = false;
+            }
+        }
+        // if sane dynamic_bitset
+        else
+        {
+            for(const size_t index: indices)
+            {
+                dense.reset(index);
+            }
+        }
+    }
+
+    // count of indices & ~dense: number of indices whose bit is off in dense
+    template<typename dynamic_bitset_t>
+    [[nodiscard]] constexpr size_t do_sparse_andnot_count(std::span<const size_t> indices,
+                                                          const dynamic_bitset_t& dense) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(sparse_andnot_count, indices.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::sparse_andnot_count(indices, dense); })
+        {
+            return bitset_traits_t<dynamic_bitset_t>::sparse_andnot_count(indices, dense);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            return kernels::sparse_andnot_count(indices, blocks(dense));
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
+        {
+            return static_cast<size_t>(
+              std::count_if(indices.begin(), indices.end(), [&](size_t index) noexcept { return !dense[index]; }));
+        }
+        // if sane dynamic_bitset
+        else
+        {
+            return static_cast<size_t>(
+              std::count_if(indices.begin(), indices.end(), [&](size_t index) noexcept { return !dense.test(index); }));
+        }
+    }
+
     template<typename dynamic_bitset_t>
     constexpr void do_set(dynamic_bitset_t& bitset, size_t pos, bool value = true) noexcept
     {
-        // if std::vector<bool>
-        if constexpr(std::same_as<std::remove_cvref_t<dynamic_bitset_t>, std::vector<bool>>)
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(set, 1);
+        // if bool sequence (std::vector<bool>)
+        if constexpr(bool_sequence<dynamic_bitset_t>)
         {
             bitset[pos] = value;
         }
@@ -94,8 +450,9 @@ namespace fix::dynamic_bitset
     template<typename dynamic_bitset_t>
     constexpr bool do_test(dynamic_bitset_t& bitset, size_t pos) noexcept
     {
-        // if std::vector<bool>
-        if constexpr(std::same_as<std::remove_cvref_t<dynamic_bitset_t>, std::vector<bool>>)
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(test, 1);
+        // if bool sequence (std::vector<bool>)
+        if constexpr(bool_sequence<dynamic_bitset_t>)
         {
             return bitset[pos];
         }
@@ -109,8 +466,19 @@ namespace fix::dynamic_bitset
     template<typename dynamic_bitset_t>
     [[nodiscard]] constexpr bool do_all(const dynamic_bitset_t& bitset) noexcept
     {
-        // if std::vector<bool>
-        if constexpr(std::same_as<std::remove_cvref_t<dynamic_bitset_t>, std::vector<bool>>)
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(all, bitset.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::all(bitset); })
+        {
+            return bitset_traits_t<dynamic_bitset_t>::all(bitset);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            return kernels::all(blocks(bitset), bitset.size());
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
         {
             return std::ranges::all_of(bitset, [](bool val) noexcept { return val; });
         }
@@ -124,8 +492,19 @@ namespace fix::dynamic_bitset
     template<typename dynamic_bitset_t>
     [[nodiscard]] constexpr bool do_none(const dynamic_bitset_t& bitset) noexcept
     {
-        // if std::vector<bool>
-        if constexpr(std::same_as<std::remove_cvref_t<dynamic_bitset_t>, std::vector<bool>>)
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(none, bitset.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::none(bitset); })
+        {
+            return bitset_traits_t<dynamic_bitset_t>::none(bitset);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            return kernels::none(blocks(bitset), bitset.size());
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
         {
             return std::ranges::none_of(bitset, [](bool val) noexcept { return val; });
         }
@@ -139,8 +518,19 @@ namespace fix::dynamic_bitset
     template<typename dynamic_bitset_t>
     [[nodiscard]] constexpr bool do_any(const dynamic_bitset_t& bitset) noexcept
     {
-        // if std::vector<bool>
-        if constexpr(std::same_as<std::remove_cvref_t<dynamic_bitset_t>, std::vector<bool>>)
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(any, bitset.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::any(bitset); })
+        {
+            return bitset_traits_t<dynamic_bitset_t>::any(bitset);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            return kernels::any(blocks(bitset), bitset.size());
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
         {
             return std::ranges::any_of(bitset, [](bool val) noexcept { return val; });
         }
@@ -154,8 +544,9 @@ namespace fix::dynamic_bitset
     template<typename dynamic_bitset_t>
     constexpr void do_reset(dynamic_bitset_t& bitset) noexcept
     {
-        // if std::vector<bool>
-        if constexpr(std::same_as<std::remove_cvref_t<dynamic_bitset_t>, std::vector<bool>>)
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(reset, bitset.size());
+        // if bool sequence (std::vector<bool>)
+        if constexpr(bool_sequence<dynamic_bitset_t>)
         {
             // for(const size_t i: std::views::iota(0u, bitset.size()))
             // {
@@ -173,8 +564,9 @@ namespace fix::dynamic_bitset
     template<typename dynamic_bitset_t>
     constexpr void do_reset(dynamic_bitset_t& bitset, size_t pos) noexcept
     {
-        // if std::vector<bool>
-        if constexpr(std::same_as<std::remove_cvref_t<dynamic_bitset_t>, std::vector<bool>>)
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(reset, 1);
+        // if bool sequence (std::vector<bool>)
+        if constexpr(bool_sequence<dynamic_bitset_t>)
         {
             bitset[pos] = false;
         }
@@ -188,12 +580,23 @@ namespace fix::dynamic_bitset
     template<typename dynamic_bitset_t>
     [[nodiscard]] constexpr size_t do_find_first(const dynamic_bitset_t& bitset) noexcept
     {
-        // if std::vector<bool>
-        if constexpr(std::same_as<std::remove_cvref_t<dynamic_bitset_t>, std::vector<bool>>)
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(find_first, bitset.size());
+        // if bitset_traits hook
+        if constexpr(requires { bitset_traits_t<dynamic_bitset_t>::find_first(bitset); })
+        {
+            return bitset_traits_t<dynamic_bitset_t>::find_first(bitset);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            return kernels::find_first(blocks(bitset), bitset.size());
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
         {
             if(const auto it = std::find(bitset.cbegin(), bitset.cend(), true); it != bitset.cend())
             {
-                return std::distance(bitset.cbegin(), it);
+                return static_cast<size_t>(std::distance(bitset.cbegin(), it));
             }
             return std::numeric_limits<size_t>::max();
         }
@@ -208,6 +611,7 @@ namespace fix::dynamic_bitset
     constexpr void
     do_iterate_bits_on(dynamic_bitset_t& bitset, Function&& function, Parameters&&... parameters) noexcept
     {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(iterate_bits_on, bitset.size());
         // check
         if constexpr(!std::is_invocable_v<Function, size_t, Parameters...>)
         {
@@ -215,8 +619,33 @@ namespace fix::dynamic_bitset
             // function should take (size_t, parameters...) as arguments
         }
 
-        // if std::vector<bool>
-        if constexpr(std::same_as<std::remove_cvref_t<dynamic_bitset_t>, std::vector<bool>>)
+        // if bitset_traits hook
+        if constexpr(requires {
+                         bitset_traits_t<dynamic_bitset_t>::iterate_bits_on(bitset, function, parameters...);
+                     })
+        {
+            bitset_traits_t<dynamic_bitset_t>::iterate_bits_on(
+              bitset, std::forward<Function>(function), std::forward<Parameters>(parameters)...);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            if constexpr(std::same_as<std::invoke_result_t<Function, size_t, Parameters...>, void>
+                         || std::is_convertible_v<std::invoke_result_t<Function, size_t, Parameters...>, bool>)
+            {
+                kernels::iterate_bits_on(blocks(std::as_const(bitset)),
+                                         bitset.size(),
+                                         std::forward<Function>(function),
+                                         std::forward<Parameters>(parameters)...);
+            }
+            else
+            {
+                static_assert(dependent_false<Function>::value, "Function have invalid return type");
+                // return type should be void, or convertible to bool
+            }
+        }
+        // if bool sequence (std::vector<bool>)
+        else if constexpr(bool_sequence<dynamic_bitset_t>)
         {
             if constexpr(std::same_as<std::invoke_result_t<Function, size_t, Parameters...>, void>)
             {
@@ -292,4 +721,82 @@ namespace fix::dynamic_bitset
         }
     }
 
+    // call function(bits_on, parameters...) with std::span<const size_t> batches of the bits on indices,
+    // decoded in buffer, stop early if function returns false
+    // buffer must not be empty, the kernels decode whole words in it from kernels::decode_buffer_min_size indices
+    template<typename dynamic_bitset_t, typename Function, typename... Parameters>
+    constexpr void do_iterate_bits_on_batched(dynamic_bitset_t& bitset,
+                                              std::span<size_t> buffer,
+                                              Function&& function,
+                                              Parameters&&... parameters) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(iterate_bits_on_batched, bitset.size());
+        using result_t = std::invoke_result_t<Function, std::span<const size_t>, Parameters...>;
+
+        // check
+        if constexpr(!std::is_invocable_v<Function, std::span<const size_t>, Parameters...>)
+        {
+            static_assert(dependent_false<Function>::value, "Function take invalid arguments");
+            // function should take (std::span<const size_t>, parameters...) as arguments
+        }
+        else if constexpr(!std::same_as<result_t, void> && !std::is_convertible_v<result_t, bool>)
+        {
+            static_assert(dependent_false<Function>::value, "Function have invalid return type");
+            // return type should be void, or convertible to bool
+        }
+
+        // if bitset_traits hook
+        if constexpr(requires {
+                         bitset_traits_t<dynamic_bitset_t>::iterate_bits_on_batched(
+                           bitset, buffer, function, parameters...);
+                     })
+        {
+            bitset_traits_t<dynamic_bitset_t>::iterate_bits_on_batched(
+              bitset, buffer, std::forward<Function>(function), std::forward<Parameters>(parameters)...);
+        }
+        // if kernels on blocks
+        else if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            kernels::iterate_bits_on_batched(blocks(std::as_const(bitset)),
+                                             bitset.size(),
+                                             buffer,
+                                             std::forward<Function>(function),
+                                             std::forward<Parameters>(parameters)...);
+        }
+        // fill the buffer bit by bit
+        else
+        {
+            size_t buffered = 0;
+            bool stopped = false;
+            const auto flush = [&]()
+            {
+                const std::span<const size_t> bits_on(buffer.data(), buffered);
+                buffered = 0;
+                if constexpr(std::same_as<result_t, void>)
+                {
+                    std::invoke(std::forward<Function>(function), bits_on, std::forward<Parameters>(parameters)...);
+                }
+                else
+                {
+                    stopped =
+                      !std::invoke(std::forward<Function>(function), bits_on, std::forward<Parameters>(parameters)...);
+                }
+            };
+            do_iterate_bits_on(bitset,
+                               [&](size_t bit_on)
+                               {
+                                   buffer[buffered++] = bit_on;
+                                   if(buffered == buffer.size())
+                                   {
+                                       flush();
+                                   }
+                                   return !stopped;
+                               });
+            if(buffered != 0 && !stopped)
+            {
+                flush();
+            }
+        }
+    }
+
 } // namespace fix::dynamic_bitset
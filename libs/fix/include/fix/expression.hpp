@@ -0,0 +1,529 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/dynamic_bitset.hpp>
+#include <fix/kernels.hpp>
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+// Lazy bitwise expressions over dynamic bitsets, evaluated in a single pass over the blocks.
+//
+// Operands are wrapped with expr(), the expressions are combined with |, &, ^, - (and not) and ~:
+//     const size_t n = fix::dynamic_bitset::count(expr(a) | (expr(b) & ~expr(c)));
+//     fix::dynamic_bitset::eval(result, expr(a) | (expr(b) & ~expr(c)));
+// Expressions keep references to the bitsets, they must not outlive them.
+// Backends without block access are evaluated bit by bit.
+namespace fix::dynamic_bitset
+{
+    namespace detail
+    {
+        struct expression_base
+        {
+        };
+
+        struct no_blocks
+        {
+        };
+
+        template<typename dynamic_bitset_t>
+        struct const_blocks
+        {
+            using type = no_blocks;
+        };
+
+        template<has_blocks dynamic_bitset_t>
+        struct const_blocks<dynamic_bitset_t>
+        {
+            using type = decltype(blocks(std::declval<const dynamic_bitset_t&>()));
+        };
+
+        template<kernels::simd::operation op>
+        [[nodiscard]] constexpr bool apply_bit(bool lhs, bool rhs) noexcept
+        {
+            if constexpr(op == kernels::simd::operation::bit_or)
+            {
+                return lhs || rhs;
+            }
+            else if constexpr(op == kernels::simd::operation::bit_and)
+            {
+                return lhs && rhs;
+            }
+            else if constexpr(op == kernels::simd::operation::bit_andnot)
+            {
+                return lhs && !rhs;
+            }
+            else
+            {
+                return lhs != rhs;
+            }
+        }
+
+        // lanes are 64 bits words or SIMD vectors, the operators on vectors are lowered to the instruction set of the
+        // function they are inlined in
+        // vectors are passed by reference, their calling convention depends on the enabled instruction sets
+        template<kernels::simd::operation op, typename lane_t>
+        inline void apply_lane(lane_t& lhs, const lane_t& rhs) noexcept
+        {
+            if constexpr(op == kernels::simd::operation::bit_or)
+            {
+                lhs |= rhs;
+            }
+            else if constexpr(op == kernels::simd::operation::bit_and)
+            {
+                lhs &= rhs;
+            }
+            else if constexpr(op == kernels::simd::operation::bit_andnot)
+            {
+                lhs &= ~rhs;
+            }
+            else
+            {
+                lhs ^= rhs;
+            }
+        }
+    } // namespace detail
+
+    template<typename T>
+    concept bitset_expression = std::derived_from<std::remove_cvref_t<T>, detail::expression_base>;
+
+    // leaf of an expression, reference to a dynamic bitset
+    template<typename dynamic_bitset_t>
+    class terminal_expression final : public detail::expression_base
+    {
+    public:
+        using bitset_type = dynamic_bitset_t;
+
+        explicit terminal_expression(const dynamic_bitset_t& bitset) noexcept
+          : m_bitset(bitset)
+        {
+            if constexpr(has_blocks<dynamic_bitset_t>)
+            {
+                m_blocks = blocks(bitset);
+            }
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_bitset.size();
+        }
+
+        // sizeof(lane_t) bytes starting at block i
+        template<typename lane_t>
+        void lane(size_t i, lane_t& result) const noexcept
+        {
+            std::memcpy(&result, m_blocks.data() + i, sizeof(result));
+        }
+
+        [[nodiscard]] auto block(size_t i) const noexcept
+        {
+            return m_blocks[i];
+        }
+
+        [[nodiscard]] bool bit(size_t i) const noexcept
+        {
+            return do_test(m_bitset, i);
+        }
+
+    private:
+        const dynamic_bitset_t& m_bitset;
+        [[no_unique_address]] typename detail::const_blocks<dynamic_bitset_t>::type m_blocks;
+    };
+
+    // lhs op rhs
+    template<kernels::simd::operation op, bitset_expression lhs_t, bitset_expression rhs_t>
+    class binary_expression final : public detail::expression_base
+    {
+    public:
+        using bitset_type = typename lhs_t::bitset_type;
+        static_assert(std::same_as<bitset_type, typename rhs_t::bitset_type>, "operands of different types");
+
+        binary_expression(const lhs_t& lhs, const rhs_t& rhs) noexcept
+          : m_lhs(lhs)
+          , m_rhs(rhs)
+        {
+            assert(lhs.size() == rhs.size());
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_lhs.size();
+        }
+
+        template<typename lane_t>
+        void lane(size_t i, lane_t& result) const noexcept
+        {
+            lane_t rhs;
+            m_lhs.lane(i, result);
+            m_rhs.lane(i, rhs);
+            detail::apply_lane<op>(result, rhs);
+        }
+
+        [[nodiscard]] auto block(size_t i) const noexcept
+        {
+            return kernels::detail::apply<op>(m_lhs.block(i), m_rhs.block(i));
+        }
+
+        [[nodiscard]] bool bit(size_t i) const noexcept
+        {
+            return detail::apply_bit<op>(m_lhs.bit(i), m_rhs.bit(i));
+        }
+
+    private:
+        lhs_t m_lhs;
+        rhs_t m_rhs;
+    };
+
+    // ~operand, the bits after size() are never set in the results
+    template<bitset_expression operand_t>
+    class complement_expression final : public detail::expression_base
+    {
+    public:
+        using bitset_type = typename operand_t::bitset_type;
+
+        explicit complement_expression(const operand_t& operand) noexcept
+          : m_operand(operand)
+        {
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_operand.size();
+        }
+
+        template<typename lane_t>
+        void lane(size_t i, lane_t& result) const noexcept
+        {
+            m_operand.lane(i, result);
+            result = ~result;
+        }
+
+        [[nodiscard]] auto block(size_t i) const noexcept
+        {
+            const auto block = m_operand.block(i);
+            return static_cast<decltype(block)>(~block);
+        }
+
+        [[nodiscard]] bool bit(size_t i) const noexcept
+        {
+            return !m_operand.bit(i);
+        }
+
+    private:
+        operand_t m_operand;
+    };
+
+    template<typename dynamic_bitset_t>
+    [[nodiscard]] terminal_expression<dynamic_bitset_t> expr(const dynamic_bitset_t& bitset) noexcept
+    {
+        return terminal_expression<dynamic_bitset_t>(bitset);
+    }
+
+    template<bitset_expression lhs_t, bitset_expression rhs_t>
+    [[nodiscard]] auto operator|(const lhs_t& lhs, const rhs_t& rhs) noexcept
+    {
+        return binary_expression<kernels::simd::operation::bit_or, lhs_t, rhs_t>(lhs, rhs);
+    }
+
+    template<bitset_expression lhs_t, bitset_expression rhs_t>
+    [[nodiscard]] auto operator&(const lhs_t& lhs, const rhs_t& rhs) noexcept
+    {
+        return binary_expression<kernels::simd::operation::bit_and, lhs_t, rhs_t>(lhs, rhs);
+    }
+
+    template<bitset_expression lhs_t, bitset_expression rhs_t>
+    [[nodiscard]] auto operator^(const lhs_t& lhs, const rhs_t& rhs) noexcept
+    {
+        return binary_expression<kernels::simd::operation::bit_xor, lhs_t, rhs_t>(lhs, rhs);
+    }
+
+    // lhs & ~rhs
+    template<bitset_expression lhs_t, bitset_expression rhs_t>
+    [[nodiscard]] auto operator-(const lhs_t& lhs, const rhs_t& rhs) noexcept
+    {
+        return binary_expression<kernels::simd::operation::bit_andnot, lhs_t, rhs_t>(lhs, rhs);
+    }
+
+    template<bitset_expression operand_t>
+    [[nodiscard]] auto operator~(const operand_t& operand) noexcept
+    {
+        return complement_expression<operand_t>(operand);
+    }
+
+    namespace detail
+    {
+        // blocks [first, i) of result = expression, sizeof(lane_t) bytes at a time, returns i
+        // a lane is always read from the operands before being written to result
+        template<typename lane_t, typename block_t, typename expression_t>
+        [[nodiscard]] inline size_t
+        eval_lanes(block_t* data, size_t first, size_t size, const expression_t& expression) noexcept
+        {
+            constexpr size_t step = sizeof(lane_t) / sizeof(block_t);
+            const auto store_lane = [&](size_t i) noexcept
+            {
+                lane_t lane;
+                expression.lane(i, lane);
+                std::memcpy(data + i, &lane, sizeof(lane));
+            };
+
+            size_t i = first;
+            for(; i + 4 * step <= size; i += 4 * step)
+            {
+                store_lane(i);
+                store_lane(i + step);
+                store_lane(i + 2 * step);
+                store_lane(i + 3 * step);
+            }
+            for(; i + step <= size; i += step)
+            {
+                store_lane(i);
+            }
+            return i;
+        }
+
+#ifdef FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+        template<typename block_t, typename expression_t>
+        FIX_DYNAMIC_BITSET_TARGET("avx2")
+        size_t eval_avx2(block_t* data, size_t size, const expression_t& expression) noexcept
+        {
+            return eval_lanes<__m256i>(data, 0, size, expression);
+        }
+
+        template<typename block_t, typename expression_t>
+        FIX_DYNAMIC_BITSET_TARGET("avx512f,avx512bw")
+        size_t eval_avx512(block_t* data, size_t size, const expression_t& expression) noexcept
+        {
+            return eval_lanes<__m512i>(data, 0, size, expression);
+        }
+#endif
+
+        // blocks [0, i) of result = expression with the vectors of the selected instruction set, returns i
+        template<typename block_t, typename expression_t>
+        [[nodiscard]] size_t eval_blocks(block_t* data, size_t size, const expression_t& expression) noexcept
+        {
+#ifdef FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+            switch(kernels::selected_isa())
+            {
+                case kernels::isa::avx512_vpopcntdq:
+                case kernels::isa::avx512bw:
+                    return eval_avx512(data, size, expression);
+                case kernels::isa::avx2:
+                    return eval_avx2(data, size, expression);
+                case kernels::isa::sse4_2:
+                case kernels::isa::scalar:
+                    break;
+            }
+#else
+            static_cast<void>(data);
+            static_cast<void>(size);
+            static_cast<void>(expression);
+#endif
+            return 0;
+        }
+
+#ifdef FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+        template<typename block_t, typename expression_t>
+        FIX_DYNAMIC_BITSET_TARGET("avx2")
+        size_t count_avx2(size_t size, const expression_t& expression, size_t& result) noexcept
+        {
+            constexpr size_t step = sizeof(__m256i) / sizeof(block_t);
+            __m256i accumulator = _mm256_setzero_si256();
+            size_t i = 0;
+            for(; i + step <= size; i += step)
+            {
+                __m256i lane;
+                expression.lane(i, lane);
+                accumulator = _mm256_add_epi64(accumulator, kernels::simd::detail::popcount_avx2(lane));
+            }
+            result += kernels::simd::detail::reduce_add_avx2(accumulator);
+            return i;
+        }
+
+        template<typename block_t, typename expression_t>
+        FIX_DYNAMIC_BITSET_TARGET("avx512f,avx512bw")
+        size_t count_avx512bw(size_t size, const expression_t& expression, size_t& result) noexcept
+        {
+            constexpr size_t step = sizeof(__m512i) / sizeof(block_t);
+            __m512i accumulator = _mm512_setzero_si512();
+            size_t i = 0;
+            for(; i + step <= size; i += step)
+            {
+                __m512i lane;
+                expression.lane(i, lane);
+                accumulator = _mm512_add_epi64(accumulator, kernels::simd::detail::popcount_avx512bw(lane));
+            }
+            result += kernels::simd::detail::reduce_add_avx512(accumulator);
+            return i;
+        }
+
+        template<typename block_t, typename expression_t>
+        FIX_DYNAMIC_BITSET_TARGET("avx512f,avx512vpopcntdq")
+        size_t count_avx512_vpopcntdq(size_t size, const expression_t& expression, size_t& result) noexcept
+        {
+            constexpr size_t step = sizeof(__m512i) / sizeof(block_t);
+            __m512i accumulator = _mm512_setzero_si512();
+            size_t i = 0;
+            for(; i + step <= size; i += step)
+            {
+                __m512i lane;
+                expression.lane(i, lane);
+                accumulator = _mm512_add_epi64(accumulator, kernels::simd::detail::popcount_avx512_vpopcntdq(lane));
+            }
+            result += kernels::simd::detail::reduce_add_avx512(accumulator);
+            return i;
+        }
+#endif
+
+        // bits on in blocks [0, i) of the expression with the vectors of the selected instruction set added to result,
+        // returns i
+        template<typename block_t, typename expression_t>
+        [[nodiscard]] size_t count_blocks(size_t size, const expression_t& expression, size_t& result) noexcept
+        {
+#ifdef FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+            switch(kernels::selected_isa())
+            {
+                case kernels::isa::avx512_vpopcntdq:
+                    return count_avx512_vpopcntdq<block_t>(size, expression, result);
+                case kernels::isa::avx512bw:
+                    return count_avx512bw<block_t>(size, expression, result);
+                case kernels::isa::avx2:
+                    return count_avx2<block_t>(size, expression, result);
+                case kernels::isa::sse4_2:
+                case kernels::isa::scalar:
+                    break;
+            }
+#else
+            static_cast<void>(size);
+            static_cast<void>(expression);
+            static_cast<void>(result);
+#endif
+            return 0;
+        }
+    } // namespace detail
+
+    // result = expression, result must have the size of the expression operands and may be one of them
+    template<bitset_expression expression_t>
+    void eval(typename expression_t::bitset_type& result, const expression_t& expression) noexcept
+    {
+        using dynamic_bitset_t = typename expression_t::bitset_type;
+        assert(result.size() == expression.size());
+
+        // if kernels on blocks
+        if constexpr(has_blocks<dynamic_bitset_t>)
+        {
+            const auto result_blocks = blocks(result);
+            using block_t = typename decltype(result_blocks)::element_type;
+            const size_t size = result_blocks.size();
+            block_t* data = result_blocks.data();
+
+            size_t i = detail::eval_blocks(data, size, expression);
+            i = detail::eval_lanes<kernels::detail::word_t<block_t>>(data, i, size, expression);
+            for(; i < size; ++i)
+            {
+                data[i] = expression.block(i);
+            }
+
+            // keep the bits after size() off, complements set them
+            if(size != 0)
+            {
+                data[size - 1] =
+                  static_cast<block_t>(data[size - 1] & kernels::last_block_mask<block_t>(result.size()));
+            }
+        }
+        // bit by bit
+        else
+        {
+            for(size_t i = 0; i < result.size(); ++i)
+            {
+                do_set(result, i, expression.bit(i));
+            }
+        }
+    }
+
+    template<bitset_expression expression_t>
+    [[nodiscard]] typename expression_t::bitset_type eval(const expression_t& expression)
+    {
+        typename expression_t::bitset_type result(expression.size());
+        eval(result, expression);
+        return result;
+    }
+
+    // number of bits on in the result of the expression, without materializing it
+    template<bitset_expression expression_t>
+    [[nodiscard]] size_t count(const expression_t& expression) noexcept
+    {
+        using dynamic_bitset_t = typename expression_t::bitset_type;
+        const size_t bits = expression.size();
+
+        // if kernels on blocks
+        if constexpr(has_blocks<dynamic_bitset_t>)
+        {
+            using block_t = std::remove_const_t<typename detail::const_blocks<dynamic_bitset_t>::type::element_type>;
+            using word_t = kernels::detail::word_t<block_t>;
+            constexpr size_t step = kernels::detail::blocks_per_word<block_t>;
+            const auto word = [&](size_t i) noexcept
+            {
+                word_t value;
+                expression.lane(i, value);
+                return value;
+            };
+            const size_t size = (bits + kernels::bits_per_block<block_t> - 1) / kernels::bits_per_block<block_t>;
+            if(size == 0)
+            {
+                return 0;
+            }
+            const size_t full_blocks = size - 1;
+
+            // independent accumulators to not serialize on the popcount latency
+            size_t result_0 = 0;
+            size_t result_1 = 0;
+            size_t result_2 = 0;
+            size_t result_3 = 0;
+            size_t i = detail::count_blocks<block_t>(full_blocks, expression, result_0);
+            for(; i + 4 * step <= full_blocks; i += 4 * step)
+            {
+                result_0 += kernels::detail::popcount(word(i));
+                result_1 += kernels::detail::popcount(word(i + step));
+                result_2 += kernels::detail::popcount(word(i + 2 * step));
+                result_3 += kernels::detail::popcount(word(i + 3 * step));
+            }
+            for(; i + step <= full_blocks; i += step)
+            {
+                result_0 += kernels::detail::popcount(word(i));
+            }
+            for(; i < full_blocks; ++i)
+            {
+                result_0 += kernels::detail::popcount(expression.block(i));
+            }
+            result_0 += kernels::detail::popcount(
+              static_cast<block_t>(expression.block(full_blocks) & kernels::last_block_mask<block_t>(bits)));
+
+            return result_0 + result_1 + result_2 + result_3;
+        }
+        // bit by bit
+        else
+        {
+            size_t result = 0;
+            for(size_t i = 0; i < bits; ++i)
+            {
+                if(expression.bit(i))
+                {
+                    ++result;
+                }
+            }
+            return result;
+        }
+    }
+} // namespace fix::dynamic_bitset
@@ -0,0 +1,742 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <fix/kernels_simd.hpp>
+
+// Word kernels over the raw blocks of a dynamic bitset.
+//
+// Blocks are loaded 64 bits at a time whatever the block type, of at most 64 bits, the bits after the bitset size in
+// the last block are masked by the read kernels (std::vector<bool> leaves them unspecified) and left untouched by the
+// write kernels.
+// The bulk of count, any, all, the binary operations and their fused counts goes through the SIMD variant selected
+// at runtime (see kernels_simd.hpp), the word loops handle the remaining blocks.
+namespace fix::dynamic_bitset::kernels
+{
+    template<std::unsigned_integral block_t>
+    constexpr size_t bits_per_block = sizeof(block_t) * CHAR_BIT;
+
+    // mask of the valid bits in the last block of a bitset of the given size
+    template<std::unsigned_integral block_t>
+    [[nodiscard]] constexpr block_t last_block_mask(size_t bits) noexcept
+    {
+        const size_t last_block_bits = bits % bits_per_block<block_t>;
+        if(last_block_bits == 0)
+        {
+            return static_cast<block_t>(~block_t(0));
+        }
+        return static_cast<block_t>(static_cast<block_t>(~block_t(0)) >> (bits_per_block<block_t> - last_block_bits));
+    }
+
+    // bytes of the destination processed across all the operands of a reduction before moving to the next ones,
+    // small enough to stay in the L1 data cache
+    constexpr size_t reduce_tile_size = 8 * 1024;
+
+    namespace detail
+    {
+        template<std::unsigned_integral block_t>
+        using word_t = std::conditional_t<(sizeof(block_t) < sizeof(uint64_t)), uint64_t, block_t>;
+
+        template<std::unsigned_integral block_t>
+        constexpr size_t blocks_per_word = sizeof(word_t<block_t>) / sizeof(block_t);
+
+        // number of blocks processed per unrolled iteration
+        template<std::unsigned_integral block_t>
+        constexpr size_t blocks_per_unroll = 4 * blocks_per_word<block_t>;
+
+        template<std::unsigned_integral block_t>
+        [[nodiscard]] inline word_t<block_t> load(const block_t* blocks) noexcept
+        {
+            word_t<block_t> word;
+            std::memcpy(&word, blocks, sizeof(word));
+            return word;
+        }
+
+        template<std::unsigned_integral block_t>
+        inline void store(block_t* blocks, word_t<block_t> word) noexcept
+        {
+            std::memcpy(blocks, &word, sizeof(word));
+        }
+
+        template<std::unsigned_integral word_t>
+        [[nodiscard]] constexpr size_t popcount(word_t word) noexcept
+        {
+            return static_cast<size_t>(std::popcount(word));
+        }
+
+        // write the indices of the bits on of word, offset by base, return their number
+        // indices are written 4 at a time, up to 3 indices after the returned number are clobbered
+        inline size_t decode_word(uint64_t word, size_t base, size_t* indices) noexcept
+        {
+            const size_t count = popcount(word);
+            for(size_t i = 0; i < count; i += 4)
+            {
+                indices[i] = base + static_cast<size_t>(std::countr_zero(word));
+                word &= word - 1;
+                indices[i + 1] = base + static_cast<size_t>(std::countr_zero(word));
+                word &= word - 1;
+                indices[i + 2] = base + static_cast<size_t>(std::countr_zero(word));
+                word &= word - 1;
+                indices[i + 3] = base + static_cast<size_t>(std::countr_zero(word));
+                word &= word - 1;
+            }
+            return count;
+        }
+
+        template<simd::operation op, std::unsigned_integral word_t>
+        [[nodiscard]] constexpr word_t apply(word_t lhs, word_t rhs) noexcept
+        {
+            if constexpr(op == simd::operation::bit_or)
+            {
+                return static_cast<word_t>(lhs | rhs);
+            }
+            else if constexpr(op == simd::operation::bit_and)
+            {
+                return static_cast<word_t>(lhs & rhs);
+            }
+            else if constexpr(op == simd::operation::bit_andnot)
+            {
+                return static_cast<word_t>(lhs & ~rhs);
+            }
+            else
+            {
+                return static_cast<word_t>(lhs ^ rhs);
+            }
+        }
+
+        // apply lhs[i] = lhs[i] op rhs[i] on all blocks
+        template<simd::operation op, std::unsigned_integral block_t>
+        inline void transform(std::span<block_t> lhs, std::span<const block_t> rhs) noexcept
+        {
+            constexpr size_t step = blocks_per_word<block_t>;
+            block_t* lhs_data = lhs.data();
+            const block_t* rhs_data = rhs.data();
+            const size_t size = lhs.size();
+            size_t i =
+              simd::transform<op>(std::as_writable_bytes(lhs).data(), std::as_bytes(rhs).data(), lhs.size_bytes())
+              / sizeof(block_t);
+            // GCC does not bound i by size when the size is known, as for std::bitset, and warns on the scalar loops
+#if defined(__GNUC__) && !defined(__clang__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Waggressive-loop-optimizations"
+#endif
+            for(; i + blocks_per_unroll<block_t> <= size; i += blocks_per_unroll<block_t>)
+            {
+                store(lhs_data + i, apply<op>(load(lhs_data + i), load(rhs_data + i)));
+                store(lhs_data + i + step, apply<op>(load(lhs_data + i + step), load(rhs_data + i + step)));
+                store(lhs_data + i + 2 * step, apply<op>(load(lhs_data + i + 2 * step), load(rhs_data + i + 2 * step)));
+                store(lhs_data + i + 3 * step, apply<op>(load(lhs_data + i + 3 * step), load(rhs_data + i + 3 * step)));
+            }
+            for(; i + step <= size; i += step)
+            {
+                store(lhs_data + i, apply<op>(load(lhs_data + i), load(rhs_data + i)));
+            }
+            for(; i < size; ++i)
+            {
+                lhs_data[i] = apply<op>(lhs_data[i], rhs_data[i]);
+            }
+#if defined(__GNUC__) && !defined(__clang__)
+#    pragma GCC diagnostic pop
+#endif
+        }
+
+        // count of the bits on in lhs op rhs
+        template<simd::operation op, std::unsigned_integral block_t>
+        [[nodiscard]] inline size_t
+        transform_count(std::span<const block_t> lhs, std::span<const block_t> rhs, size_t bits) noexcept
+        {
+            if(lhs.empty())
+            {
+                return 0;
+            }
+
+            constexpr size_t step = blocks_per_word<block_t>;
+            const block_t* lhs_data = lhs.data();
+            const block_t* rhs_data = rhs.data();
+            const size_t full_blocks = lhs.size() - 1;
+
+            // independent accumulators to not serialize on the popcount latency
+            size_t result_0 = 0;
+            size_t result_1 = 0;
+            size_t result_2 = 0;
+            size_t result_3 = 0;
+            size_t i = simd::transform_count<op>(std::as_bytes(lhs).data(),
+                                                 std::as_bytes(rhs).data(),
+                                                 full_blocks * sizeof(block_t),
+                                                 result_0)
+                       / sizeof(block_t);
+            for(; i + blocks_per_unroll<block_t> <= full_blocks; i += blocks_per_unroll<block_t>)
+            {
+                result_0 += popcount(apply<op>(load(lhs_data + i), load(rhs_data + i)));
+                result_1 += popcount(apply<op>(load(lhs_data + i + step), load(rhs_data + i + step)));
+                result_2 += popcount(apply<op>(load(lhs_data + i + 2 * step), load(rhs_data + i + 2 * step)));
+                result_3 += popcount(apply<op>(load(lhs_data + i + 3 * step), load(rhs_data + i + 3 * step)));
+            }
+            for(; i + step <= full_blocks; i += step)
+            {
+                result_0 += popcount(apply<op>(load(lhs_data + i), load(rhs_data + i)));
+            }
+            for(; i < full_blocks; ++i)
+            {
+                result_0 += popcount(apply<op>(lhs_data[i], rhs_data[i]));
+            }
+            const block_t last_block = apply<op>(lhs_data[full_blocks], rhs_data[full_blocks]);
+            result_0 += popcount(static_cast<block_t>(last_block & last_block_mask<block_t>(bits)));
+
+            return result_0 + result_1 + result_2 + result_3;
+        }
+
+        // apply lhs = lhs op operand for each operand, one tile of lhs at a time so it is loaded from and stored to
+        // memory once instead of once per operand
+        template<simd::operation op, std::unsigned_integral block_t, std::ranges::forward_range Operands>
+        inline void transform_reduce(std::span<block_t> lhs, Operands&& operands) noexcept
+        {
+            constexpr size_t tile_blocks = reduce_tile_size / sizeof(block_t);
+            for(size_t begin = 0; begin < lhs.size(); begin += tile_blocks)
+            {
+                const std::span<block_t> tile = lhs.subspan(begin, std::min(tile_blocks, lhs.size() - begin));
+                for(const std::span<const block_t> operand: operands)
+                {
+                    transform<op>(tile, operand.subspan(begin, tile.size()));
+                }
+            }
+        }
+
+        // number of blocks before the first one aligned for the non-temporal stores
+        template<std::unsigned_integral block_t>
+        [[nodiscard]] inline size_t stream_head(const block_t* data, size_t size) noexcept
+        {
+            const size_t misalignment = reinterpret_cast<uintptr_t>(data) % simd::stream_alignment;
+            const size_t head = misalignment == 0 ? 0 : (simd::stream_alignment - misalignment) / sizeof(block_t);
+            return std::min(head, size);
+        }
+
+        // lhs = lhs op rhs, the aligned vectors of lhs are written with non-temporal stores
+        template<simd::operation op, std::unsigned_integral block_t>
+        inline void stream_transform(std::span<block_t> lhs, std::span<const block_t> rhs) noexcept
+        {
+            const size_t head = stream_head(lhs.data(), lhs.size());
+            const std::span<block_t> aligned = lhs.subspan(head);
+            transform<op>(lhs.first(head), rhs.first(head));
+            const size_t streamed = simd::stream_transform<op>(std::as_writable_bytes(aligned).data(),
+                                                               std::as_bytes(rhs.subspan(head)).data(),
+                                                               aligned.size_bytes())
+                                    / sizeof(block_t);
+            transform<op>(aligned.subspan(streamed), rhs.subspan(head + streamed));
+        }
+    } // namespace detail
+
+    template<std::unsigned_integral block_t>
+    [[nodiscard]] inline size_t count(std::span<const block_t> blocks, size_t bits) noexcept
+    {
+        if(blocks.empty())
+        {
+            return 0;
+        }
+
+        constexpr size_t step = detail::blocks_per_word<block_t>;
+        const block_t* data = blocks.data();
+        const size_t full_blocks = blocks.size() - 1;
+
+        // independent accumulators to not serialize on the popcount latency
+        size_t result_0 = 0;
+        size_t result_1 = 0;
+        size_t result_2 = 0;
+        size_t result_3 = 0;
+        const std::span<const std::byte> full_bytes = std::as_bytes(blocks.first(full_blocks));
+        size_t i = simd::count(full_bytes.data(), full_bytes.size(), result_0) / sizeof(block_t);
+        for(; i + detail::blocks_per_unroll<block_t> <= full_blocks; i += detail::blocks_per_unroll<block_t>)
+        {
+            result_0 += detail::popcount(detail::load(data + i));
+            result_1 += detail::popcount(detail::load(data + i + step));
+            result_2 += detail::popcount(detail::load(data + i + 2 * step));
+            result_3 += detail::popcount(detail::load(data + i + 3 * step));
+        }
+        for(; i + step <= full_blocks; i += step)
+        {
+            result_0 += detail::popcount(detail::load(data + i));
+        }
+        for(; i < full_blocks; ++i)
+        {
+            result_0 += detail::popcount(data[i]);
+        }
+        result_0 += detail::popcount(static_cast<block_t>(data[full_blocks] & last_block_mask<block_t>(bits)));
+
+        return result_0 + result_1 + result_2 + result_3;
+    }
+
+    template<std::unsigned_integral block_t>
+    inline void or_equal(std::span<block_t> lhs, std::span<const block_t> rhs) noexcept
+    {
+        detail::transform<simd::operation::bit_or>(lhs, rhs);
+    }
+
+    template<std::unsigned_integral block_t>
+    inline void and_equal(std::span<block_t> lhs, std::span<const block_t> rhs) noexcept
+    {
+        detail::transform<simd::operation::bit_and>(lhs, rhs);
+    }
+
+    template<std::unsigned_integral block_t>
+    inline void minus_equal(std::span<block_t> lhs, std::span<const block_t> rhs) noexcept
+    {
+        detail::transform<simd::operation::bit_andnot>(lhs, rhs);
+    }
+
+    template<std::unsigned_integral block_t>
+    inline void xor_equal(std::span<block_t> lhs, std::span<const block_t> rhs) noexcept
+    {
+        detail::transform<simd::operation::bit_xor>(lhs, rhs);
+    }
+
+    // lhs |= operand for each operand, operands is a range of blocks spans
+    template<std::unsigned_integral block_t, std::ranges::forward_range Operands>
+    inline void or_reduce(std::span<block_t> lhs, Operands&& operands) noexcept
+    {
+        detail::transform_reduce<simd::operation::bit_or>(lhs, std::forward<Operands>(operands));
+    }
+
+    // lhs &= operand for each operand, operands is a range of blocks spans
+    template<std::unsigned_integral block_t, std::ranges::forward_range Operands>
+    inline void and_reduce(std::span<block_t> lhs, Operands&& operands) noexcept
+    {
+        detail::transform_reduce<simd::operation::bit_and>(lhs, std::forward<Operands>(operands));
+    }
+
+    // Non-temporal variants of the write kernels: the destination is written around the caches, which saves the
+    // read for ownership of reset() and keeps the caches for other data when the destination is much larger than the
+    // last level cache. Without SIMD dispatch they use regular stores.
+
+    template<std::unsigned_integral block_t>
+    inline void stream_reset(std::span<block_t> blocks) noexcept
+    {
+        const size_t head = detail::stream_head(blocks.data(), blocks.size());
+        const std::span<block_t> aligned = blocks.subspan(head);
+        const size_t streamed =
+          simd::stream_zero(std::as_writable_bytes(aligned).data(), aligned.size_bytes()) / sizeof(block_t);
+        std::ranges::fill(blocks.first(head), block_t(0));
+        std::ranges::fill(aligned.subspan(streamed), block_t(0));
+    }
+
+    template<std::unsigned_integral block_t>
+    inline void stream_or_equal(std::span<block_t> lhs, std::span<const block_t> rhs) noexcept
+    {
+        detail::stream_transform<simd::operation::bit_or>(lhs, rhs);
+    }
+
+    template<std::unsigned_integral block_t>
+    inline void stream_and_equal(std::span<block_t> lhs, std::span<const block_t> rhs) noexcept
+    {
+        detail::stream_transform<simd::operation::bit_and>(lhs, rhs);
+    }
+
+    template<std::unsigned_integral block_t>
+    inline void stream_minus_equal(std::span<block_t> lhs, std::span<const block_t> rhs) noexcept
+    {
+        detail::stream_transform<simd::operation::bit_andnot>(lhs, rhs);
+    }
+
+    template<std::unsigned_integral block_t>
+    inline void stream_xor_equal(std::span<block_t> lhs, std::span<const block_t> rhs) noexcept
+    {
+        detail::stream_transform<simd::operation::bit_xor>(lhs, rhs);
+    }
+
+    // count(lhs | rhs) without materializing the result
+    template<std::unsigned_integral block_t>
+    [[nodiscard]] inline size_t
+    or_count(std::span<const block_t> lhs, std::span<const block_t> rhs, size_t bits) noexcept
+    {
+        return detail::transform_count<simd::operation::bit_or>(lhs, rhs, bits);
+    }
+
+    // count(lhs & rhs) without materializing the result
+    template<std::unsigned_integral block_t>
+    [[nodiscard]] inline size_t
+    and_count(std::span<const block_t> lhs, std::span<const block_t> rhs, size_t bits) noexcept
+    {
+        return detail::transform_count<simd::operation::bit_and>(lhs, rhs, bits);
+    }
+
+    // count(lhs & ~rhs) without materializing the result
+    template<std::unsigned_integral block_t>
+    [[nodiscard]] inline size_t
+    andnot_count(std::span<const block_t> lhs, std::span<const block_t> rhs, size_t bits) noexcept
+    {
+        return detail::transform_count<simd::operation::bit_andnot>(lhs, rhs, bits);
+    }
+
+    // Sparse operands: positions of the bits on of a bitset of the same size, in any order. A position costs a random
+    // access to its block instead of a pass over all the blocks, it is worth it for very sparse operands.
+
+    // blocks |= indices
+    template<std::unsigned_integral block_t>
+    inline void sparse_or_equal(std::span<block_t> blocks, std::span<const size_t> indices) noexcept
+    {
+        constexpr size_t bits = bits_per_block<block_t>;
+        for(const size_t index: indices)
+        {
+            assert(index / bits < blocks.size());
+            blocks[index / bits] |= static_cast<block_t>(block_t(1) << (index % bits));
+        }
+    }
+
+    // blocks &= ~indices
+    template<std::unsigned_integral block_t>
+    inline void sparse_minus_equal(std::span<block_t> blocks, std::span<const size_t> indices) noexcept
+    {
+        constexpr size_t bits = bits_per_block<block_t>;
+        for(const size_t index: indices)
+        {
+            assert(index / bits < blocks.size());
+            blocks[index / bits] &= static_cast<block_t>(~(block_t(1) << (index % bits)));
+        }
+    }
+
+    // count(indices & ~blocks): number of positions whose bit is off in blocks
+    template<std::unsigned_integral block_t>
+    [[nodiscard]] inline size_t sparse_andnot_count(std::span<const size_t> indices,
+                                                    std::span<const block_t> blocks) noexcept
+    {
+        constexpr size_t bits = bits_per_block<block_t>;
+        size_t result = indices.size();
+        for(const size_t index: indices)
+        {
+            assert(index / bits < blocks.size());
+            result -= static_cast<size_t>(blocks[index / bits] >> (index % bits)) & 1u;
+        }
+        return result;
+    }
+
+    namespace detail
+    {
+        // swap the bits of mask << width of the rows i with the bits of mask of the rows i + width, for the rows i
+        // with bit width of i off: one step of transpose_64x64, the inner loop on contiguous rows vectorizes
+        template<size_t width, uint64_t mask>
+        inline void transpose_step(std::span<uint64_t, 64> rows) noexcept
+        {
+            for(size_t first = 0; first < 64; first += 2 * width)
+            {
+                for(size_t i = first; i < first + width; ++i)
+                {
+                    const uint64_t swapped = ((rows[i] >> width) ^ rows[i + width]) & mask;
+                    rows[i] ^= swapped << width;
+                    rows[i + width] ^= swapped;
+                }
+            }
+        }
+    } // namespace detail
+
+    // in place transpose of a 64x64 bit matrix, bit j of rows[i] becomes bit i of rows[j]
+    // swaps the off-diagonal 32x32 quadrants, then the 16x16 ones inside them, down to single bits
+    inline void transpose_64x64(std::span<uint64_t, 64> rows) noexcept
+    {
+        detail::transpose_step<32, 0x00000000FFFFFFFFull>(rows);
+        detail::transpose_step<16, 0x0000FFFF0000FFFFull>(rows);
+        detail::transpose_step<8, 0x00FF00FF00FF00FFull>(rows);
+        detail::transpose_step<4, 0x0F0F0F0F0F0F0F0Full>(rows);
+        detail::transpose_step<2, 0x3333333333333333ull>(rows);
+        detail::transpose_step<1, 0x5555555555555555ull>(rows);
+    }
+
+    template<std::unsigned_integral block_t>
+    [[nodiscard]] inline bool any(std::span<const block_t> blocks, size_t bits) noexcept
+    {
+        if(blocks.empty())
+        {
+            return false;
+        }
+
+        constexpr size_t step = detail::blocks_per_word<block_t>;
+        const block_t* data = blocks.data();
+        const size_t full_blocks = blocks.size() - 1;
+        const std::span<const std::byte> full_bytes = std::as_bytes(blocks.first(full_blocks));
+        bool simd_any = false;
+        size_t i = simd::any(full_bytes.data(), full_bytes.size(), simd_any) / sizeof(block_t);
+        if(simd_any)
+        {
+            return true;
+        }
+        for(; i + detail::blocks_per_unroll<block_t> <= full_blocks; i += detail::blocks_per_unroll<block_t>)
+        {
+            // one branch per unrolled iteration
+            if((detail::load(data + i) | detail::load(data + i + step) | detail::load(data + i + 2 * step)
+                | detail::load(data + i + 3 * step))
+               != 0)
+            {
+                return true;
+            }
+        }
+        for(; i < full_blocks; ++i)
+        {
+            if(data[i] != block_t(0))
+            {
+                return true;
+            }
+        }
+        return (data[full_blocks] & last_block_mask<block_t>(bits)) != block_t(0);
+    }
+
+    template<std::unsigned_integral block_t>
+    [[nodiscard]] inline bool none(std::span<const block_t> blocks, size_t bits) noexcept
+    {
+        return !any(blocks, bits);
+    }
+
+    template<std::unsigned_integral block_t>
+    [[nodiscard]] inline bool all(std::span<const block_t> blocks, size_t bits) noexcept
+    {
+        if(blocks.empty())
+        {
+            return true;
+        }
+
+        using word_t = detail::word_t<block_t>;
+        constexpr size_t step = detail::blocks_per_word<block_t>;
+        constexpr word_t word_all = static_cast<word_t>(~word_t(0));
+        const block_t* data = blocks.data();
+        const size_t full_blocks = blocks.size() - 1;
+        const std::span<const std::byte> full_bytes = std::as_bytes(blocks.first(full_blocks));
+        bool simd_all = true;
+        size_t i = simd::all(full_bytes.data(), full_bytes.size(), simd_all) / sizeof(block_t);
+        if(!simd_all)
+        {
+            return false;
+        }
+        for(; i + detail::blocks_per_unroll<block_t> <= full_blocks; i += detail::blocks_per_unroll<block_t>)
+        {
+            // one branch per unrolled iteration
+            if((detail::load(data + i) & detail::load(data + i + step) & detail::load(data + i + 2 * step)
+                & detail::load(data + i + 3 * step))
+               != word_all)
+            {
+                return false;
+            }
+        }
+        for(; i < full_blocks; ++i)
+        {
+            if(data[i] != static_cast<block_t>(~block_t(0)))
+            {
+                return false;
+            }
+        }
+        const block_t mask = last_block_mask<block_t>(bits);
+        return (data[full_blocks] & mask) == mask;
+    }
+
+    template<std::unsigned_integral block_t>
+    [[nodiscard]] inline size_t find_first(std::span<const block_t> blocks, size_t bits) noexcept
+    {
+        constexpr size_t step = detail::blocks_per_word<block_t>;
+        const block_t* data = blocks.data();
+        const size_t size = blocks.size();
+        size_t i = 0;
+        // skip empty words, the last block is handled by the per block loop
+        while(i + step < size && detail::load(data + i) == 0)
+        {
+            i += step;
+        }
+        for(; i < size; ++i)
+        {
+            block_t block = data[i];
+            if(i == size - 1)
+            {
+                block &= last_block_mask<block_t>(bits);
+            }
+            if(block != block_t(0))
+            {
+                return i * bits_per_block<block_t> + static_cast<size_t>(std::countr_zero(block));
+            }
+        }
+        return std::numeric_limits<size_t>::max();
+    }
+
+    // call function(bit_pos, parameters...) for each bit on, stop early if function returns false
+    template<std::unsigned_integral block_t, typename Function, typename... Parameters>
+    inline void
+    iterate_bits_on(std::span<const block_t> blocks, size_t bits, Function&& function, Parameters&&... parameters)
+    {
+        constexpr size_t step = detail::blocks_per_word<block_t>;
+        const block_t* data = blocks.data();
+        const size_t size = blocks.size();
+        size_t i = 0;
+        while(i < size)
+        {
+            // skip empty words, the last block is handled by the per block path
+            if(i + step < size && detail::load(data + i) == 0)
+            {
+                i += step;
+                continue;
+            }
+
+            block_t block = data[i];
+            if(i == size - 1)
+            {
+                block &= last_block_mask<block_t>(bits);
+            }
+            while(block != block_t(0))
+            {
+                const size_t i_bit = i * bits_per_block<block_t> + static_cast<size_t>(std::countr_zero(block));
+                block &= static_cast<block_t>(block - 1);
+                if constexpr(std::same_as<std::invoke_result_t<Function, size_t, Parameters...>, void>)
+                {
+                    std::invoke(std::forward<Function>(function), i_bit, std::forward<Parameters>(parameters)...);
+                }
+                else
+                {
+                    if(!std::invoke(std::forward<Function>(function), i_bit, std::forward<Parameters>(parameters)...))
+                    {
+                        return;
+                    }
+                }
+            }
+            ++i;
+        }
+    }
+
+    // minimum size of the indices buffer of decode_bits_on, the bits on of a whole word
+    constexpr size_t decode_buffer_min_size = 64;
+
+    // decode the indices of the bits on from block block_position into indices, until the buffer could overflow,
+    // return the number of indices written and move block_position after the last decoded block
+    template<std::unsigned_integral block_t>
+    [[nodiscard]] inline size_t decode_bits_on(std::span<const block_t> blocks,
+                                               size_t bits,
+                                               size_t& block_position,
+                                               std::span<size_t> indices) noexcept
+    {
+        static_assert(sizeof(block_t) <= sizeof(uint64_t), "blocks are decoded as 64 bits words");
+        assert(indices.size() >= decode_buffer_min_size);
+
+        // a loaded word only maps to consecutive bits on little endian targets
+        constexpr bool use_words =
+          std::endian::native == std::endian::little || detail::blocks_per_word<block_t> == 1;
+        constexpr size_t step = use_words ? detail::blocks_per_word<block_t> : 1;
+        const block_t* data = blocks.data();
+        const size_t size = blocks.size();
+        size_t* output = indices.data();
+        size_t written = 0;
+        size_t i = block_position;
+        while(i < size && written + decode_buffer_min_size <= indices.size())
+        {
+            // the last block is handled by the per block path
+            if constexpr(use_words)
+            {
+                // skip empty words
+                while(i + step < size && detail::load(data + i) == 0)
+                {
+                    i += step;
+                }
+                if(i + step < size)
+                {
+                    const size_t base = i * bits_per_block<block_t>;
+                    written += detail::decode_word(detail::load(data + i), base, output + written);
+                    i += step;
+                    continue;
+                }
+            }
+
+            block_t block = data[i];
+            if(i == size - 1)
+            {
+                block &= last_block_mask<block_t>(bits);
+            }
+            written += detail::decode_word(block, i * bits_per_block<block_t>, output + written);
+            ++i;
+        }
+        block_position = i;
+        return written;
+    }
+
+    // call function(bits_on, parameters...) with spans of the indices of the bits on decoded in buffer,
+    // stop early if function returns false
+    // a buffer smaller than decode_buffer_min_size is filled one bit on at a time by iterate_bits_on
+    template<std::unsigned_integral block_t, typename Function, typename... Parameters>
+    inline void iterate_bits_on_batched(std::span<const block_t> blocks,
+                                        size_t bits,
+                                        std::span<size_t> buffer,
+                                        Function&& function,
+                                        Parameters&&... parameters)
+    {
+        assert(!buffer.empty());
+        if(buffer.size() < decode_buffer_min_size)
+        {
+            size_t buffered = 0;
+            bool stopped = false;
+            const auto flush = [&]()
+            {
+                const std::span<const size_t> bits_on(buffer.data(), buffered);
+                buffered = 0;
+                if constexpr(std::same_as<std::invoke_result_t<Function, std::span<const size_t>, Parameters...>,
+                                          void>)
+                {
+                    std::invoke(std::forward<Function>(function), bits_on, std::forward<Parameters>(parameters)...);
+                }
+                else
+                {
+                    stopped =
+                      !std::invoke(std::forward<Function>(function), bits_on, std::forward<Parameters>(parameters)...);
+                }
+            };
+            iterate_bits_on(blocks,
+                            bits,
+                            [&](size_t bit_on)
+                            {
+                                buffer[buffered++] = bit_on;
+                                if(buffered == buffer.size())
+                                {
+                                    flush();
+                                }
+                                return !stopped;
+                            });
+            if(buffered != 0 && !stopped)
+            {
+                flush();
+            }
+            return;
+        }
+
+        size_t block_position = 0;
+        while(block_position < blocks.size())
+        {
+            const size_t decoded = decode_bits_on(blocks, bits, block_position, buffer);
+            if(decoded == 0)
+            {
+                continue;
+            }
+
+            const std::span<const size_t> bits_on(buffer.data(), decoded);
+            if constexpr(std::same_as<std::invoke_result_t<Function, std::span<const size_t>, Parameters...>, void>)
+            {
+                std::invoke(std::forward<Function>(function), bits_on, std::forward<Parameters>(parameters)...);
+            }
+            else
+            {
+                if(!std::invoke(std::forward<Function>(function), bits_on, std::forward<Parameters>(parameters)...))
+                {
+                    return;
+                }
+            }
+        }
+    }
+} // namespace fix::dynamic_bitset::kernels
@@ -0,0 +1,780 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+
+// SIMD variants of the bulk kernels, compiled for several instruction sets with target attributes and selected once
+// at runtime from cpuid, the binary still runs on CPUs without any of them.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(FIX_DYNAMIC_BITSET_NO_SIMD_DISPATCH)
+#    define FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+#    include <immintrin.h>
+#    define FIX_DYNAMIC_BITSET_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+namespace fix::dynamic_bitset::kernels
+{
+    // ordered from the least to the most capable
+    enum class isa
+    {
+        scalar,
+        sse4_2,
+        avx2,
+        avx512bw,
+        avx512_vpopcntdq,
+    };
+
+    [[nodiscard]] constexpr std::string_view isa_name(isa value) noexcept
+    {
+        switch(value)
+        {
+            case isa::scalar:
+                return "scalar";
+            case isa::sse4_2:
+                return "sse4.2";
+            case isa::avx2:
+                return "avx2";
+            case isa::avx512bw:
+                return "avx512bw";
+            case isa::avx512_vpopcntdq:
+                return "avx512vpopcntdq";
+        }
+        return "unknown";
+    }
+
+    // most capable instruction set supported by the CPU and the OS
+    [[nodiscard]] inline isa detect_isa() noexcept
+    {
+#ifdef FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+        {
+            if(__builtin_cpu_supports("avx512vpopcntdq"))
+            {
+                return isa::avx512_vpopcntdq;
+            }
+            return isa::avx512bw;
+        }
+        if(__builtin_cpu_supports("avx2"))
+        {
+            return isa::avx2;
+        }
+        if(__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt"))
+        {
+            return isa::sse4_2;
+        }
+#endif
+        return isa::scalar;
+    }
+
+    namespace detail
+    {
+        // the FIX_DYNAMIC_BITSET_ISA environment variable can force a less capable instruction set
+        [[nodiscard]] inline isa select_isa() noexcept
+        {
+            const isa detected = detect_isa();
+#ifdef FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+            if(const char* requested_name = std::getenv("FIX_DYNAMIC_BITSET_ISA"))
+            {
+                constexpr std::array isas{
+                  isa::scalar, isa::sse4_2, isa::avx2, isa::avx512bw, isa::avx512_vpopcntdq};
+                for(const isa requested: isas)
+                {
+                    if(isa_name(requested) == requested_name)
+                    {
+                        return std::min(requested, detected);
+                    }
+                }
+            }
+#endif
+            return detected;
+        }
+    } // namespace detail
+
+    // instruction set used by the kernels, selected on first use
+    [[nodiscard]] inline isa selected_isa() noexcept
+    {
+        static const isa selected = detail::select_isa();
+        return selected;
+    }
+
+    namespace simd
+    {
+        // binary operations, lhs op rhs
+        enum class operation
+        {
+            bit_or,
+            bit_and,
+            bit_andnot,
+            bit_xor,
+        };
+
+#ifdef FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+        namespace detail
+        {
+            // SSE4.2: hardware popcnt on 64 bits words, 128 bits vectors
+
+            template<operation op>
+            FIX_DYNAMIC_BITSET_TARGET("sse4.2")
+            inline __m128i apply_sse4_2(__m128i lhs, __m128i rhs) noexcept
+            {
+                if constexpr(op == operation::bit_or)
+                {
+                    return _mm_or_si128(lhs, rhs);
+                }
+                else if constexpr(op == operation::bit_and)
+                {
+                    return _mm_and_si128(lhs, rhs);
+                }
+                else if constexpr(op == operation::bit_andnot)
+                {
+                    return _mm_andnot_si128(rhs, lhs);
+                }
+                else
+                {
+                    return _mm_xor_si128(lhs, rhs);
+                }
+            }
+
+            FIX_DYNAMIC_BITSET_TARGET("sse4.2,popcnt")
+            inline size_t popcount_sse4_2(__m128i value) noexcept
+            {
+                return static_cast<size_t>(_mm_popcnt_u64(static_cast<uint64_t>(_mm_cvtsi128_si64(value))))
+                       + static_cast<size_t>(_mm_popcnt_u64(static_cast<uint64_t>(_mm_extract_epi64(value, 1))));
+            }
+
+            FIX_DYNAMIC_BITSET_TARGET("sse4.2,popcnt")
+            inline size_t count_sse4_2(const std::byte* data, size_t vectors, size_t& result) noexcept
+            {
+                size_t count = 0;
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    count += popcount_sse4_2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data) + i));
+                }
+                result += count;
+                return vectors * sizeof(__m128i);
+            }
+
+            template<operation op>
+            FIX_DYNAMIC_BITSET_TARGET("sse4.2,popcnt")
+            inline size_t
+            transform_count_sse4_2(const std::byte* lhs, const std::byte* rhs, size_t vectors, size_t& result) noexcept
+            {
+                size_t count = 0;
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    const __m128i value = apply_sse4_2<op>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs) + i),
+                                                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs) + i));
+                    count += popcount_sse4_2(value);
+                }
+                result += count;
+                return vectors * sizeof(__m128i);
+            }
+
+            template<operation op>
+            FIX_DYNAMIC_BITSET_TARGET("sse4.2")
+            inline size_t transform_sse4_2(std::byte* lhs, const std::byte* rhs, size_t vectors) noexcept
+            {
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    __m128i* lhs_vector = reinterpret_cast<__m128i*>(lhs) + i;
+                    _mm_storeu_si128(lhs_vector,
+                                     apply_sse4_2<op>(_mm_loadu_si128(lhs_vector),
+                                                      _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs) + i)));
+                }
+                return vectors * sizeof(__m128i);
+            }
+
+            FIX_DYNAMIC_BITSET_TARGET("sse4.2")
+            inline bool any_sse4_2(const std::byte* data, size_t vectors) noexcept
+            {
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data) + i);
+                    if(!_mm_testz_si128(value, value))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            FIX_DYNAMIC_BITSET_TARGET("sse4.2")
+            inline bool all_sse4_2(const std::byte* data, size_t vectors) noexcept
+            {
+                const __m128i ones = _mm_set1_epi32(-1);
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data) + i);
+                    if(!_mm_testc_si128(value, ones))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            // non-temporal stores, data must be aligned on 16 bytes
+            FIX_DYNAMIC_BITSET_TARGET("sse4.2")
+            inline size_t stream_zero_sse4_2(std::byte* data, size_t vectors) noexcept
+            {
+                const __m128i zero = _mm_setzero_si128();
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    _mm_stream_si128(reinterpret_cast<__m128i*>(data) + i, zero);
+                }
+                _mm_sfence();
+                return vectors * sizeof(__m128i);
+            }
+
+            template<operation op>
+            FIX_DYNAMIC_BITSET_TARGET("sse4.2")
+            inline size_t stream_transform_sse4_2(std::byte* lhs, const std::byte* rhs, size_t vectors) noexcept
+            {
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    __m128i* lhs_vector = reinterpret_cast<__m128i*>(lhs) + i;
+                    const __m128i rhs_value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs) + i);
+                    _mm_stream_si128(lhs_vector, apply_sse4_2<op>(_mm_load_si128(lhs_vector), rhs_value));
+                }
+                _mm_sfence();
+                return vectors * sizeof(__m128i);
+            }
+
+            // AVX2: nibble lookup popcount (Mula), 256 bits vectors
+
+            template<operation op>
+            FIX_DYNAMIC_BITSET_TARGET("avx2")
+            inline __m256i apply_avx2(__m256i lhs, __m256i rhs) noexcept
+            {
+                if constexpr(op == operation::bit_or)
+                {
+                    return _mm256_or_si256(lhs, rhs);
+                }
+                else if constexpr(op == operation::bit_and)
+                {
+                    return _mm256_and_si256(lhs, rhs);
+                }
+                else if constexpr(op == operation::bit_andnot)
+                {
+                    return _mm256_andnot_si256(rhs, lhs);
+                }
+                else
+                {
+                    return _mm256_xor_si256(lhs, rhs);
+                }
+            }
+
+            // popcount of each 64 bits lane
+            FIX_DYNAMIC_BITSET_TARGET("avx2")
+            inline __m256i popcount_avx2(__m256i value) noexcept
+            {
+                const __m256i lookup = _mm256_setr_epi8(
+                  0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+                const __m256i low_mask = _mm256_set1_epi8(0x0f);
+                const __m256i low = _mm256_and_si256(value, low_mask);
+                const __m256i high = _mm256_and_si256(_mm256_srli_epi16(value, 4), low_mask);
+                const __m256i bytes_count =
+                  _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+                return _mm256_sad_epu8(bytes_count, _mm256_setzero_si256());
+            }
+
+            FIX_DYNAMIC_BITSET_TARGET("avx2")
+            inline size_t reduce_add_avx2(__m256i accumulator) noexcept
+            {
+                return static_cast<size_t>(_mm256_extract_epi64(accumulator, 0))
+                       + static_cast<size_t>(_mm256_extract_epi64(accumulator, 1))
+                       + static_cast<size_t>(_mm256_extract_epi64(accumulator, 2))
+                       + static_cast<size_t>(_mm256_extract_epi64(accumulator, 3));
+            }
+
+            FIX_DYNAMIC_BITSET_TARGET("avx2")
+            inline size_t count_avx2(const std::byte* data, size_t vectors, size_t& result) noexcept
+            {
+                __m256i accumulator = _mm256_setzero_si256();
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    accumulator = _mm256_add_epi64(
+                      accumulator, popcount_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data) + i)));
+                }
+                result += reduce_add_avx2(accumulator);
+                return vectors * sizeof(__m256i);
+            }
+
+            template<operation op>
+            FIX_DYNAMIC_BITSET_TARGET("avx2")
+            inline size_t
+            transform_count_avx2(const std::byte* lhs, const std::byte* rhs, size_t vectors, size_t& result) noexcept
+            {
+                __m256i accumulator = _mm256_setzero_si256();
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    const __m256i value =
+                      apply_avx2<op>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs) + i),
+                                     _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs) + i));
+                    accumulator = _mm256_add_epi64(accumulator, popcount_avx2(value));
+                }
+                result += reduce_add_avx2(accumulator);
+                return vectors * sizeof(__m256i);
+            }
+
+            template<operation op>
+            FIX_DYNAMIC_BITSET_TARGET("avx2")
+            inline size_t transform_avx2(std::byte* lhs, const std::byte* rhs, size_t vectors) noexcept
+            {
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    __m256i* lhs_vector = reinterpret_cast<__m256i*>(lhs) + i;
+                    _mm256_storeu_si256(lhs_vector,
+                                        apply_avx2<op>(_mm256_loadu_si256(lhs_vector),
+                                                       _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs) + i)));
+                }
+                return vectors * sizeof(__m256i);
+            }
+
+            FIX_DYNAMIC_BITSET_TARGET("avx2")
+            inline bool any_avx2(const std::byte* data, size_t vectors) noexcept
+            {
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data) + i);
+                    if(!_mm256_testz_si256(value, value))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            FIX_DYNAMIC_BITSET_TARGET("avx2")
+            inline bool all_avx2(const std::byte* data, size_t vectors) noexcept
+            {
+                const __m256i ones = _mm256_set1_epi32(-1);
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data) + i);
+                    if(!_mm256_testc_si256(value, ones))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            // non-temporal stores, data must be aligned on 32 bytes
+            FIX_DYNAMIC_BITSET_TARGET("avx2")
+            inline size_t stream_zero_avx2(std::byte* data, size_t vectors) noexcept
+            {
+                const __m256i zero = _mm256_setzero_si256();
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    _mm256_stream_si256(reinterpret_cast<__m256i*>(data) + i, zero);
+                }
+                _mm_sfence();
+                return vectors * sizeof(__m256i);
+            }
+
+            template<operation op>
+            FIX_DYNAMIC_BITSET_TARGET("avx2")
+            inline size_t stream_transform_avx2(std::byte* lhs, const std::byte* rhs, size_t vectors) noexcept
+            {
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    __m256i* lhs_vector = reinterpret_cast<__m256i*>(lhs) + i;
+                    const __m256i rhs_value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs) + i);
+                    _mm256_stream_si256(lhs_vector, apply_avx2<op>(_mm256_load_si256(lhs_vector), rhs_value));
+                }
+                _mm_sfence();
+                return vectors * sizeof(__m256i);
+            }
+
+            // AVX-512: 512 bits vectors, nibble lookup popcount with BW, native popcount with VPOPCNTDQ
+
+            template<operation op>
+            FIX_DYNAMIC_BITSET_TARGET("avx512f")
+            inline __m512i apply_avx512(__m512i lhs, __m512i rhs) noexcept
+            {
+                if constexpr(op == operation::bit_or)
+                {
+                    return _mm512_or_si512(lhs, rhs);
+                }
+                else if constexpr(op == operation::bit_and)
+                {
+                    return _mm512_and_si512(lhs, rhs);
+                }
+                else if constexpr(op == operation::bit_andnot)
+                {
+                    // lhs & ~rhs truth table, _mm512_andnot_si512 trips -Wmaybe-uninitialized on GCC 12
+                    return _mm512_ternarylogic_epi64(lhs, rhs, rhs, 0x30);
+                }
+                else
+                {
+                    return _mm512_xor_si512(lhs, rhs);
+                }
+            }
+
+            // popcount of each 64 bits lane
+            FIX_DYNAMIC_BITSET_TARGET("avx512f,avx512bw")
+            inline __m512i popcount_avx512bw(__m512i value) noexcept
+            {
+                // popcount of each nibble value, repeated in each 128 bits lane
+                const __m512i lookup = _mm512_set4_epi64(
+                  0x0403030203020201, 0x0302020102010100, 0x0403030203020201, 0x0302020102010100);
+                const __m512i low_mask = _mm512_set1_epi8(0x0f);
+                const __m512i low = _mm512_and_si512(value, low_mask);
+                const __m512i high = _mm512_and_si512(_mm512_srli_epi16(value, 4), low_mask);
+                const __m512i bytes_count =
+                  _mm512_add_epi8(_mm512_shuffle_epi8(lookup, low), _mm512_shuffle_epi8(lookup, high));
+                return _mm512_sad_epu8(bytes_count, _mm512_setzero_si512());
+            }
+
+            FIX_DYNAMIC_BITSET_TARGET("avx512f,avx512vpopcntdq")
+            inline __m512i popcount_avx512_vpopcntdq(__m512i value) noexcept
+            {
+                return _mm512_popcnt_epi64(value);
+            }
+
+            FIX_DYNAMIC_BITSET_TARGET("avx512f")
+            inline size_t reduce_add_avx512(__m512i accumulator) noexcept
+            {
+                alignas(sizeof(__m512i)) std::array<uint64_t, sizeof(__m512i) / sizeof(uint64_t)> lanes;
+                _mm512_store_si512(lanes.data(), accumulator);
+                size_t result = 0;
+                for(const uint64_t lane: lanes)
+                {
+                    result += static_cast<size_t>(lane);
+                }
+                return result;
+            }
+
+            FIX_DYNAMIC_BITSET_TARGET("avx512f,avx512bw")
+            inline size_t count_avx512bw(const std::byte* data, size_t vectors, size_t& result) noexcept
+            {
+                __m512i accumulator = _mm512_setzero_si512();
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    accumulator = _mm512_add_epi64(
+                      accumulator, popcount_avx512bw(_mm512_loadu_si512(reinterpret_cast<const __m512i*>(data) + i)));
+                }
+                result += reduce_add_avx512(accumulator);
+                return vectors * sizeof(__m512i);
+            }
+
+            template<operation op>
+            FIX_DYNAMIC_BITSET_TARGET("avx512f,avx512bw")
+            inline size_t transform_count_avx512bw(const std::byte* lhs,
+                                                   const std::byte* rhs,
+                                                   size_t vectors,
+                                                   size_t& result) noexcept
+            {
+                __m512i accumulator = _mm512_setzero_si512();
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    const __m512i value =
+                      apply_avx512<op>(_mm512_loadu_si512(reinterpret_cast<const __m512i*>(lhs) + i),
+                                       _mm512_loadu_si512(reinterpret_cast<const __m512i*>(rhs) + i));
+                    accumulator = _mm512_add_epi64(accumulator, popcount_avx512bw(value));
+                }
+                result += reduce_add_avx512(accumulator);
+                return vectors * sizeof(__m512i);
+            }
+
+            FIX_DYNAMIC_BITSET_TARGET("avx512f,avx512vpopcntdq")
+            inline size_t count_avx512_vpopcntdq(const std::byte* data, size_t vectors, size_t& result) noexcept
+            {
+                __m512i accumulator = _mm512_setzero_si512();
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    accumulator = _mm512_add_epi64(
+                      accumulator,
+                      popcount_avx512_vpopcntdq(_mm512_loadu_si512(reinterpret_cast<const __m512i*>(data) + i)));
+                }
+                result += reduce_add_avx512(accumulator);
+                return vectors * sizeof(__m512i);
+            }
+
+            template<operation op>
+            FIX_DYNAMIC_BITSET_TARGET("avx512f,avx512vpopcntdq")
+            inline size_t transform_count_avx512_vpopcntdq(const std::byte* lhs,
+                                                           const std::byte* rhs,
+                                                           size_t vectors,
+                                                           size_t& result) noexcept
+            {
+                __m512i accumulator = _mm512_setzero_si512();
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    const __m512i value =
+                      apply_avx512<op>(_mm512_loadu_si512(reinterpret_cast<const __m512i*>(lhs) + i),
+                                       _mm512_loadu_si512(reinterpret_cast<const __m512i*>(rhs) + i));
+                    accumulator = _mm512_add_epi64(accumulator, popcount_avx512_vpopcntdq(value));
+                }
+                result += reduce_add_avx512(accumulator);
+                return vectors * sizeof(__m512i);
+            }
+
+            template<operation op>
+            FIX_DYNAMIC_BITSET_TARGET("avx512f")
+            inline size_t transform_avx512(std::byte* lhs, const std::byte* rhs, size_t vectors) noexcept
+            {
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    __m512i* lhs_vector = reinterpret_cast<__m512i*>(lhs) + i;
+                    const __m512i rhs_value = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(rhs) + i);
+                    _mm512_storeu_si512(lhs_vector, apply_avx512<op>(_mm512_loadu_si512(lhs_vector), rhs_value));
+                }
+                return vectors * sizeof(__m512i);
+            }
+
+            FIX_DYNAMIC_BITSET_TARGET("avx512f")
+            inline bool any_avx512(const std::byte* data, size_t vectors) noexcept
+            {
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    const __m512i value = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(data) + i);
+                    if(_mm512_test_epi64_mask(value, value) != 0)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            FIX_DYNAMIC_BITSET_TARGET("avx512f")
+            inline bool all_avx512(const std::byte* data, size_t vectors) noexcept
+            {
+                const __m512i ones = _mm512_set1_epi32(-1);
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    const __m512i value = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(data) + i);
+                    if(_mm512_cmpneq_epu64_mask(value, ones) != 0)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            // non-temporal stores, data must be aligned on 64 bytes
+            FIX_DYNAMIC_BITSET_TARGET("avx512f")
+            inline size_t stream_zero_avx512(std::byte* data, size_t vectors) noexcept
+            {
+                const __m512i zero = _mm512_setzero_si512();
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    _mm512_stream_si512(reinterpret_cast<__m512i*>(data) + i, zero);
+                }
+                _mm_sfence();
+                return vectors * sizeof(__m512i);
+            }
+
+            template<operation op>
+            FIX_DYNAMIC_BITSET_TARGET("avx512f")
+            inline size_t stream_transform_avx512(std::byte* lhs, const std::byte* rhs, size_t vectors) noexcept
+            {
+                for(size_t i = 0; i < vectors; ++i)
+                {
+                    __m512i* lhs_vector = reinterpret_cast<__m512i*>(lhs) + i;
+                    const __m512i rhs_value = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(rhs) + i);
+                    _mm512_stream_si512(lhs_vector, apply_avx512<op>(_mm512_load_si512(lhs_vector), rhs_value));
+                }
+                _mm_sfence();
+                return vectors * sizeof(__m512i);
+            }
+        } // namespace detail
+#endif
+
+        // The dispatched functions process the largest prefix of whole vectors of the selected instruction set
+        // and return its size in bytes, the caller handles the remaining bytes.
+
+        inline size_t count(const std::byte* data, size_t size, size_t& result) noexcept
+        {
+#ifdef FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+            switch(selected_isa())
+            {
+                case isa::avx512_vpopcntdq:
+                    return detail::count_avx512_vpopcntdq(data, size / sizeof(__m512i), result);
+                case isa::avx512bw:
+                    return detail::count_avx512bw(data, size / sizeof(__m512i), result);
+                case isa::avx2:
+                    return detail::count_avx2(data, size / sizeof(__m256i), result);
+                case isa::sse4_2:
+                    return detail::count_sse4_2(data, size / sizeof(__m128i), result);
+                case isa::scalar:
+                    break;
+            }
+#else
+            static_cast<void>(data);
+            static_cast<void>(size);
+            static_cast<void>(result);
+#endif
+            return 0;
+        }
+
+        // count of lhs op rhs
+        template<operation op>
+        inline size_t transform_count(const std::byte* lhs, const std::byte* rhs, size_t size, size_t& result) noexcept
+        {
+#ifdef FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+            switch(selected_isa())
+            {
+                case isa::avx512_vpopcntdq:
+                    return detail::transform_count_avx512_vpopcntdq<op>(lhs, rhs, size / sizeof(__m512i), result);
+                case isa::avx512bw:
+                    return detail::transform_count_avx512bw<op>(lhs, rhs, size / sizeof(__m512i), result);
+                case isa::avx2:
+                    return detail::transform_count_avx2<op>(lhs, rhs, size / sizeof(__m256i), result);
+                case isa::sse4_2:
+                    return detail::transform_count_sse4_2<op>(lhs, rhs, size / sizeof(__m128i), result);
+                case isa::scalar:
+                    break;
+            }
+#else
+            static_cast<void>(lhs);
+            static_cast<void>(rhs);
+            static_cast<void>(size);
+            static_cast<void>(result);
+#endif
+            return 0;
+        }
+
+        // lhs = lhs op rhs
+        template<operation op>
+        inline size_t transform(std::byte* lhs, const std::byte* rhs, size_t size) noexcept
+        {
+#ifdef FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+            switch(selected_isa())
+            {
+                case isa::avx512_vpopcntdq:
+                case isa::avx512bw:
+                    return detail::transform_avx512<op>(lhs, rhs, size / sizeof(__m512i));
+                case isa::avx2:
+                    return detail::transform_avx2<op>(lhs, rhs, size / sizeof(__m256i));
+                case isa::sse4_2:
+                    return detail::transform_sse4_2<op>(lhs, rhs, size / sizeof(__m128i));
+                case isa::scalar:
+                    break;
+            }
+#else
+            static_cast<void>(lhs);
+            static_cast<void>(rhs);
+            static_cast<void>(size);
+#endif
+            return 0;
+        }
+
+        inline size_t any(const std::byte* data, size_t size, bool& result) noexcept
+        {
+#ifdef FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+            switch(selected_isa())
+            {
+                case isa::avx512_vpopcntdq:
+                case isa::avx512bw:
+                    result = detail::any_avx512(data, size / sizeof(__m512i));
+                    return size / sizeof(__m512i) * sizeof(__m512i);
+                case isa::avx2:
+                    result = detail::any_avx2(data, size / sizeof(__m256i));
+                    return size / sizeof(__m256i) * sizeof(__m256i);
+                case isa::sse4_2:
+                    result = detail::any_sse4_2(data, size / sizeof(__m128i));
+                    return size / sizeof(__m128i) * sizeof(__m128i);
+                case isa::scalar:
+                    break;
+            }
+#else
+            static_cast<void>(data);
+            static_cast<void>(size);
+#endif
+            result = false;
+            return 0;
+        }
+
+        inline size_t all(const std::byte* data, size_t size, bool& result) noexcept
+        {
+#ifdef FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+            switch(selected_isa())
+            {
+                case isa::avx512_vpopcntdq:
+                case isa::avx512bw:
+                    result = detail::all_avx512(data, size / sizeof(__m512i));
+                    return size / sizeof(__m512i) * sizeof(__m512i);
+                case isa::avx2:
+                    result = detail::all_avx2(data, size / sizeof(__m256i));
+                    return size / sizeof(__m256i) * sizeof(__m256i);
+                case isa::sse4_2:
+                    result = detail::all_sse4_2(data, size / sizeof(__m128i));
+                    return size / sizeof(__m128i) * sizeof(__m128i);
+                case isa::scalar:
+                    break;
+            }
+#else
+            static_cast<void>(data);
+            static_cast<void>(size);
+#endif
+            result = true;
+            return 0;
+        }
+
+        // alignment of the destination of the stream functions, the largest vector size
+        constexpr size_t stream_alignment = 64;
+
+        // data = 0 with non-temporal stores, data must be aligned on stream_alignment
+        // the stores are ordered with a store fence before returning
+        inline size_t stream_zero(std::byte* data, size_t size) noexcept
+        {
+#ifdef FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+            switch(selected_isa())
+            {
+                case isa::avx512_vpopcntdq:
+                case isa::avx512bw:
+                    return detail::stream_zero_avx512(data, size / sizeof(__m512i));
+                case isa::avx2:
+                    return detail::stream_zero_avx2(data, size / sizeof(__m256i));
+                case isa::sse4_2:
+                    return detail::stream_zero_sse4_2(data, size / sizeof(__m128i));
+                case isa::scalar:
+                    break;
+            }
+#else
+            static_cast<void>(data);
+            static_cast<void>(size);
+#endif
+            return 0;
+        }
+
+        // lhs = lhs op rhs with non-temporal stores, lhs must be aligned on stream_alignment
+        // the stores are ordered with a store fence before returning
+        template<operation op>
+        inline size_t stream_transform(std::byte* lhs, const std::byte* rhs, size_t size) noexcept
+        {
+#ifdef FIX_DYNAMIC_BITSET_SIMD_DISPATCH
+            switch(selected_isa())
+            {
+                case isa::avx512_vpopcntdq:
+                case isa::avx512bw:
+                    return detail::stream_transform_avx512<op>(lhs, rhs, size / sizeof(__m512i));
+                case isa::avx2:
+                    return detail::stream_transform_avx2<op>(lhs, rhs, size / sizeof(__m256i));
+                case isa::sse4_2:
+                    return detail::stream_transform_sse4_2<op>(lhs, rhs, size / sizeof(__m128i));
+                case isa::scalar:
+                    break;
+            }
+#else
+            static_cast<void>(lhs);
+            static_cast<void>(rhs);
+            static_cast<void>(size);
+#endif
+            return 0;
+        }
+    } // namespace simd
+} // namespace fix::dynamic_bitset::kernels
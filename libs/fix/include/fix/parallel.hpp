@@ -0,0 +1,393 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/census.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/kernels.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Multi-threaded versions of the fix adapters for very large bitsets.
+//
+// The blocks are split in ranges processed by the kernels on a thread pool. Bitsets smaller than threshold() bits,
+// pools of one thread and backends without kernels (or with a bitset_traits hook for the operation) use the serial
+// adapters.
+namespace fix::dynamic_bitset::parallel
+{
+    // fixed size thread pool, the thread calling run() works with the pool threads
+    class thread_pool final
+    {
+    public:
+        // threads: total number of threads working on a run() call, including the calling one
+        explicit thread_pool(size_t threads = std::max(1u, std::thread::hardware_concurrency()))
+        {
+            m_workers.reserve(threads - 1);
+            for(size_t i = 1; i < threads; ++i)
+            {
+                m_workers.emplace_back(&thread_pool::worker_loop, this);
+            }
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool(thread_pool&&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+        thread_pool& operator=(thread_pool&&) = delete;
+
+        ~thread_pool() noexcept
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                m_stop = true;
+            }
+            m_start.notify_all();
+            for(std::thread& worker: m_workers)
+            {
+                worker.join();
+            }
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_workers.size() + 1;
+        }
+
+        // call function(task) for each task in [0, tasks) on the pool threads, return when all tasks are done
+        // concurrent calls are serialized, function must not call run() on the same pool
+        template<typename Function>
+        void run(size_t tasks, Function&& function) noexcept
+        {
+            if(m_workers.empty() || tasks <= 1)
+            {
+                for(size_t task = 0; task < tasks; ++task)
+                {
+                    function(task);
+                }
+                return;
+            }
+
+            std::lock_guard run_lock(m_run_mutex);
+            {
+                std::lock_guard lock(m_mutex);
+                m_function = [](const void* context, size_t task) noexcept
+                {
+                    (*static_cast<std::remove_reference_t<Function>*>(const_cast<void*>(context)))(task);
+                };
+                m_context = std::addressof(function);
+                m_tasks = tasks;
+                m_next_task.store(0, std::memory_order_relaxed);
+                m_pending_workers = m_workers.size();
+                ++m_generation;
+            }
+            m_start.notify_all();
+            work();
+
+            // function and its captures must outlive the workers
+            std::unique_lock lock(m_mutex);
+            m_done.wait(lock, [this]() noexcept { return m_pending_workers == 0; });
+        }
+
+    private:
+        void work() noexcept
+        {
+            for(size_t task = m_next_task.fetch_add(1, std::memory_order_relaxed); task < m_tasks;
+                task = m_next_task.fetch_add(1, std::memory_order_relaxed))
+            {
+                m_function(m_context, task);
+            }
+        }
+
+        void worker_loop() noexcept
+        {
+            size_t generation = 0;
+            while(true)
+            {
+                {
+                    std::unique_lock lock(m_mutex);
+                    m_start.wait(lock, [&]() noexcept { return m_stop || m_generation != generation; });
+                    if(m_stop)
+                    {
+                        return;
+                    }
+                    generation = m_generation;
+                }
+                work();
+                {
+                    std::lock_guard lock(m_mutex);
+                    if(--m_pending_workers == 0)
+                    {
+                        m_done.notify_one();
+                    }
+                }
+            }
+        }
+
+        std::vector<std::thread> m_workers;
+        std::mutex m_run_mutex;
+        std::mutex m_mutex;
+        std::condition_variable m_start;
+        std::condition_variable m_done;
+        void (*m_function)(const void*, size_t) noexcept = nullptr;
+        const void* m_context = nullptr;
+        size_t m_tasks = 0;
+        std::atomic<size_t> m_next_task = 0;
+        size_t m_pending_workers = 0;
+        size_t m_generation = 0;
+        bool m_stop = false;
+    };
+
+    // pool used when none is given, started on first use with one thread per hardware thread
+    [[nodiscard]] inline thread_pool& default_thread_pool()
+    {
+        static thread_pool pool;
+        return pool;
+    }
+
+    // bitsets with less bits use the serial adapters, the thread pool synchronization costs more than it saves
+    constexpr size_t default_threshold = size_t(1) << 24u;
+
+    namespace detail
+    {
+        [[nodiscard]] inline std::atomic<size_t>& threshold_value() noexcept
+        {
+            static std::atomic<size_t> threshold = default_threshold;
+            return threshold;
+        }
+
+        // minimum bytes per task, multiple of the SIMD vectors size
+        constexpr size_t min_task_size = 256 * 1024;
+
+        // tasks per pool thread, more than one to balance the load between the threads
+        constexpr size_t tasks_per_thread = 4;
+
+        // call function(first_block, blocks_number) on ranges of blocks over the pool threads
+        template<std::unsigned_integral block_t, typename Function>
+        void run_on_blocks(thread_pool& pool, size_t blocks, Function&& function) noexcept
+        {
+            constexpr size_t min_task_blocks = min_task_size / sizeof(block_t);
+            const size_t wanted_tasks = pool.size() * tasks_per_thread;
+            const size_t task_blocks =
+              ((std::max((blocks + wanted_tasks - 1) / wanted_tasks, min_task_blocks) + min_task_blocks - 1)
+               / min_task_blocks)
+              * min_task_blocks;
+            const size_t tasks = (blocks + task_blocks - 1) / task_blocks;
+            pool.run(tasks,
+                     [&](size_t task) noexcept
+                     {
+                         const size_t first_block = task * task_blocks;
+                         function(first_block, std::min(task_blocks, blocks - first_block));
+                     });
+        }
+
+        // bits of the blocks [first_block, first_block + blocks_number) in a bitset of the given size
+        template<std::unsigned_integral block_t>
+        [[nodiscard]] constexpr size_t range_bits(size_t bits, size_t first_block, size_t blocks_number) noexcept
+        {
+            return std::min(bits - first_block * kernels::bits_per_block<block_t>,
+                            blocks_number * kernels::bits_per_block<block_t>);
+        }
+
+        template<typename dynamic_bitset_t>
+        using block_type =
+          std::remove_const_t<typename decltype(blocks(std::declval<const dynamic_bitset_t&>()))::element_type>;
+    } // namespace detail
+
+    // size in bits from which the parallel adapters use the thread pool
+    [[nodiscard]] inline size_t threshold() noexcept
+    {
+        return detail::threshold_value().load(std::memory_order_relaxed);
+    }
+
+    inline void set_threshold(size_t bits) noexcept
+    {
+        detail::threshold_value().store(bits, std::memory_order_relaxed);
+    }
+
+    template<typename dynamic_bitset_t>
+    [[nodiscard]] size_t do_count(const dynamic_bitset_t& bitset, thread_pool& pool = default_thread_pool()) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(count, bitset.size());
+        if constexpr(use_kernels<dynamic_bitset_t>
+                     && !requires { bitset_traits_t<dynamic_bitset_t>::count(bitset); })
+        {
+            if(bitset.size() >= threshold() && pool.size() > 1)
+            {
+                using block_t = detail::block_type<dynamic_bitset_t>;
+                const auto bitset_blocks = blocks(bitset);
+                std::atomic<size_t> result = 0;
+                detail::run_on_blocks<block_t>(
+                  pool,
+                  bitset_blocks.size(),
+                  [&](size_t first_block, size_t blocks_number) noexcept
+                  {
+                      result.fetch_add(
+                        kernels::count(bitset_blocks.subspan(first_block, blocks_number),
+                                       detail::range_bits<block_t>(bitset.size(), first_block, blocks_number)),
+                        std::memory_order_relaxed);
+                  });
+                return result.load(std::memory_order_relaxed);
+            }
+        }
+        return fix::dynamic_bitset::do_count(bitset);
+    }
+
+    template<typename dynamic_bitset_t>
+    void do_or_equal(dynamic_bitset_t& lhs,
+                     const dynamic_bitset_t& rhs,
+                     thread_pool& pool = default_thread_pool()) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(or_equal, lhs.size());
+        if constexpr(use_kernels<dynamic_bitset_t>
+                     && !requires { bitset_traits_t<dynamic_bitset_t>::or_equal(lhs, rhs); })
+        {
+            if(lhs.size() >= threshold() && pool.size() > 1)
+            {
+                assert(lhs.size() == rhs.size());
+                const auto lhs_blocks = blocks(lhs);
+                const auto rhs_blocks = blocks(rhs);
+                detail::run_on_blocks<detail::block_type<dynamic_bitset_t>>(
+                  pool,
+                  lhs_blocks.size(),
+                  [&](size_t first_block, size_t blocks_number) noexcept
+                  {
+                      kernels::or_equal(lhs_blocks.subspan(first_block, blocks_number),
+                                        rhs_blocks.subspan(first_block, blocks_number));
+                  });
+                return;
+            }
+        }
+        fix::dynamic_bitset::do_or_equal(lhs, rhs);
+    }
+
+    template<typename dynamic_bitset_t>
+    void do_and_equal(dynamic_bitset_t& lhs,
+                      const dynamic_bitset_t& rhs,
+                      thread_pool& pool = default_thread_pool()) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(and_equal, lhs.size());
+        if constexpr(use_kernels<dynamic_bitset_t>
+                     && !requires { bitset_traits_t<dynamic_bitset_t>::and_equal(lhs, rhs); })
+        {
+            if(lhs.size() >= threshold() && pool.size() > 1)
+            {
+                assert(lhs.size() == rhs.size());
+                const auto lhs_blocks = blocks(lhs);
+                const auto rhs_blocks = blocks(rhs);
+                detail::run_on_blocks<detail::block_type<dynamic_bitset_t>>(
+                  pool,
+                  lhs_blocks.size(),
+                  [&](size_t first_block, size_t blocks_number) noexcept
+                  {
+                      kernels::and_equal(lhs_blocks.subspan(first_block, blocks_number),
+                                         rhs_blocks.subspan(first_block, blocks_number));
+                  });
+                return;
+            }
+        }
+        fix::dynamic_bitset::do_and_equal(lhs, rhs);
+    }
+
+    // lhs &= ~rhs
+    template<typename dynamic_bitset_t>
+    void do_minus_equal(dynamic_bitset_t& lhs,
+                        const dynamic_bitset_t& rhs,
+                        thread_pool& pool = default_thread_pool()) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(minus_equal, lhs.size());
+        if constexpr(use_kernels<dynamic_bitset_t>
+                     && !requires { bitset_traits_t<dynamic_bitset_t>::minus_equal(lhs, rhs); })
+        {
+            if(lhs.size() >= threshold() && pool.size() > 1)
+            {
+                assert(lhs.size() == rhs.size());
+                const auto lhs_blocks = blocks(lhs);
+                const auto rhs_blocks = blocks(rhs);
+                detail::run_on_blocks<detail::block_type<dynamic_bitset_t>>(
+                  pool,
+                  lhs_blocks.size(),
+                  [&](size_t first_block, size_t blocks_number) noexcept
+                  {
+                      kernels::minus_equal(lhs_blocks.subspan(first_block, blocks_number),
+                                           rhs_blocks.subspan(first_block, blocks_number));
+                  });
+                return;
+            }
+        }
+        fix::dynamic_bitset::do_minus_equal(lhs, rhs);
+    }
+
+    template<typename dynamic_bitset_t>
+    [[nodiscard]] bool do_any(const dynamic_bitset_t& bitset, thread_pool& pool = default_thread_pool()) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(any, bitset.size());
+        if constexpr(use_kernels<dynamic_bitset_t> && !requires { bitset_traits_t<dynamic_bitset_t>::any(bitset); })
+        {
+            if(bitset.size() >= threshold() && pool.size() > 1)
+            {
+                using block_t = detail::block_type<dynamic_bitset_t>;
+                const auto bitset_blocks = blocks(bitset);
+                std::atomic<bool> result = false;
+                detail::run_on_blocks<block_t>(
+                  pool,
+                  bitset_blocks.size(),
+                  [&](size_t first_block, size_t blocks_number) noexcept
+                  {
+                      // skip the remaining tasks once a bit on is found
+                      if(!result.load(std::memory_order_relaxed)
+                         && kernels::any(bitset_blocks.subspan(first_block, blocks_number),
+                                         detail::range_bits<block_t>(bitset.size(), first_block, blocks_number)))
+                      {
+                          result.store(true, std::memory_order_relaxed);
+                      }
+                  });
+                return result.load(std::memory_order_relaxed);
+            }
+        }
+        return fix::dynamic_bitset::do_any(bitset);
+    }
+
+    template<typename dynamic_bitset_t>
+    [[nodiscard]] bool do_all(const dynamic_bitset_t& bitset, thread_pool& pool = default_thread_pool()) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(all, bitset.size());
+        if constexpr(use_kernels<dynamic_bitset_t> && !requires { bitset_traits_t<dynamic_bitset_t>::all(bitset); })
+        {
+            if(bitset.size() >= threshold() && pool.size() > 1)
+            {
+                using block_t = detail::block_type<dynamic_bitset_t>;
+                const auto bitset_blocks = blocks(bitset);
+                std::atomic<bool> result = true;
+                detail::run_on_blocks<block_t>(
+                  pool,
+                  bitset_blocks.size(),
+                  [&](size_t first_block, size_t blocks_number) noexcept
+                  {
+                      // skip the remaining tasks once a bit off is found
+                      if(result.load(std::memory_order_relaxed)
+                         && !kernels::all(bitset_blocks.subspan(first_block, blocks_number),
+                                          detail::range_bits<block_t>(bitset.size(), first_block, blocks_number)))
+                      {
+                          result.store(false, std::memory_order_relaxed);
+                      }
+                  });
+                return result.load(std::memory_order_relaxed);
+            }
+        }
+        return fix::dynamic_bitset::do_all(bitset);
+    }
+} // namespace fix::dynamic_bitset::parallel
@@ -0,0 +1,293 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/dynamic_bitset.hpp>
+#include <fix/kernels.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#if defined(__BMI2__)
+#    include <immintrin.h>
+#endif
+
+namespace fix::dynamic_bitset
+{
+    namespace detail
+    {
+        // position of the bit on of rank k in word, k must be lower than popcount(word)
+        [[nodiscard]] inline size_t select_in_word(uint64_t word, size_t k) noexcept
+        {
+            assert(k < static_cast<size_t>(std::popcount(word)));
+#if defined(__BMI2__)
+            return static_cast<size_t>(std::countr_zero(_pdep_u64(uint64_t(1) << k, word)));
+#else
+            for(size_t i = 0; i < k; ++i)
+            {
+                word &= word - 1;
+            }
+            return static_cast<size_t>(std::countr_zero(word));
+#endif
+        }
+    } // namespace detail
+
+    // Rank/select support over a dynamic bitset, the bitset itself is not stored and is given to each query.
+    // Bits changed after build() must be reported with bit_set()/bit_reset() to keep the index valid.
+    //
+    // Generic version, for dynamic bitsets without block access: the bitset own rank(pos) and select(k) when it has
+    // them (fix::roaring_bitset), linear scans otherwise.
+    template<typename dynamic_bitset_t>
+    class rank_select final
+    {
+    public:
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+        rank_select() noexcept = default;
+        explicit rank_select(const dynamic_bitset_t& bitset) noexcept
+        {
+            build(bitset);
+        }
+
+        void build(const dynamic_bitset_t& bitset) noexcept
+        {
+            m_count = do_count(bitset);
+        }
+
+        // number of bits on
+        [[nodiscard]] size_t count() const noexcept
+        {
+            return m_count;
+        }
+
+        // number of bits on before pos
+        [[nodiscard]] size_t rank(const dynamic_bitset_t& bitset, size_t pos) const noexcept
+        {
+            if constexpr(requires { bitset.rank(pos); })
+            {
+                return bitset.rank(pos);
+            }
+            size_t result = 0;
+            do_iterate_bits_on(bitset,
+                               [&](size_t bit_on) noexcept
+                               {
+                                   if(bit_on >= pos)
+                                   {
+                                       return false;
+                                   }
+                                   ++result;
+                                   return true;
+                               });
+            return result;
+        }
+
+        // position of the bit on of rank k (starting at 0), npos if k >= count()
+        [[nodiscard]] size_t select(const dynamic_bitset_t& bitset, size_t k) const noexcept
+        {
+            if constexpr(requires { bitset.select(k); })
+            {
+                return bitset.select(k);
+            }
+            size_t result = npos;
+            size_t current = 0;
+            do_iterate_bits_on(bitset,
+                               [&](size_t bit_on) noexcept
+                               {
+                                   if(current++ == k)
+                                   {
+                                       result = bit_on;
+                                       return false;
+                                   }
+                                   return true;
+                               });
+            return result;
+        }
+
+        // bit pos went from off to on
+        void bit_set(size_t pos) noexcept
+        {
+            static_cast<void>(pos);
+            ++m_count;
+        }
+
+        // bit pos went from on to off
+        void bit_reset(size_t pos) noexcept
+        {
+            static_cast<void>(pos);
+            assert(m_count > 0);
+            --m_count;
+        }
+
+    private:
+        size_t m_count = 0;
+    };
+
+    // Block version: a Fenwick tree over the counts of 512 bits superblocks, rank, select and updates cost
+    // O(log(bits / 512)) plus the popcount of at most one superblock.
+    template<has_blocks dynamic_bitset_t>
+    class rank_select<dynamic_bitset_t> final
+    {
+    public:
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+        static constexpr size_t superblock_bits = 512;
+
+        rank_select() noexcept = default;
+        explicit rank_select(const dynamic_bitset_t& bitset) noexcept
+        {
+            build(bitset);
+        }
+
+        void build(const dynamic_bitset_t& bitset) noexcept
+        {
+            const auto bitset_blocks = blocks(bitset);
+            const size_t bits = bitset.size();
+            const size_t superblocks = (bits + superblock_bits - 1) / superblock_bits;
+
+            // superblock counts, then the Fenwick tree built in place in O(superblocks)
+            m_tree.assign(superblocks + 1, 0);
+            m_count = 0;
+            for(size_t i = 0; i < superblocks; ++i)
+            {
+                const size_t first_bit = i * superblock_bits;
+                const size_t superblock_size = std::min(superblock_bits, bits - first_bit);
+                const size_t count = kernels::count(superblock(bitset_blocks, i, superblock_size), superblock_size);
+                m_tree[i + 1] = static_cast<uint32_t>(count);
+                m_count += count;
+            }
+            for(size_t i = 1; i <= superblocks; ++i)
+            {
+                const size_t parent = i + (i & (~i + 1));
+                if(parent <= superblocks)
+                {
+                    m_tree[parent] += m_tree[i];
+                }
+            }
+            m_top_step = superblocks == 0 ? 0 : std::bit_floor(superblocks);
+        }
+
+        // number of bits on
+        [[nodiscard]] size_t count() const noexcept
+        {
+            return m_count;
+        }
+
+        // number of bits on before pos
+        [[nodiscard]] size_t rank(const dynamic_bitset_t& bitset, size_t pos) const noexcept
+        {
+            assert(pos <= bitset.size());
+            const size_t superblock_number = pos / superblock_bits;
+
+            // bits on in the superblocks before
+            size_t result = 0;
+            for(size_t i = superblock_number; i > 0; i -= i & (~i + 1))
+            {
+                result += m_tree[i];
+            }
+
+            // bits on in the superblock before pos
+            const size_t remaining_bits = pos % superblock_bits;
+            if(remaining_bits != 0)
+            {
+                result += kernels::count(superblock(blocks(bitset), superblock_number, remaining_bits), remaining_bits);
+            }
+            return result;
+        }
+
+        // position of the bit on of rank k (starting at 0), npos if k >= count()
+        [[nodiscard]] size_t select(const dynamic_bitset_t& bitset, size_t k) const noexcept
+        {
+            if(k >= m_count)
+            {
+                return npos;
+            }
+
+            // Fenwick tree descent to the superblock containing the bit
+            const size_t superblocks = m_tree.size() - 1;
+            size_t superblock_number = 0;
+            size_t remaining = k;
+            for(size_t step = m_top_step; step != 0; step >>= 1)
+            {
+                const size_t next = superblock_number + step;
+                if(next <= superblocks && m_tree[next] <= remaining)
+                {
+                    superblock_number = next;
+                    remaining -= m_tree[next];
+                }
+            }
+
+            // scan the superblock
+            using block_t = block_type;
+            const auto superblock_blocks =
+              superblock(blocks(bitset),
+                         superblock_number,
+                         std::min(superblock_bits, bitset.size() - superblock_number * superblock_bits));
+            for(size_t i = 0; i < superblock_blocks.size(); ++i)
+            {
+                const block_t block = superblock_blocks[i];
+                const size_t block_count = static_cast<size_t>(std::popcount(block));
+                if(remaining < block_count)
+                {
+                    return superblock_number * superblock_bits + i * kernels::bits_per_block<block_t>
+                           + detail::select_in_word(block, remaining);
+                }
+                remaining -= block_count;
+            }
+            assert(false);
+            return npos;
+        }
+
+        // bit pos went from off to on
+        void bit_set(size_t pos) noexcept
+        {
+            for(size_t i = pos / superblock_bits + 1; i < m_tree.size(); i += i & (~i + 1))
+            {
+                ++m_tree[i];
+            }
+            ++m_count;
+        }
+
+        // bit pos went from on to off
+        void bit_reset(size_t pos) noexcept
+        {
+            assert(m_count > 0);
+            for(size_t i = pos / superblock_bits + 1; i < m_tree.size(); i += i & (~i + 1))
+            {
+                assert(m_tree[i] > 0);
+                --m_tree[i];
+            }
+            --m_count;
+        }
+
+    private:
+        using block_type =
+          std::remove_const_t<typename decltype(blocks(std::declval<const dynamic_bitset_t&>()))::element_type>;
+        static_assert(superblock_bits % kernels::bits_per_block<block_type> == 0);
+        static_assert(sizeof(block_type) <= sizeof(uint64_t), "blocks are selected in 64 bits words");
+
+        // blocks holding the first bits of a superblock
+        [[nodiscard]] static std::span<const block_type>
+        superblock(std::span<const block_type> bitset_blocks, size_t superblock_number, size_t bits) noexcept
+        {
+            constexpr size_t bits_per_block = kernels::bits_per_block<block_type>;
+            return bitset_blocks.subspan(superblock_number * (superblock_bits / bits_per_block),
+                                         (bits + bits_per_block - 1) / bits_per_block);
+        }
+
+        std::vector<uint32_t> m_tree; // 1-indexed Fenwick tree of superblock counts
+        size_t m_top_step = 0;
+        size_t m_count = 0;
+    };
+} // namespace fix::dynamic_bitset
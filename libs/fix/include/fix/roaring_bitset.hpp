@@ -0,0 +1,1429 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/bitset_traits.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Compressed dynamic bitset, Roaring-style.
+//
+// The bits are split in chunks of 2^16 bits, only the chunks with bits on are stored, each in the smallest of:
+// - array: the sorted positions of its bits on, up to 4 per word of its bitmap (array_max_cardinality for a whole
+//   chunk)
+// - bitmap: its bits in 1024 words, or in the words up to size() for the last chunk
+// - run: the [first, last] ranges of its consecutive bits on, made by the range operations and optimize()
+// The operations between two small arrays merge them, the others go through the words of a bitmap. An operation
+// result is an array or a bitmap, depending on its number of bits on.
+// It has no blocks: the fix adapters use its own operations, without temporary bitset for the fused counts.
+namespace fix
+{
+    class roaring_bitset final
+    {
+    public:
+        using size_type = size_t;
+
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+        static constexpr size_t chunk_bits = size_t(1) << 16u;
+        static constexpr size_t chunk_words = chunk_bits / 64;
+        // chunks with more bits on are bitmaps, an array of them would be larger than a bitmap
+        static constexpr size_t array_max_cardinality = 4096;
+
+        class reference final
+        {
+        public:
+            reference(roaring_bitset& bitset, size_t pos) noexcept
+              : m_bitset(bitset)
+              , m_pos(pos)
+            {
+            }
+
+            reference(const reference&) noexcept = default;
+
+            reference& operator=(bool value)
+            {
+                m_bitset.set(m_pos, value);
+                return *this;
+            }
+
+            reference& operator=(const reference& other)
+            {
+                m_bitset.set(m_pos, static_cast<bool>(other));
+                return *this;
+            }
+
+            [[nodiscard]] operator bool() const noexcept
+            {
+                return m_bitset.test(m_pos);
+            }
+
+            [[nodiscard]] bool operator~() const noexcept
+            {
+                return !m_bitset.test(m_pos);
+            }
+
+            reference& flip()
+            {
+                m_bitset.flip(m_pos);
+                return *this;
+            }
+
+        private:
+            roaring_bitset& m_bitset;
+            size_t m_pos;
+        };
+
+        roaring_bitset() noexcept = default;
+
+        // the first bits of init_val, the other bits off
+        explicit roaring_bitset(size_t nbits, unsigned long long init_val = 0)
+          : m_size(nbits)
+        {
+            for(size_t i = 0; i < std::min(nbits, sizeof(unsigned long long) * CHAR_BIT); ++i)
+            {
+                if(((init_val >> i) & 1u) != 0)
+                {
+                    set(i);
+                }
+            }
+        }
+
+        // the last character is the first bit, characters other than one are off
+        explicit roaring_bitset(std::string_view str, char one = '1')
+          : m_size(str.size())
+        {
+            for(size_t i = 0; i < m_size; ++i)
+            {
+                if(str[m_size - 1 - i] == one)
+                {
+                    set(i);
+                }
+            }
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        // number of stored chunks
+        [[nodiscard]] size_t num_chunks() const noexcept
+        {
+            return m_containers.size();
+        }
+
+        // bytes used by the bitset, including its heap storage
+        [[nodiscard]] size_t memory_footprint() const noexcept
+        {
+            size_t bytes = sizeof(*this) + m_containers.capacity() * sizeof(container);
+            for(const container& chunk: m_containers)
+            {
+                bytes += chunk.values.capacity() * sizeof(uint16_t) + chunk.words.capacity() * sizeof(uint64_t);
+            }
+            return bytes;
+        }
+
+        void resize(size_t nbits, bool value = false)
+        {
+            if(nbits < m_size)
+            {
+                const auto first_removed =
+                  std::ranges::lower_bound(m_containers, chunk_key(nbits + chunk_bits - 1), {}, &container::key);
+                m_containers.erase(first_removed, m_containers.end());
+                if(nbits % chunk_bits != 0 && !m_containers.empty() && m_containers.back().key == chunk_key(nbits))
+                {
+                    const uint32_t last_key = chunk_key(nbits);
+                    andnot_equal(m_containers.back(),
+                                 range_container(last_key, chunk_value(nbits), chunk_size(last_key)));
+                    remove_empty_containers();
+                }
+                m_size = nbits;
+                fit_last_container();
+            }
+            else if(nbits > m_size)
+            {
+                const size_t old_size = m_size;
+                m_size = nbits;
+                fit_last_container();
+                if(value)
+                {
+                    set_range(old_size, nbits);
+                }
+            }
+        }
+
+        void clear() noexcept
+        {
+            m_containers.clear();
+            m_size = 0;
+        }
+
+        void push_back(bool value)
+        {
+            ++m_size;
+            if(m_size % 64 == 1)
+            {
+                fit_last_container();
+            }
+            if(value)
+            {
+                set(m_size - 1);
+            }
+        }
+
+        void pop_back()
+        {
+            assert(!empty());
+            reset(m_size - 1);
+            --m_size;
+            if(m_size % 64 == 0)
+            {
+                fit_last_container();
+            }
+        }
+
+        [[nodiscard]] bool test(size_t pos) const noexcept
+        {
+            assert(pos < m_size);
+            const container* chunk = find_container(chunk_key(pos));
+            return chunk != nullptr && contains(*chunk, chunk_value(pos));
+        }
+
+        [[nodiscard]] bool operator[](size_t pos) const noexcept
+        {
+            return test(pos);
+        }
+
+        [[nodiscard]] reference operator[](size_t pos) noexcept
+        {
+            assert(pos < m_size);
+            return reference(*this, pos);
+        }
+
+        roaring_bitset& set(size_t pos, bool value = true)
+        {
+            assert(pos < m_size);
+            if(!value)
+            {
+                return reset(pos);
+            }
+            const uint32_t key = chunk_key(pos);
+            auto it = std::ranges::lower_bound(m_containers, key, {}, &container::key);
+            if(it == m_containers.end() || it->key != key)
+            {
+                it = m_containers.insert(it, empty_container(key));
+            }
+            add(*it, chunk_value(pos));
+            return *this;
+        }
+
+        roaring_bitset& set()
+        {
+            m_containers.clear();
+            set_range(0, m_size);
+            return *this;
+        }
+
+        roaring_bitset& reset(size_t pos)
+        {
+            assert(pos < m_size);
+            const auto it = std::ranges::lower_bound(m_containers, chunk_key(pos), {}, &container::key);
+            if(it != m_containers.end() && it->key == chunk_key(pos))
+            {
+                remove(*it, chunk_value(pos));
+                if(it->cardinality == 0)
+                {
+                    m_containers.erase(it);
+                }
+            }
+            return *this;
+        }
+
+        roaring_bitset& reset() noexcept
+        {
+            m_containers.clear();
+            return *this;
+        }
+
+        roaring_bitset& flip(size_t pos)
+        {
+            return set(pos, !test(pos));
+        }
+
+        roaring_bitset& flip()
+        {
+            roaring_bitset all_bits(m_size);
+            all_bits.set();
+            return *this ^= all_bits;
+        }
+
+        [[nodiscard]] size_t count() const noexcept
+        {
+            size_t result = 0;
+            for(const container& chunk: m_containers)
+            {
+                result += chunk.cardinality;
+            }
+            return result;
+        }
+
+        [[nodiscard]] bool any() const noexcept
+        {
+            return !m_containers.empty();
+        }
+
+        [[nodiscard]] bool none() const noexcept
+        {
+            return m_containers.empty();
+        }
+
+        [[nodiscard]] bool all() const noexcept
+        {
+            return count() == m_size;
+        }
+
+        // position of the first bit on, npos if none
+        [[nodiscard]] size_t find_first() const noexcept
+        {
+            if(m_containers.empty())
+            {
+                return npos;
+            }
+            return chunk_first_bit(m_containers.front()) + next_value(m_containers.front(), 0);
+        }
+
+        // position of the first bit on after prev, npos if none
+        [[nodiscard]] size_t find_next(size_t prev) const noexcept
+        {
+            const size_t pos = prev + 1;
+            if(pos >= m_size)
+            {
+                return npos;
+            }
+            auto it = std::ranges::lower_bound(m_containers, chunk_key(pos), {}, &container::key);
+            if(it != m_containers.end() && it->key == chunk_key(pos))
+            {
+                const uint32_t value = next_value(*it, chunk_value(pos));
+                if(value != chunk_bits)
+                {
+                    return chunk_first_bit(*it) + value;
+                }
+                ++it;
+            }
+            return it == m_containers.end() ? npos : chunk_first_bit(*it) + next_value(*it, 0);
+        }
+
+        // number of bits on before pos
+        [[nodiscard]] size_t rank(size_t pos) const noexcept
+        {
+            assert(pos <= m_size);
+            size_t result = 0;
+            for(const container& chunk: m_containers)
+            {
+                if(chunk.key >= chunk_key(pos))
+                {
+                    if(chunk.key == chunk_key(pos))
+                    {
+                        result += container_rank(chunk, chunk_value(pos));
+                    }
+                    break;
+                }
+                result += chunk.cardinality;
+            }
+            return result;
+        }
+
+        // position of the k-th bit on (from 0), npos if k >= count()
+        [[nodiscard]] size_t select(size_t k) const noexcept
+        {
+            for(const container& chunk: m_containers)
+            {
+                if(k < chunk.cardinality)
+                {
+                    return chunk_first_bit(chunk) + container_select(chunk, k);
+                }
+                k -= chunk.cardinality;
+            }
+            return npos;
+        }
+
+        // call function(bit_pos, parameters...) for each bit on, stop early if function returns false
+        template<typename Function, typename... Parameters>
+        void iterate_bits_on(Function&& function, Parameters&&... parameters) const
+        {
+            for(const container& chunk: m_containers)
+            {
+                const size_t first_bit = chunk_first_bit(chunk);
+                const auto call = [&](size_t value) -> bool
+                {
+                    if constexpr(std::is_same_v<std::invoke_result_t<Function, size_t, Parameters...>, void>)
+                    {
+                        std::invoke(function, first_bit + value, parameters...);
+                        return true;
+                    }
+                    else
+                    {
+                        return static_cast<bool>(std::invoke(function, first_bit + value, parameters...));
+                    }
+                };
+                if(!iterate_container(chunk, call))
+                {
+                    return;
+                }
+            }
+        }
+
+        // convert each chunk to its smallest representation, runs included, and release the unused memory
+        void optimize()
+        {
+            for(container& chunk: m_containers)
+            {
+                const size_t runs = runs_number(chunk);
+                const size_t run_bytes = runs * 2 * sizeof(uint16_t);
+                const size_t array_bytes = chunk.cardinality * sizeof(uint16_t);
+                const size_t bitmap_bytes = chunk.words_number * sizeof(uint64_t);
+                if(run_bytes < std::min(array_bytes, bitmap_bytes))
+                {
+                    if(chunk.kind != container_kind::run)
+                    {
+                        to_runs(chunk);
+                    }
+                }
+                else if(chunk.kind == container_kind::run)
+                {
+                    words_buffer words;
+                    to_words(chunk, words.data());
+                    assign_words(chunk, words.data());
+                }
+                chunk.values.shrink_to_fit();
+                chunk.words.shrink_to_fit();
+            }
+            m_containers.shrink_to_fit();
+        }
+
+        roaring_bitset& operator|=(const roaring_bitset& rhs)
+        {
+            assert(m_size == rhs.m_size);
+            merge_containers<true>(rhs, [](container& lhs_chunk, const container& rhs_chunk)
+                                   { or_equal(lhs_chunk, rhs_chunk); });
+            return *this;
+        }
+
+        roaring_bitset& operator&=(const roaring_bitset& rhs)
+        {
+            assert(m_size == rhs.m_size);
+            merge_containers<false>(rhs, [](container& lhs_chunk, const container& rhs_chunk)
+                                    { and_equal(lhs_chunk, rhs_chunk); });
+            return *this;
+        }
+
+        roaring_bitset& operator^=(const roaring_bitset& rhs)
+        {
+            assert(m_size == rhs.m_size);
+            merge_containers<true>(rhs, [](container& lhs_chunk, const container& rhs_chunk)
+                                   { xor_equal(lhs_chunk, rhs_chunk); });
+            return *this;
+        }
+
+        roaring_bitset& operator-=(const roaring_bitset& rhs)
+        {
+            assert(m_size == rhs.m_size);
+            merge_containers<false>(rhs, [](container& lhs_chunk, const container& rhs_chunk)
+                                    { andnot_equal(lhs_chunk, rhs_chunk); });
+            return *this;
+        }
+
+        [[nodiscard]] roaring_bitset operator~() const
+        {
+            roaring_bitset result = *this;
+            result.flip();
+            return result;
+        }
+
+        // count of *this & rhs, without temporary bitset
+        [[nodiscard]] size_t and_count(const roaring_bitset& rhs) const noexcept
+        {
+            assert(m_size == rhs.m_size);
+            size_t result = 0;
+            auto rhs_it = rhs.m_containers.begin();
+            for(const container& chunk: m_containers)
+            {
+                while(rhs_it != rhs.m_containers.end() && rhs_it->key < chunk.key)
+                {
+                    ++rhs_it;
+                }
+                if(rhs_it == rhs.m_containers.end())
+                {
+                    break;
+                }
+                if(rhs_it->key == chunk.key)
+                {
+                    result += container_and_count(chunk, *rhs_it);
+                }
+            }
+            return result;
+        }
+
+        // count of *this | rhs, without temporary bitset
+        [[nodiscard]] size_t or_count(const roaring_bitset& rhs) const noexcept
+        {
+            return count() + rhs.count() - and_count(rhs);
+        }
+
+        // count of *this & ~rhs, without temporary bitset
+        [[nodiscard]] size_t andnot_count(const roaring_bitset& rhs) const noexcept
+        {
+            return count() - and_count(rhs);
+        }
+
+        [[nodiscard]] bool operator==(const roaring_bitset& rhs) const noexcept
+        {
+            if(m_size != rhs.m_size || m_containers.size() != rhs.m_containers.size())
+            {
+                return false;
+            }
+            // the same bits can be stored in different kinds of chunks
+            for(size_t i = 0; i < m_containers.size(); ++i)
+            {
+                const container& lhs_chunk = m_containers[i];
+                const container& rhs_chunk = rhs.m_containers[i];
+                if(lhs_chunk.key != rhs_chunk.key || lhs_chunk.cardinality != rhs_chunk.cardinality
+                   || container_and_count(lhs_chunk, rhs_chunk) != lhs_chunk.cardinality)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        enum class container_kind : uint8_t
+        {
+            array,
+            bitmap,
+            run
+        };
+
+        struct container final
+        {
+            // index of the chunk
+            uint32_t key;
+            container_kind kind;
+            // number of words of the chunk bitmap, chunk_words but for the last chunk of small bitsets
+            uint16_t words_number;
+            // number of bits on, never 0 for a stored chunk
+            uint32_t cardinality;
+            // array: positions of the bits on in increasing order, run: first and last position of each run
+            std::vector<uint16_t> values;
+            // bitmap: words_number words
+            std::vector<uint64_t> words;
+        };
+
+        using words_buffer = std::array<uint64_t, chunk_words>;
+
+        // two arrays with at least this number of values are combined through words rather than merged
+        static constexpr size_t array_probe_min_values = 256;
+
+        [[nodiscard]] static constexpr uint32_t chunk_key(size_t pos) noexcept
+        {
+            return static_cast<uint32_t>(pos / chunk_bits);
+        }
+
+        [[nodiscard]] static constexpr uint16_t chunk_value(size_t pos) noexcept
+        {
+            return static_cast<uint16_t>(pos % chunk_bits);
+        }
+
+        [[nodiscard]] static constexpr size_t chunk_first_bit(const container& chunk) noexcept
+        {
+            return static_cast<size_t>(chunk.key) * chunk_bits;
+        }
+
+        // number of bits of chunk key below size()
+        [[nodiscard]] size_t chunk_size(uint32_t key) const noexcept
+        {
+            assert(static_cast<size_t>(key) * chunk_bits < m_size);
+            return std::min(chunk_bits, m_size - static_cast<size_t>(key) * chunk_bits);
+        }
+
+        [[nodiscard]] container empty_container(uint32_t key) const noexcept
+        {
+            return container{key, container_kind::array, static_cast<uint16_t>((chunk_size(key) + 63) / 64), 0, {}, {}};
+        }
+
+        // arrays with more values are larger than the bitmap of the chunk
+        [[nodiscard]] static size_t array_limit(const container& chunk) noexcept
+        {
+            return std::min(array_max_cardinality, size_t(4) * chunk.words_number);
+        }
+
+        // give the last chunk the words number of size(), after a size change
+        void fit_last_container()
+        {
+            if(m_containers.empty())
+            {
+                return;
+            }
+            container& chunk = m_containers.back();
+            const uint16_t words_number = empty_container(chunk.key).words_number;
+            if(chunk.words_number != words_number)
+            {
+                chunk.words_number = words_number;
+                if(chunk.kind == container_kind::bitmap)
+                {
+                    // the bits after size() are off, the removed words are empty
+                    chunk.words.resize(words_number, 0);
+                }
+            }
+        }
+
+        [[nodiscard]] const container* find_container(uint32_t key) const noexcept
+        {
+            const auto it = std::ranges::lower_bound(m_containers, key, {}, &container::key);
+            return it != m_containers.end() && it->key == key ? &*it : nullptr;
+        }
+
+        void remove_empty_containers() noexcept
+        {
+            std::erase_if(m_containers, [](const container& chunk) noexcept { return chunk.cardinality == 0; });
+        }
+
+        // chunk with the bits [first, end) on
+        [[nodiscard]] container range_container(uint32_t key, uint32_t first, size_t end) const
+        {
+            assert(first < end && end <= chunk_size(key));
+            container chunk = empty_container(key);
+            chunk.kind = container_kind::run;
+            chunk.cardinality = static_cast<uint32_t>(end - first);
+            chunk.values = {static_cast<uint16_t>(first), static_cast<uint16_t>(end - 1)};
+            return chunk;
+        }
+
+        // set the bits [first, end) on
+        void set_range(size_t first, size_t end)
+        {
+            std::vector<container> added;
+            auto it = m_containers.begin();
+            for(size_t chunk_first = first; chunk_first < end;)
+            {
+                const uint32_t key = chunk_key(chunk_first);
+                const size_t chunk_end = std::min(end, (static_cast<size_t>(key) + 1) * chunk_bits);
+                container range = range_container(key, chunk_value(chunk_first), chunk_end - key * chunk_bits);
+                it = std::lower_bound(it, m_containers.end(), key, [](const container& chunk, uint32_t chunk_key_)
+                                      { return chunk.key < chunk_key_; });
+                if(it != m_containers.end() && it->key == key)
+                {
+                    or_equal(*it, range);
+                }
+                else
+                {
+                    added.push_back(std::move(range));
+                }
+                chunk_first = chunk_end;
+            }
+            insert_containers(std::move(added));
+        }
+
+        // insert chunks whose keys are not in the bitset, sorted by key
+        void insert_containers(std::vector<container>&& added)
+        {
+            if(added.empty())
+            {
+                return;
+            }
+            const size_t old_size = m_containers.size();
+            m_containers.insert(
+              m_containers.end(), std::make_move_iterator(added.begin()), std::make_move_iterator(added.end()));
+            std::inplace_merge(m_containers.begin(),
+                               m_containers.begin() + static_cast<ptrdiff_t>(old_size),
+                               m_containers.end(),
+                               [](const container& lhs, const container& rhs) noexcept { return lhs.key < rhs.key; });
+        }
+
+        // apply operation(lhs_chunk, rhs_chunk) to the chunks of both bitsets, keep the chunks only in rhs if
+        // keep_rhs_only, the chunks only in *this are always kept
+        template<bool keep_rhs_only, typename Operation>
+        void merge_containers(const roaring_bitset& rhs, Operation&& operation)
+        {
+            std::vector<container> added;
+            auto rhs_it = rhs.m_containers.begin();
+            for(container& chunk: m_containers)
+            {
+                for(; rhs_it != rhs.m_containers.end() && rhs_it->key < chunk.key; ++rhs_it)
+                {
+                    if constexpr(keep_rhs_only)
+                    {
+                        added.push_back(*rhs_it);
+                    }
+                }
+                if(rhs_it != rhs.m_containers.end() && rhs_it->key == chunk.key)
+                {
+                    operation(chunk, *rhs_it);
+                    ++rhs_it;
+                }
+                else if constexpr(!keep_rhs_only)
+                {
+                    // *this & rhs drops the chunks only in *this, *this - rhs keeps them
+                    operation(chunk, container{chunk.key, container_kind::array, chunk.words_number, 0, {}, {}});
+                }
+            }
+            if constexpr(keep_rhs_only)
+            {
+                added.insert(added.end(), rhs_it, rhs.m_containers.end());
+            }
+            remove_empty_containers();
+            insert_containers(std::move(added));
+        }
+
+        [[nodiscard]] static bool full(const container& chunk) noexcept
+        {
+            return chunk.cardinality == chunk_bits;
+        }
+
+        // index of the run containing value, or of the first run after it, in [0, runs]
+        [[nodiscard]] static size_t find_run(const container& chunk, uint16_t value) noexcept
+        {
+            size_t first = 0;
+            size_t last = chunk.values.size() / 2;
+            while(first < last)
+            {
+                const size_t middle = (first + last) / 2;
+                if(chunk.values[2 * middle + 1] < value)
+                {
+                    first = middle + 1;
+                }
+                else
+                {
+                    last = middle;
+                }
+            }
+            return first;
+        }
+
+        [[nodiscard]] static bool contains(const container& chunk, uint16_t value) noexcept
+        {
+            switch(chunk.kind)
+            {
+                case container_kind::array:
+                    return std::ranges::binary_search(chunk.values, value);
+                case container_kind::bitmap:
+                    return ((chunk.words[value / 64] >> (value % 64)) & 1u) != 0;
+                case container_kind::run:
+                {
+                    const size_t run = find_run(chunk, value);
+                    return run < chunk.values.size() / 2 && chunk.values[2 * run] <= value;
+                }
+            }
+            return false;
+        }
+
+        // first bit on at or after value, chunk_bits if none
+        [[nodiscard]] static uint32_t next_value(const container& chunk, uint16_t value) noexcept
+        {
+            switch(chunk.kind)
+            {
+                case container_kind::array:
+                {
+                    const auto it = std::ranges::lower_bound(chunk.values, value);
+                    return it == chunk.values.end() ? chunk_bits : *it;
+                }
+                case container_kind::bitmap:
+                {
+                    size_t word_index = value / 64;
+                    uint64_t word = chunk.words[word_index] & (~uint64_t(0) << (value % 64));
+                    while(word == 0)
+                    {
+                        if(++word_index == chunk.words.size())
+                        {
+                            return chunk_bits;
+                        }
+                        word = chunk.words[word_index];
+                    }
+                    return static_cast<uint32_t>(word_index * 64 + static_cast<size_t>(std::countr_zero(word)));
+                }
+                case container_kind::run:
+                {
+                    const size_t run = find_run(chunk, value);
+                    if(run == chunk.values.size() / 2)
+                    {
+                        return chunk_bits;
+                    }
+                    return std::max(chunk.values[2 * run], value);
+                }
+            }
+            return chunk_bits;
+        }
+
+        // number of bits on before value
+        [[nodiscard]] static size_t container_rank(const container& chunk, uint16_t value) noexcept
+        {
+            switch(chunk.kind)
+            {
+                case container_kind::array:
+                    return static_cast<size_t>(std::ranges::lower_bound(chunk.values, value) - chunk.values.begin());
+                case container_kind::bitmap:
+                {
+                    size_t result = 0;
+                    for(size_t i = 0; i < value / 64u; ++i)
+                    {
+                        result += static_cast<size_t>(std::popcount(chunk.words[i]));
+                    }
+                    if(value % 64 != 0)
+                    {
+                        result += static_cast<size_t>(
+                          std::popcount(chunk.words[value / 64] & ((uint64_t(1) << (value % 64)) - 1)));
+                    }
+                    return result;
+                }
+                case container_kind::run:
+                {
+                    size_t result = 0;
+                    for(size_t i = 0; i < chunk.values.size() && chunk.values[i] < value; i += 2)
+                    {
+                        result += static_cast<size_t>(std::min<uint32_t>(chunk.values[i + 1], value - 1u)) + 1
+                                  - chunk.values[i];
+                    }
+                    return result;
+                }
+            }
+            return 0;
+        }
+
+        // position of the k-th bit on
+        [[nodiscard]] static size_t container_select(const container& chunk, size_t k) noexcept
+        {
+            assert(k < chunk.cardinality);
+            switch(chunk.kind)
+            {
+                case container_kind::array:
+                    return chunk.values[k];
+                case container_kind::bitmap:
+                {
+                    for(size_t i = 0; i < chunk.words.size(); ++i)
+                    {
+                        uint64_t word = chunk.words[i];
+                        const size_t word_count = static_cast<size_t>(std::popcount(word));
+                        if(k < word_count)
+                        {
+                            for(; k > 0; --k)
+                            {
+                                word &= word - 1;
+                            }
+                            return i * 64 + static_cast<size_t>(std::countr_zero(word));
+                        }
+                        k -= word_count;
+                    }
+                    break;
+                }
+                case container_kind::run:
+                {
+                    for(size_t i = 0; i < chunk.values.size(); i += 2)
+                    {
+                        const size_t run_length = static_cast<size_t>(chunk.values[i + 1]) + 1 - chunk.values[i];
+                        if(k < run_length)
+                        {
+                            return chunk.values[i] + k;
+                        }
+                        k -= run_length;
+                    }
+                    break;
+                }
+            }
+            return npos;
+        }
+
+        // call function(value) for each bit on, false if function returned false
+        template<typename Function>
+        [[nodiscard]] static bool iterate_container(const container& chunk, Function& function)
+        {
+            switch(chunk.kind)
+            {
+                case container_kind::array:
+                    for(const uint16_t value: chunk.values)
+                    {
+                        if(!function(static_cast<size_t>(value)))
+                        {
+                            return false;
+                        }
+                    }
+                    break;
+                case container_kind::bitmap:
+                    for(size_t i = 0; i < chunk.words.size(); ++i)
+                    {
+                        for(uint64_t word = chunk.words[i]; word != 0; word &= word - 1)
+                        {
+                            if(!function(i * 64 + static_cast<size_t>(std::countr_zero(word))))
+                            {
+                                return false;
+                            }
+                        }
+                    }
+                    break;
+                case container_kind::run:
+                    for(size_t i = 0; i < chunk.values.size(); i += 2)
+                    {
+                        for(size_t value = chunk.values[i]; value <= chunk.values[i + 1]; ++value)
+                        {
+                            if(!function(value))
+                            {
+                                return false;
+                            }
+                        }
+                    }
+                    break;
+            }
+            return true;
+        }
+
+        // set the bits [first, end) of words to value
+        static void fill_words(uint64_t* words, size_t first, size_t end, bool value) noexcept
+        {
+            while(first < end)
+            {
+                const size_t word_end = std::min(end, (first / 64 + 1) * 64);
+                const uint64_t mask = (word_end - first == 64 ? ~uint64_t(0) : (uint64_t(1) << (word_end - first)) - 1)
+                                      << (first % 64);
+                words[first / 64] = value ? words[first / 64] | mask : words[first / 64] & ~mask;
+                first = word_end;
+            }
+        }
+
+        // number of bits on of words in [first, end)
+        [[nodiscard]] static size_t count_words(const uint64_t* words, size_t first, size_t end) noexcept
+        {
+            size_t result = 0;
+            while(first < end)
+            {
+                const size_t word_end = std::min(end, (first / 64 + 1) * 64);
+                const uint64_t mask = (word_end - first == 64 ? ~uint64_t(0) : (uint64_t(1) << (word_end - first)) - 1)
+                                      << (first % 64);
+                result += static_cast<size_t>(std::popcount(words[first / 64] & mask));
+                first = word_end;
+            }
+            return result;
+        }
+
+        static void to_words(const container& chunk, uint64_t* words) noexcept
+        {
+            if(chunk.kind == container_kind::bitmap)
+            {
+                std::ranges::copy(chunk.words, words);
+                return;
+            }
+            std::fill(words, words + chunk.words_number, uint64_t(0));
+            if(chunk.kind == container_kind::array)
+            {
+                for(const uint16_t value: chunk.values)
+                {
+                    words[value / 64] |= uint64_t(1) << (value % 64);
+                }
+            }
+            else
+            {
+                for(size_t i = 0; i < chunk.values.size(); i += 2)
+                {
+                    fill_words(words, chunk.values[i], static_cast<size_t>(chunk.values[i + 1]) + 1, true);
+                }
+            }
+        }
+
+        // chunk with the bits of words, an array or a bitmap depending on its number of bits on
+        static void assign_words(container& chunk, const uint64_t* words)
+        {
+            size_t cardinality = 0;
+            for(size_t i = 0; i < chunk.words_number; ++i)
+            {
+                cardinality += static_cast<size_t>(std::popcount(words[i]));
+            }
+            chunk.cardinality = static_cast<uint32_t>(cardinality);
+            if(cardinality > array_limit(chunk))
+            {
+                chunk.kind = container_kind::bitmap;
+                chunk.words.assign(words, words + chunk.words_number);
+                std::vector<uint16_t>().swap(chunk.values);
+                return;
+            }
+            chunk.kind = container_kind::array;
+            chunk.values.clear();
+            chunk.values.reserve(cardinality);
+            for(size_t i = 0; i < chunk.words_number; ++i)
+            {
+                for(uint64_t word = words[i]; word != 0; word &= word - 1)
+                {
+                    chunk.values.push_back(static_cast<uint16_t>(i * 64 + static_cast<size_t>(std::countr_zero(word))));
+                }
+            }
+            std::vector<uint64_t>().swap(chunk.words);
+        }
+
+        // bitmap chunk to an array if it has few bits on
+        static void shrink_bitmap(container& chunk)
+        {
+            if(chunk.cardinality <= array_limit(chunk))
+            {
+                const std::vector<uint64_t> words = std::move(chunk.words);
+                assign_words(chunk, words.data());
+            }
+        }
+
+        [[nodiscard]] static size_t runs_number(const container& chunk) noexcept
+        {
+            switch(chunk.kind)
+            {
+                case container_kind::array:
+                {
+                    size_t runs = chunk.values.empty() ? 0 : 1;
+                    for(size_t i = 1; i < chunk.values.size(); ++i)
+                    {
+                        runs += chunk.values[i] != chunk.values[i - 1] + 1u ? 1u : 0u;
+                    }
+                    return runs;
+                }
+                case container_kind::bitmap:
+                {
+                    // a run starts at each bit on whose previous bit is off
+                    size_t runs = 0;
+                    uint64_t previous_last_bit = 0;
+                    for(const uint64_t word: chunk.words)
+                    {
+                        runs += static_cast<size_t>(std::popcount(word & ~((word << 1) | previous_last_bit)));
+                        previous_last_bit = word >> 63;
+                    }
+                    return runs;
+                }
+                case container_kind::run:
+                    return chunk.values.size() / 2;
+            }
+            return 0;
+        }
+
+        static void to_runs(container& chunk)
+        {
+            std::vector<uint16_t> runs;
+            runs.reserve(2 * runs_number(chunk));
+            const auto add_value = [&](size_t value) noexcept
+            {
+                if(!runs.empty() && runs.back() + 1u == value)
+                {
+                    runs.back() = static_cast<uint16_t>(value);
+                }
+                else
+                {
+                    runs.push_back(static_cast<uint16_t>(value));
+                    runs.push_back(static_cast<uint16_t>(value));
+                }
+                return true;
+            };
+            static_cast<void>(iterate_container(chunk, add_value));
+            chunk.kind = container_kind::run;
+            chunk.values = std::move(runs);
+            std::vector<uint64_t>().swap(chunk.words);
+        }
+
+        static void add(container& chunk, uint16_t value)
+        {
+            switch(chunk.kind)
+            {
+                case container_kind::array:
+                {
+                    const auto it = std::ranges::lower_bound(chunk.values, value);
+                    if(it != chunk.values.end() && *it == value)
+                    {
+                        return;
+                    }
+                    if(chunk.cardinality < array_limit(chunk))
+                    {
+                        chunk.values.insert(it, value);
+                        ++chunk.cardinality;
+                        return;
+                    }
+                    break;
+                }
+                case container_kind::bitmap:
+                {
+                    uint64_t& word = chunk.words[value / 64];
+                    const uint64_t mask = uint64_t(1) << (value % 64);
+                    chunk.cardinality += (word & mask) == 0 ? 1 : 0;
+                    word |= mask;
+                    return;
+                }
+                case container_kind::run:
+                    if(contains(chunk, value))
+                    {
+                        return;
+                    }
+                    break;
+            }
+            words_buffer words;
+            to_words(chunk, words.data());
+            words[value / 64] |= uint64_t(1) << (value % 64);
+            assign_words(chunk, words.data());
+        }
+
+        static void remove(container& chunk, uint16_t value)
+        {
+            switch(chunk.kind)
+            {
+                case container_kind::array:
+                {
+                    const auto it = std::ranges::lower_bound(chunk.values, value);
+                    if(it != chunk.values.end() && *it == value)
+                    {
+                        chunk.values.erase(it);
+                        --chunk.cardinality;
+                    }
+                    return;
+                }
+                case container_kind::bitmap:
+                {
+                    uint64_t& word = chunk.words[value / 64];
+                    const uint64_t mask = uint64_t(1) << (value % 64);
+                    if((word & mask) != 0)
+                    {
+                        word &= ~mask;
+                        --chunk.cardinality;
+                        shrink_bitmap(chunk);
+                    }
+                    return;
+                }
+                case container_kind::run:
+                    if(!contains(chunk, value))
+                    {
+                        return;
+                    }
+                    break;
+            }
+            words_buffer words;
+            to_words(chunk, words.data());
+            words[value / 64] &= ~(uint64_t(1) << (value % 64));
+            assign_words(chunk, words.data());
+        }
+
+        // words op= rhs for the bits of rhs, op is one of |, & ~ and ^
+        template<typename Operation>
+        static void apply_to_words(uint64_t* words, const container& rhs, Operation&& operation) noexcept
+        {
+            if(rhs.kind == container_kind::bitmap)
+            {
+                for(size_t i = 0; i < rhs.words_number; ++i)
+                {
+                    words[i] = operation(words[i], rhs.words[i]);
+                }
+                return;
+            }
+            words_buffer rhs_words;
+            to_words(rhs, rhs_words.data());
+            for(size_t i = 0; i < rhs.words_number; ++i)
+            {
+                words[i] = operation(words[i], rhs_words[i]);
+            }
+        }
+
+        // lhs = lhs op rhs through the words of lhs
+        template<typename Operation>
+        static void words_operation(container& lhs, const container& rhs, Operation&& operation)
+        {
+            if(lhs.kind == container_kind::bitmap)
+            {
+                apply_to_words(lhs.words.data(), rhs, operation);
+                const std::vector<uint64_t> words = std::move(lhs.words);
+                assign_words(lhs, words.data());
+                return;
+            }
+            words_buffer words;
+            to_words(lhs, words.data());
+            apply_to_words(words.data(), rhs, operation);
+            assign_words(lhs, words.data());
+        }
+
+        // keep the values of the array lhs contained in rhs if keep_contained, the others otherwise
+        template<bool keep_contained>
+        static void filter_array(container& lhs, const container& rhs) noexcept
+        {
+            if(rhs.kind == container_kind::array && lhs.values.size() + rhs.values.size() >= array_probe_min_values)
+            {
+                words_buffer words;
+                to_words(rhs, words.data());
+                std::erase_if(lhs.values,
+                              [&](uint16_t value) noexcept
+                              { return (((words[value / 64] >> (value % 64)) & 1u) != 0) != keep_contained; });
+            }
+            else
+            {
+                std::erase_if(lhs.values,
+                              [&](uint16_t value) noexcept { return contains(rhs, value) != keep_contained; });
+            }
+            lhs.cardinality = static_cast<uint32_t>(lhs.values.size());
+        }
+
+        static void or_equal(container& lhs, const container& rhs)
+        {
+            if(full(lhs))
+            {
+                return;
+            }
+            if(full(rhs))
+            {
+                lhs = rhs;
+                return;
+            }
+            if(lhs.kind == container_kind::array && rhs.kind == container_kind::array
+               && lhs.values.size() + rhs.values.size() < array_probe_min_values)
+            {
+                std::vector<uint16_t> values;
+                values.reserve(lhs.values.size() + rhs.values.size());
+                std::ranges::set_union(lhs.values, rhs.values, std::back_inserter(values));
+                lhs.cardinality = static_cast<uint32_t>(values.size());
+                lhs.values = std::move(values);
+                if(lhs.cardinality > array_limit(lhs))
+                {
+                    words_buffer words;
+                    to_words(lhs, words.data());
+                    assign_words(lhs, words.data());
+                }
+                return;
+            }
+            if(lhs.kind == container_kind::bitmap && rhs.kind == container_kind::array)
+            {
+                for(const uint16_t value: rhs.values)
+                {
+                    add(lhs, value);
+                }
+                return;
+            }
+            words_operation(lhs,
+                            rhs,
+                            [](uint64_t lhs_word, uint64_t rhs_word) noexcept { return lhs_word | rhs_word; });
+        }
+
+        static void and_equal(container& lhs, const container& rhs)
+        {
+            if(full(rhs))
+            {
+                return;
+            }
+            if(full(lhs))
+            {
+                lhs = rhs;
+                return;
+            }
+            if(lhs.kind == container_kind::array)
+            {
+                filter_array<true>(lhs, rhs);
+                return;
+            }
+            if(rhs.kind == container_kind::array)
+            {
+                std::vector<uint16_t> values;
+                values.reserve(rhs.values.size());
+                std::ranges::copy_if(rhs.values,
+                                     std::back_inserter(values),
+                                     [&](uint16_t value) noexcept { return contains(lhs, value); });
+                lhs.kind = container_kind::array;
+                lhs.cardinality = static_cast<uint32_t>(values.size());
+                lhs.values = std::move(values);
+                std::vector<uint64_t>().swap(lhs.words);
+                return;
+            }
+            words_operation(lhs,
+                            rhs,
+                            [](uint64_t lhs_word, uint64_t rhs_word) noexcept { return lhs_word & rhs_word; });
+        }
+
+        static void andnot_equal(container& lhs, const container& rhs)
+        {
+            if(rhs.cardinality == 0)
+            {
+                return;
+            }
+            if(full(rhs))
+            {
+                lhs.cardinality = 0;
+                lhs.values.clear();
+                lhs.words.clear();
+                return;
+            }
+            if(lhs.kind == container_kind::array)
+            {
+                filter_array<false>(lhs, rhs);
+                return;
+            }
+            if(lhs.kind == container_kind::bitmap && rhs.kind == container_kind::array)
+            {
+                for(const uint16_t value: rhs.values)
+                {
+                    uint64_t& word = lhs.words[value / 64];
+                    const uint64_t mask = uint64_t(1) << (value % 64);
+                    lhs.cardinality -= (word & mask) != 0 ? 1 : 0;
+                    word &= ~mask;
+                }
+                shrink_bitmap(lhs);
+                return;
+            }
+            words_operation(lhs,
+                            rhs,
+                            [](uint64_t lhs_word, uint64_t rhs_word) noexcept { return lhs_word & ~rhs_word; });
+        }
+
+        static void xor_equal(container& lhs, const container& rhs)
+        {
+            if(lhs.kind == container_kind::array && rhs.kind == container_kind::array
+               && lhs.values.size() + rhs.values.size() < array_probe_min_values)
+            {
+                std::vector<uint16_t> values;
+                values.reserve(lhs.values.size() + rhs.values.size());
+                std::ranges::set_symmetric_difference(lhs.values, rhs.values, std::back_inserter(values));
+                lhs.cardinality = static_cast<uint32_t>(values.size());
+                lhs.values = std::move(values);
+                if(lhs.cardinality > array_limit(lhs))
+                {
+                    words_buffer words;
+                    to_words(lhs, words.data());
+                    assign_words(lhs, words.data());
+                }
+                return;
+            }
+            words_operation(lhs,
+                            rhs,
+                            [](uint64_t lhs_word, uint64_t rhs_word) noexcept { return lhs_word ^ rhs_word; });
+        }
+
+        // number of bits on in words for the bits on of chunk
+        [[nodiscard]] static size_t words_and_count(const uint64_t* words, const container& chunk) noexcept
+        {
+            size_t result = 0;
+            switch(chunk.kind)
+            {
+                case container_kind::array:
+                    for(const uint16_t value: chunk.values)
+                    {
+                        result += (words[value / 64] >> (value % 64)) & 1u;
+                    }
+                    break;
+                case container_kind::bitmap:
+                    for(size_t i = 0; i < chunk.words.size(); ++i)
+                    {
+                        result += static_cast<size_t>(std::popcount(words[i] & chunk.words[i]));
+                    }
+                    break;
+                case container_kind::run:
+                    for(size_t i = 0; i < chunk.values.size(); i += 2)
+                    {
+                        result += count_words(words, chunk.values[i], static_cast<size_t>(chunk.values[i + 1]) + 1);
+                    }
+                    break;
+            }
+            return result;
+        }
+
+        [[nodiscard]] static size_t container_and_count(const container& lhs, const container& rhs) noexcept
+        {
+            if(full(lhs) || full(rhs))
+            {
+                return std::min(lhs.cardinality, rhs.cardinality);
+            }
+            if(lhs.kind == container_kind::array && rhs.kind == container_kind::array)
+            {
+                // the merge of large arrays is slowed down by its unpredictable comparisons, probe words instead
+                if(lhs.values.size() + rhs.values.size() >= array_probe_min_values)
+                {
+                    words_buffer words;
+                    to_words(lhs, words.data());
+                    return words_and_count(words.data(), rhs);
+                }
+                size_t result = 0;
+                auto lhs_it = lhs.values.begin();
+                auto rhs_it = rhs.values.begin();
+                while(lhs_it != lhs.values.end() && rhs_it != rhs.values.end())
+                {
+                    if(*lhs_it < *rhs_it)
+                    {
+                        ++lhs_it;
+                    }
+                    else if(*rhs_it < *lhs_it)
+                    {
+                        ++rhs_it;
+                    }
+                    else
+                    {
+                        ++result;
+                        ++lhs_it;
+                        ++rhs_it;
+                    }
+                }
+                return result;
+            }
+            if(lhs.kind == container_kind::array || rhs.kind == container_kind::array)
+            {
+                const container& array_chunk = lhs.kind == container_kind::array ? lhs : rhs;
+                const container& other_chunk = lhs.kind == container_kind::array ? rhs : lhs;
+                if(other_chunk.kind == container_kind::bitmap)
+                {
+                    return words_and_count(other_chunk.words.data(), array_chunk);
+                }
+                return static_cast<size_t>(std::ranges::count_if(
+                  array_chunk.values, [&](uint16_t value) noexcept { return contains(other_chunk, value); }));
+            }
+            if(lhs.kind == container_kind::bitmap)
+            {
+                return words_and_count(lhs.words.data(), rhs);
+            }
+            if(rhs.kind == container_kind::bitmap)
+            {
+                return words_and_count(rhs.words.data(), lhs);
+            }
+            words_buffer words;
+            to_words(lhs, words.data());
+            return words_and_count(words.data(), rhs);
+        }
+
+        // chunks with bits on, sorted by key
+        std::vector<container> m_containers;
+        size_t m_size = 0;
+    };
+} // namespace fix
+
+// the fused counts of the adapters without temporary bitset
+template<>
+struct fix::dynamic_bitset::bitset_traits<fix::roaring_bitset>
+{
+    static constexpr storage_kind storage = storage_kind::bitset;
+
+    [[nodiscard]] static size_t or_count(const fix::roaring_bitset& lhs, const fix::roaring_bitset& rhs) noexcept
+    {
+        return lhs.or_count(rhs);
+    }
+
+    [[nodiscard]] static size_t and_count(const fix::roaring_bitset& lhs, const fix::roaring_bitset& rhs) noexcept
+    {
+        return lhs.and_count(rhs);
+    }
+
+    [[nodiscard]] static size_t andnot_count(const fix::roaring_bitset& lhs, const fix::roaring_bitset& rhs) noexcept
+    {
+        return lhs.andnot_count(rhs);
+    }
+};
@@ -0,0 +1,497 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/kernels.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Dynamic bitset with a small buffer optimization.
+//
+// Bitsets of at most inline_bits bits store their blocks in the object itself, without heap allocation, larger ones
+// move them to the heap and back to the object when they shrink again. The bits after size() in the last block are
+// always off, the inline blocks after the last one are left uninitialized and set when the bitset grows over them.
+// Blocks are accessed with data() and num_blocks(): the fix adapters use the fix kernels on them.
+namespace fix
+{
+    template<std::unsigned_integral block_t = uint64_t, size_t inline_bits = 256>
+    class small_bitset final
+    {
+    public:
+        using block_type = block_t;
+        using size_type = size_t;
+
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+        static constexpr size_t bits_per_block = dynamic_bitset::kernels::bits_per_block<block_t>;
+        static_assert(inline_bits > 0 && inline_bits % bits_per_block == 0,
+                      "inline_bits must be a non-zero multiple of the bits of a block");
+        static constexpr size_t inline_blocks = inline_bits / bits_per_block;
+
+        class reference final
+        {
+        public:
+            reference(small_bitset& bitset, size_t pos) noexcept
+              : m_bitset(bitset)
+              , m_pos(pos)
+            {
+            }
+
+            reference(const reference&) noexcept = default;
+
+            reference& operator=(bool value) noexcept
+            {
+                m_bitset.set(m_pos, value);
+                return *this;
+            }
+
+            reference& operator=(const reference& other) noexcept
+            {
+                m_bitset.set(m_pos, static_cast<bool>(other));
+                return *this;
+            }
+
+            [[nodiscard]] operator bool() const noexcept
+            {
+                return m_bitset.test(m_pos);
+            }
+
+            [[nodiscard]] bool operator~() const noexcept
+            {
+                return !m_bitset.test(m_pos);
+            }
+
+            reference& flip() noexcept
+            {
+                m_bitset.flip(m_pos);
+                return *this;
+            }
+
+        private:
+            small_bitset& m_bitset;
+            size_t m_pos;
+        };
+
+        small_bitset() noexcept = default;
+
+        // the first bits of init_val, the other bits off
+        explicit small_bitset(size_t nbits, unsigned long long init_val = 0)
+        {
+            resize(nbits);
+            for(size_t i = 0; i < std::min(nbits, bits_number<unsigned long long>); ++i)
+            {
+                set(i, ((init_val >> i) & 1u) != 0);
+            }
+        }
+
+        // all bits of the blocks, the first block is the first bits
+        small_bitset(std::initializer_list<block_t> init_vals)
+        {
+            resize(init_vals.size() * bits_per_block);
+            std::copy(init_vals.begin(), init_vals.end(), data());
+        }
+
+        // the last character is the first bit, characters other than one are off
+        explicit small_bitset(std::string_view str, char one = '1')
+        {
+            resize(str.size());
+            for(size_t i = 0; i < m_size; ++i)
+            {
+                if(str[m_size - 1 - i] == one)
+                {
+                    set(i);
+                }
+            }
+        }
+
+        small_bitset(const small_bitset& other)
+          : m_size(other.m_size)
+          , m_heap_blocks(other.m_heap_blocks)
+        {
+            copy_inline_blocks(other);
+        }
+
+        // the moved from bitset is empty
+        small_bitset(small_bitset&& other) noexcept
+          : m_size(std::exchange(other.m_size, 0))
+          , m_heap_blocks(std::move(other.m_heap_blocks))
+        {
+            copy_inline_blocks(other);
+            other.m_heap_blocks.clear();
+        }
+
+        small_bitset& operator=(const small_bitset& other)
+        {
+            if(this != &other)
+            {
+                m_size = other.m_size;
+                m_heap_blocks = other.m_heap_blocks;
+                copy_inline_blocks(other);
+            }
+            return *this;
+        }
+
+        // the moved from bitset is empty
+        small_bitset& operator=(small_bitset&& other) noexcept
+        {
+            if(this != &other)
+            {
+                m_size = std::exchange(other.m_size, 0);
+                m_heap_blocks = std::move(other.m_heap_blocks);
+                copy_inline_blocks(other);
+                other.m_heap_blocks.clear();
+            }
+            return *this;
+        }
+
+        ~small_bitset() noexcept = default;
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        [[nodiscard]] size_t num_blocks() const noexcept
+        {
+            return blocks_number(m_size);
+        }
+
+        // the blocks are in the object itself
+        [[nodiscard]] bool is_inline() const noexcept
+        {
+            return m_size <= inline_bits;
+        }
+
+        [[nodiscard]] block_t* data() noexcept
+        {
+            return is_inline() ? m_inline_blocks.data() : m_heap_blocks.data();
+        }
+
+        [[nodiscard]] const block_t* data() const noexcept
+        {
+            return is_inline() ? m_inline_blocks.data() : m_heap_blocks.data();
+        }
+
+        [[nodiscard]] size_t capacity() const noexcept
+        {
+            return std::max(inline_bits, m_heap_blocks.capacity() * bits_per_block);
+        }
+
+        void reserve(size_t nbits)
+        {
+            if(nbits > inline_bits)
+            {
+                m_heap_blocks.reserve(blocks_number(nbits));
+            }
+        }
+
+        void resize(size_t nbits, bool value = false)
+        {
+            const size_t old_size = m_size;
+            const size_t old_blocks = blocks_number(old_size);
+            const size_t blocks = blocks_number(nbits);
+            if(nbits > inline_bits)
+            {
+                // spill the inline blocks to the heap
+                if(old_size <= inline_bits)
+                {
+                    m_heap_blocks.assign(m_inline_blocks.begin(),
+                                         m_inline_blocks.begin() + static_cast<ptrdiff_t>(old_blocks));
+                }
+                m_heap_blocks.resize(blocks, block_t(0));
+            }
+            else if(old_size > inline_bits)
+            {
+                // move back the blocks to the object, the heap storage is kept for a next spill
+                std::copy_n(m_heap_blocks.begin(), blocks, m_inline_blocks.begin());
+                m_heap_blocks.clear();
+            }
+            else if(blocks > old_blocks)
+            {
+                std::fill(m_inline_blocks.begin() + static_cast<ptrdiff_t>(old_blocks),
+                          m_inline_blocks.begin() + static_cast<ptrdiff_t>(blocks),
+                          block_t(0));
+            }
+            m_size = nbits;
+
+            if(value && nbits > old_size)
+            {
+                const std::span<block_t> bitset_blocks = blocks_span();
+                const size_t first_block = old_size / bits_per_block;
+                bitset_blocks[first_block] |= static_cast<block_t>(~block_t(0) << (old_size % bits_per_block));
+                std::fill(bitset_blocks.begin() + static_cast<ptrdiff_t>(first_block + 1),
+                          bitset_blocks.end(),
+                          static_cast<block_t>(~block_t(0)));
+            }
+            clear_unused_bits();
+        }
+
+        void clear() noexcept
+        {
+            m_heap_blocks.clear();
+            m_size = 0;
+        }
+
+        void push_back(bool value)
+        {
+            // a new block is needed
+            if(m_size % bits_per_block == 0)
+            {
+                if(m_size >= inline_bits)
+                {
+                    resize(m_size + 1, value);
+                    return;
+                }
+                m_inline_blocks[m_size / bits_per_block] = block_t(0);
+            }
+            ++m_size;
+            set(m_size - 1, value);
+        }
+
+        void pop_back() noexcept
+        {
+            assert(!empty());
+            if(m_size == inline_bits + 1)
+            {
+                resize(inline_bits);
+                return;
+            }
+            --m_size;
+            // the last block is no longer used
+            if(m_size % bits_per_block == 0)
+            {
+                if(m_size > inline_bits)
+                {
+                    m_heap_blocks.pop_back();
+                }
+                return;
+            }
+            data()[m_size / bits_per_block] &= static_cast<block_t>(~(block_t(1) << (m_size % bits_per_block)));
+        }
+
+        [[nodiscard]] bool test(size_t pos) const noexcept
+        {
+            assert(pos < m_size);
+            return (data()[pos / bits_per_block] & (block_t(1) << (pos % bits_per_block))) != 0;
+        }
+
+        [[nodiscard]] bool operator[](size_t pos) const noexcept
+        {
+            return test(pos);
+        }
+
+        [[nodiscard]] reference operator[](size_t pos) noexcept
+        {
+            assert(pos < m_size);
+            return reference(*this, pos);
+        }
+
+        small_bitset& set(size_t pos, bool value = true) noexcept
+        {
+            assert(pos < m_size);
+            const block_t mask = static_cast<block_t>(block_t(1) << (pos % bits_per_block));
+            block_t& block = data()[pos / bits_per_block];
+            block = value ? static_cast<block_t>(block | mask) : static_cast<block_t>(block & ~mask);
+            return *this;
+        }
+
+        small_bitset& set() noexcept
+        {
+            std::ranges::fill(blocks_span(), static_cast<block_t>(~block_t(0)));
+            clear_unused_bits();
+            return *this;
+        }
+
+        small_bitset& reset(size_t pos) noexcept
+        {
+            return set(pos, false);
+        }
+
+        small_bitset& reset() noexcept
+        {
+            std::ranges::fill(blocks_span(), block_t(0));
+            return *this;
+        }
+
+        small_bitset& flip(size_t pos) noexcept
+        {
+            assert(pos < m_size);
+            data()[pos / bits_per_block] ^= static_cast<block_t>(block_t(1) << (pos % bits_per_block));
+            return *this;
+        }
+
+        small_bitset& flip() noexcept
+        {
+            for(block_t& block: blocks_span())
+            {
+                block = static_cast<block_t>(~block);
+            }
+            clear_unused_bits();
+            return *this;
+        }
+
+        [[nodiscard]] size_t count() const noexcept
+        {
+            return dynamic_bitset::kernels::count(blocks_span(), m_size);
+        }
+
+        [[nodiscard]] bool any() const noexcept
+        {
+            return dynamic_bitset::kernels::any(blocks_span(), m_size);
+        }
+
+        [[nodiscard]] bool none() const noexcept
+        {
+            return !any();
+        }
+
+        [[nodiscard]] bool all() const noexcept
+        {
+            return dynamic_bitset::kernels::all(blocks_span(), m_size);
+        }
+
+        // position of the first bit on, npos if none
+        [[nodiscard]] size_t find_first() const noexcept
+        {
+            return dynamic_bitset::kernels::find_first(blocks_span(), m_size);
+        }
+
+        // position of the first bit on after prev, npos if none
+        [[nodiscard]] size_t find_next(size_t prev) const noexcept
+        {
+            const size_t pos = prev + 1;
+            if(pos >= m_size)
+            {
+                return npos;
+            }
+            const size_t block_index = pos / bits_per_block;
+            const block_t block = static_cast<block_t>(data()[block_index] >> (pos % bits_per_block));
+            if(block != block_t(0))
+            {
+                return pos + static_cast<size_t>(std::countr_zero(block));
+            }
+            const size_t next_first_bit = (block_index + 1) * bits_per_block;
+            if(next_first_bit >= m_size)
+            {
+                return npos;
+            }
+            const size_t next = dynamic_bitset::kernels::find_first(blocks_span().subspan(block_index + 1),
+                                                                    m_size - next_first_bit);
+            return next == npos ? npos : next_first_bit + next;
+        }
+
+        // call function(bit_pos, parameters...) for each bit on, stop early if function returns false
+        template<typename Function, typename... Parameters>
+        void iterate_bits_on(Function&& function, Parameters&&... parameters) const
+        {
+            dynamic_bitset::kernels::iterate_bits_on(
+              blocks_span(), m_size, std::forward<Function>(function), std::forward<Parameters>(parameters)...);
+        }
+
+        small_bitset& operator|=(const small_bitset& rhs) noexcept
+        {
+            assert(m_size == rhs.m_size);
+            dynamic_bitset::kernels::or_equal(blocks_span(), rhs.blocks_span());
+            return *this;
+        }
+
+        small_bitset& operator&=(const small_bitset& rhs) noexcept
+        {
+            assert(m_size == rhs.m_size);
+            dynamic_bitset::kernels::and_equal(blocks_span(), rhs.blocks_span());
+            return *this;
+        }
+
+        small_bitset& operator^=(const small_bitset& rhs) noexcept
+        {
+            assert(m_size == rhs.m_size);
+            dynamic_bitset::kernels::xor_equal(blocks_span(), rhs.blocks_span());
+            return *this;
+        }
+
+        small_bitset& operator-=(const small_bitset& rhs) noexcept
+        {
+            assert(m_size == rhs.m_size);
+            dynamic_bitset::kernels::minus_equal(blocks_span(), rhs.blocks_span());
+            return *this;
+        }
+
+        [[nodiscard]] small_bitset operator~() const
+        {
+            small_bitset result = *this;
+            result.flip();
+            return result;
+        }
+
+        [[nodiscard]] bool operator==(const small_bitset& rhs) const noexcept
+        {
+            return m_size == rhs.m_size && std::ranges::equal(blocks_span(), rhs.blocks_span());
+        }
+
+    private:
+        template<typename T>
+        static constexpr size_t bits_number = sizeof(T) * CHAR_BIT;
+
+        [[nodiscard]] static constexpr size_t blocks_number(size_t nbits) noexcept
+        {
+            return (nbits + bits_per_block - 1) / bits_per_block;
+        }
+
+        [[nodiscard]] std::span<block_t> blocks_span() noexcept
+        {
+            return {data(), num_blocks()};
+        }
+
+        [[nodiscard]] std::span<const block_t> blocks_span() const noexcept
+        {
+            return {data(), num_blocks()};
+        }
+
+        // turn off the bits after size() in the last block
+        void clear_unused_bits() noexcept
+        {
+            const size_t blocks = num_blocks();
+            if(blocks > 0)
+            {
+                data()[blocks - 1] &= dynamic_bitset::kernels::last_block_mask<block_t>(m_size);
+            }
+        }
+
+        // copy the used inline blocks of other, which had the size of the bitset
+        void copy_inline_blocks(const small_bitset& other) noexcept
+        {
+            if(is_inline())
+            {
+                std::copy_n(other.m_inline_blocks.begin(), num_blocks(), m_inline_blocks.begin());
+            }
+        }
+
+        size_t m_size = 0;
+        // blocks of the bitsets of at most inline_bits bits, only the first num_blocks() are initialized
+        std::array<block_t, inline_blocks> m_inline_blocks;
+        // blocks of the bitsets larger than inline_bits, empty otherwise
+        std::vector<block_t> m_heap_blocks;
+    };
+} // namespace fix
@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/census.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/kernels.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+
+// Opt-in versions of the fix write adapters using non-temporal stores for very large bitsets.
+//
+// The destination blocks are written around the caches: no read for ownership when resetting, and the caches keep
+// their content when the destination could not stay in them anyway. Bitsets smaller than threshold() bits and
+// backends without kernels (or with a bitset_traits hook for the operation) use the regular adapters.
+namespace fix::dynamic_bitset::streaming
+{
+    // bitsets with less bits use the regular adapters, they likely fit in the last level cache and are read back soon
+    constexpr size_t default_threshold = size_t(1) << 28u;
+
+    namespace detail
+    {
+        [[nodiscard]] inline std::atomic<size_t>& threshold_value() noexcept
+        {
+            static std::atomic<size_t> threshold = default_threshold;
+            return threshold;
+        }
+    } // namespace detail
+
+    // size in bits from which the streaming adapters use non-temporal stores
+    [[nodiscard]] inline size_t threshold() noexcept
+    {
+        return detail::threshold_value().load(std::memory_order_relaxed);
+    }
+
+    inline void set_threshold(size_t bits) noexcept
+    {
+        detail::threshold_value().store(bits, std::memory_order_relaxed);
+    }
+
+    template<typename dynamic_bitset_t>
+    void do_reset(dynamic_bitset_t& bitset) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(reset, bitset.size());
+        if constexpr(use_kernels<dynamic_bitset_t>)
+        {
+            if(bitset.size() >= threshold())
+            {
+                kernels::stream_reset(blocks(bitset));
+                return;
+            }
+        }
+        fix::dynamic_bitset::do_reset(bitset);
+    }
+
+    template<typename dynamic_bitset_t>
+    void do_or_equal(dynamic_bitset_t& lhs, const dynamic_bitset_t& rhs) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(or_equal, lhs.size());
+        if constexpr(use_kernels<dynamic_bitset_t>
+                     && !requires { bitset_traits_t<dynamic_bitset_t>::or_equal(lhs, rhs); })
+        {
+            if(lhs.size() >= threshold())
+            {
+                assert(lhs.size() == rhs.size());
+                kernels::stream_or_equal(blocks(lhs), blocks(rhs));
+                return;
+            }
+        }
+        fix::dynamic_bitset::do_or_equal(lhs, rhs);
+    }
+
+    template<typename dynamic_bitset_t>
+    void do_and_equal(dynamic_bitset_t& lhs, const dynamic_bitset_t& rhs) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(and_equal, lhs.size());
+        if constexpr(use_kernels<dynamic_bitset_t>
+                     && !requires { bitset_traits_t<dynamic_bitset_t>::and_equal(lhs, rhs); })
+        {
+            if(lhs.size() >= threshold())
+            {
+                assert(lhs.size() == rhs.size());
+                kernels::stream_and_equal(blocks(lhs), blocks(rhs));
+                return;
+            }
+        }
+        fix::dynamic_bitset::do_and_equal(lhs, rhs);
+    }
+
+    template<typename dynamic_bitset_t>
+    void do_xor_equal(dynamic_bitset_t& lhs, const dynamic_bitset_t& rhs) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(xor_equal, lhs.size());
+        if constexpr(use_kernels<dynamic_bitset_t>
+                     && !requires { bitset_traits_t<dynamic_bitset_t>::xor_equal(lhs, rhs); })
+        {
+            if(lhs.size() >= threshold())
+            {
+                assert(lhs.size() == rhs.size());
+                kernels::stream_xor_equal(blocks(lhs), blocks(rhs));
+                return;
+            }
+        }
+        fix::dynamic_bitset::do_xor_equal(lhs, rhs);
+    }
+
+    // lhs &= ~rhs
+    template<typename dynamic_bitset_t>
+    void do_minus_equal(dynamic_bitset_t& lhs, const dynamic_bitset_t& rhs) noexcept
+    {
+        FIX_DYNAMIC_BITSET_CENSUS_SCOPE(minus_equal, lhs.size());
+        if constexpr(use_kernels<dynamic_bitset_t>
+                     && !requires { bitset_traits_t<dynamic_bitset_t>::minus_equal(lhs, rhs); })
+        {
+            if(lhs.size() >= threshold())
+            {
+                assert(lhs.size() == rhs.size());
+                kernels::stream_minus_equal(blocks(lhs), blocks(rhs));
+                return;
+            }
+        }
+        fix::dynamic_bitset::do_minus_equal(lhs, rhs);
+    }
+} // namespace fix::dynamic_bitset::streaming
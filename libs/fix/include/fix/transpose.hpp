@@ -0,0 +1,228 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/bitset_traits.hpp>
+#include <fix/dynamic_bitset.hpp>
+#include <fix/kernels.hpp>
+#include <fix/parallel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Transpose of a bit matrix stored as one dynamic bitset per row.
+//
+// The matrix is cut in 64x64 tiles transposed with kernels::transpose_64x64, a column of the result is then read 64
+// rows at a time instead of testing one bit per row. The column tiles are independent and split over a thread pool.
+// Very sparse matrices and tiles skip the transpose, their few bits on are moved one by one.
+namespace fix::dynamic_bitset
+{
+    namespace detail
+    {
+        // bits [64 * word_index, 64 * word_index + 64) of the bitset, bits after size() are off
+        template<typename dynamic_bitset_t>
+        [[nodiscard]] uint64_t load_word(const dynamic_bitset_t& bitset, size_t word_index) noexcept
+        {
+            const size_t first_bit = word_index * 64;
+            const size_t bits = std::min<size_t>(bitset.size() - first_bit, 64);
+            uint64_t word = 0;
+            if constexpr(has_blocks<dynamic_bitset_t>)
+            {
+                const auto bitset_blocks = blocks(bitset);
+                using block_t = std::remove_const_t<typename decltype(bitset_blocks)::element_type>;
+                static_assert(sizeof(block_t) <= sizeof(uint64_t));
+                constexpr size_t block_bits = kernels::bits_per_block<block_t>;
+                const size_t first_block = first_bit / block_bits;
+                // a loaded word only maps to consecutive bits on little endian targets
+                if(bits == 64 && (std::endian::native == std::endian::little || block_bits == 64))
+                {
+                    return kernels::detail::load(bitset_blocks.data() + first_block);
+                }
+                const size_t blocks_number = (bits + block_bits - 1) / block_bits;
+                for(size_t i = 0; i < blocks_number; ++i)
+                {
+                    word |= static_cast<uint64_t>(bitset_blocks[first_block + i]) << (i * block_bits % 64);
+                }
+                if(bits < 64)
+                {
+                    word &= (uint64_t(1) << bits) - 1;
+                }
+            }
+            else
+            {
+                for(size_t i = 0; i < bits; ++i)
+                {
+                    word |= static_cast<uint64_t>(do_test(bitset, first_bit + i)) << i;
+                }
+            }
+            return word;
+        }
+
+        // column tiles of 64 columns per thread pool task, enough tasks to balance the load between the threads
+        // at most group_column_tiles, 512 columns: a cache line of each row of a row tile is loaded at once
+        constexpr size_t group_column_tiles = 8;
+
+        [[nodiscard]] inline size_t column_tiles_per_task(size_t column_tiles, size_t threads) noexcept
+        {
+            const size_t wanted_tasks = threads * parallel::detail::tasks_per_thread;
+            return std::clamp<size_t>((column_tiles + wanted_tasks - 1) / wanted_tasks, 1, group_column_tiles);
+        }
+
+        // result of transpose_bits_on with two passes over the bits on of the rows, counting then filling the columns
+        template<typename dynamic_bitset_t>
+        [[nodiscard]] std::vector<std::vector<size_t>> scatter_bits_on(std::span<const dynamic_bitset_t> rows,
+                                                                       size_t columns)
+        {
+            std::vector<size_t> columns_bits_on(columns, 0);
+            for(const dynamic_bitset_t& row: rows)
+            {
+                do_iterate_bits_on(row, [&](size_t column) noexcept { ++columns_bits_on[column]; });
+            }
+
+            std::vector<std::vector<size_t>> result(columns);
+            for(size_t column = 0; column < columns; ++column)
+            {
+                result[column].reserve(columns_bits_on[column]);
+            }
+            for(size_t i = 0; i < rows.size(); ++i)
+            {
+                do_iterate_bits_on(rows[i], [&](size_t column) noexcept { result[column].push_back(i); });
+            }
+            return result;
+        }
+    } // namespace detail
+
+    // matrices with less than one bit on in sparse_matrix_density_inverse per thread of the pool are not transposed,
+    // going through their bits on twice is faster
+    constexpr size_t sparse_matrix_density_inverse = 256;
+
+    // tiles with at most this number of bits on are not transposed, their bits are set one by one
+    constexpr size_t sparse_tile_bits_on = 64;
+
+    // indices of the rows with each column on: result[column] lists in increasing order the i with rows[i][column] on
+    // all rows have columns bits, fixed-size rows may have more bits as long as the ones after columns are off
+    template<typename dynamic_bitset_t>
+    [[nodiscard]] std::vector<std::vector<size_t>>
+    transpose_bits_on(std::span<const dynamic_bitset_t> rows,
+                      size_t columns,
+                      parallel::thread_pool& pool = parallel::default_thread_pool())
+    {
+        assert(std::ranges::all_of(rows,
+                                   [&](const dynamic_bitset_t& row)
+                                   {
+                                       if constexpr(fixed_size<dynamic_bitset_t>)
+                                       {
+                                           return row.size() >= columns;
+                                       }
+                                       else
+                                       {
+                                           return row.size() == columns;
+                                       }
+                                   }));
+        size_t bits_on = 0;
+        for(const dynamic_bitset_t& row: rows)
+        {
+            bits_on += do_count(row);
+        }
+        if(bits_on * sparse_matrix_density_inverse * pool.size() < rows.size() * columns)
+        {
+            return detail::scatter_bits_on(rows, columns);
+        }
+
+        const size_t row_tiles = (rows.size() + 63) / 64;
+        const size_t column_tiles = (columns + 63) / 64;
+        const size_t tiles_per_task = detail::column_tiles_per_task(column_tiles, pool.size());
+        const size_t tasks = (column_tiles + tiles_per_task - 1) / tiles_per_task;
+
+        std::vector<std::vector<size_t>> result(columns);
+        pool.run(
+          tasks,
+          [&](size_t task) noexcept
+          {
+              const size_t first_column_tile = task * tiles_per_task;
+              const size_t task_column_tiles = std::min(tiles_per_task, column_tiles - first_column_tile);
+              const size_t first_column = first_column_tile * 64;
+              const size_t task_columns = std::min(task_column_tiles * 64, columns - first_column);
+
+              // transposed columns: words [column * row_tiles, (column + 1) * row_tiles) are the bits of a column
+              std::vector<uint64_t> columns_words(task_column_tiles * 64 * row_tiles);
+              std::array<std::array<uint64_t, 64>, detail::group_column_tiles> tiles;
+              for(size_t row_tile = 0; row_tile < row_tiles; ++row_tile)
+              {
+                  const size_t first_row = row_tile * 64;
+                  const size_t tile_rows = std::min<size_t>(rows.size() - first_row, 64);
+                  for(size_t i = 0; i < tile_rows; ++i)
+                  {
+                      for(size_t j = 0; j < task_column_tiles; ++j)
+                      {
+                          tiles[j][i] = detail::load_word(rows[first_row + i], first_column_tile + j);
+                      }
+                  }
+
+                  for(size_t j = 0; j < task_column_tiles; ++j)
+                  {
+                      std::array<uint64_t, 64>& tile = tiles[j];
+                      uint64_t* tile_columns_words = columns_words.data() + j * 64 * row_tiles;
+                      size_t tile_bits_on = 0;
+                      for(size_t i = 0; i < tile_rows; ++i)
+                      {
+                          tile_bits_on += static_cast<size_t>(std::popcount(tile[i]));
+                      }
+
+                      // sparse tile, cheaper to set its bits one by one than to transpose it
+                      if(tile_bits_on <= sparse_tile_bits_on)
+                      {
+                          for(size_t i = 0; i < tile_rows; ++i)
+                          {
+                              for(uint64_t word = tile[i]; word != 0; word &= word - 1)
+                              {
+                                  const size_t column = static_cast<size_t>(std::countr_zero(word));
+                                  tile_columns_words[column * row_tiles + row_tile] |= uint64_t(1) << i;
+                              }
+                          }
+                          continue;
+                      }
+
+                      std::fill(tile.begin() + static_cast<ptrdiff_t>(tile_rows), tile.end(), uint64_t(0));
+                      kernels::transpose_64x64(tile);
+                      for(size_t i = 0; i < 64; ++i)
+                      {
+                          tile_columns_words[i * row_tiles + row_tile] = tile[i];
+                      }
+                  }
+              }
+
+              for(size_t i = 0; i < task_columns; ++i)
+              {
+                  const std::span<const uint64_t> column_words(columns_words.data() + i * row_tiles, row_tiles);
+                  size_t column_bits_on = 0;
+                  for(const uint64_t word: column_words)
+                  {
+                      column_bits_on += static_cast<size_t>(std::popcount(word));
+                  }
+
+                  std::vector<size_t>& column_rows = result[first_column + i];
+                  column_rows.reserve(column_bits_on);
+                  for(size_t row_tile = 0; row_tile < row_tiles; ++row_tile)
+                  {
+                      for(uint64_t word = column_words[row_tile]; word != 0; word &= word - 1)
+                      {
+                          column_rows.push_back(row_tile * 64 + static_cast<size_t>(std::countr_zero(word)));
+                      }
+                  }
+              }
+          });
+        return result;
+    }
+} // namespace fix::dynamic_bitset
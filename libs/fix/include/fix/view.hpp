@@ -0,0 +1,517 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/bitset_traits.hpp>
+#include <fix/kernels.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace fix::dynamic_bitset
+{
+    template<typename block_t>
+    class view;
+
+    namespace detail
+    {
+        template<typename T>
+        struct is_view : std::false_type
+        {
+        };
+
+        template<typename block_t>
+        struct is_view<view<block_t>> : std::true_type
+        {
+        };
+
+        template<typename operand_t>
+        using operand_block_t = std::remove_const_t<typename std::remove_cvref_t<operand_t>::block_type>;
+
+        template<typename operand_t>
+        using bitset_block_t = typename decltype(blocks(std::declval<const operand_t&>()))::value_type;
+
+        // operand of a view operation: a view or a bitset with blocks of the same type
+        template<typename operand_t, typename block_t>
+        concept view_operand =
+          (is_view<std::remove_cvref_t<operand_t>>::value
+           && std::same_as<operand_block_t<operand_t>, std::remove_const_t<block_t>>)
+          || (has_blocks<const operand_t> && std::same_as<bitset_block_t<operand_t>, std::remove_const_t<block_t>>);
+
+        // bits [pos, pos + bits) of data moved to the low bits, the other bits are unspecified
+        // only the blocks containing the requested bits are read
+        template<std::unsigned_integral block_t>
+        [[nodiscard]] inline block_t load_bits(const block_t* data, size_t pos, size_t bits) noexcept
+        {
+            constexpr size_t block_bits = kernels::bits_per_block<block_t>;
+            const size_t index = pos / block_bits;
+            const size_t shift = pos % block_bits;
+            block_t result = static_cast<block_t>(data[index] >> shift);
+            if(shift != 0 && shift + bits > block_bits)
+            {
+                result |= static_cast<block_t>(data[index + 1] << (block_bits - shift));
+            }
+            return result;
+        }
+
+        // blocks [index, index + 1] shifted right by shift in (0, bits_per_block), branchless for the unaligned loops
+        template<std::unsigned_integral block_t>
+        [[nodiscard]] inline block_t load_shifted(const block_t* data, size_t index, size_t shift) noexcept
+        {
+            const size_t high_shift = kernels::bits_per_block<block_t> - shift;
+            return static_cast<block_t>(static_cast<block_t>(data[index] >> shift)
+                                        | static_cast<block_t>(data[index + 1] << high_shift));
+        }
+
+        // 64 bits of data starting at bit pos, the blocks are read as little endian bytes like in the kernels
+        [[nodiscard]] inline uint64_t load_word_bits(const std::byte* data, size_t pos) noexcept
+        {
+            const std::byte* bytes = data + pos / CHAR_BIT;
+            const size_t shift = pos % CHAR_BIT;
+            uint64_t word;
+            std::memcpy(&word, bytes, sizeof(word));
+            if(shift != 0)
+            {
+                const uint64_t next_byte = std::to_integer<uint8_t>(bytes[sizeof(word)]);
+                word = (word >> shift) | (next_byte << (64 - shift));
+            }
+            return word;
+        }
+
+        // lhs[i] = lhs[i] op operand bits from operand_pos, 64 bits at a time, return the number of blocks processed
+        template<kernels::simd::operation op, std::unsigned_integral block_t>
+        [[nodiscard]] inline size_t
+        shifted_transform(block_t* lhs, size_t blocks, const block_t* operand, size_t operand_pos) noexcept
+        {
+            constexpr size_t step = kernels::detail::blocks_per_word<block_t>;
+            constexpr size_t word_bits = step * kernels::bits_per_block<block_t>;
+            const std::byte* operand_bytes = reinterpret_cast<const std::byte*>(operand);
+            size_t i = 0;
+            for(; i + step <= blocks; i += step)
+            {
+                kernels::detail::store(lhs + i,
+                                       kernels::detail::apply<op>(kernels::detail::load(lhs + i),
+                                                                  load_word_bits(operand_bytes, operand_pos)));
+                operand_pos += word_bits;
+            }
+            return i;
+        }
+
+        // count of the bits on in lhs[i] op operand bits from operand_pos, 64 bits at a time, added to result
+        // return the number of blocks processed
+        template<kernels::simd::operation op, std::unsigned_integral block_t>
+        [[nodiscard]] inline size_t shifted_transform_count(
+          const block_t* lhs, size_t blocks, const block_t* operand, size_t operand_pos, size_t& result) noexcept
+        {
+            constexpr size_t step = kernels::detail::blocks_per_word<block_t>;
+            constexpr size_t word_bits = step * kernels::bits_per_block<block_t>;
+            const std::byte* operand_bytes = reinterpret_cast<const std::byte*>(operand);
+            // independent accumulators to not serialize on the popcount latency
+            size_t result_0 = 0;
+            size_t result_1 = 0;
+            size_t i = 0;
+            for(; i + 2 * step <= blocks; i += 2 * step)
+            {
+                result_0 += kernels::detail::popcount(kernels::detail::apply<op>(
+                  kernels::detail::load(lhs + i), load_word_bits(operand_bytes, operand_pos)));
+                result_1 += kernels::detail::popcount(kernels::detail::apply<op>(
+                  kernels::detail::load(lhs + i + step), load_word_bits(operand_bytes, operand_pos + word_bits)));
+                operand_pos += 2 * word_bits;
+            }
+            for(; i + step <= blocks; i += step)
+            {
+                result_0 += kernels::detail::popcount(kernels::detail::apply<op>(
+                  kernels::detail::load(lhs + i), load_word_bits(operand_bytes, operand_pos)));
+                operand_pos += word_bits;
+            }
+            result += result_0 + result_1;
+            return i;
+        }
+
+        // function(bit_pos), false if the iteration must stop
+        template<typename Function>
+        [[nodiscard]] bool invoke_bit(Function& function, size_t bit_pos)
+        {
+            if constexpr(std::same_as<std::invoke_result_t<Function&, size_t>, void>)
+            {
+                std::invoke(function, bit_pos);
+                return true;
+            }
+            else
+            {
+                return static_cast<bool>(std::invoke(function, bit_pos));
+            }
+        }
+    } // namespace detail
+
+    // Non-owning view over a range of bits of a dynamic bitset, to work on a region of a bitset without copying it.
+    //
+    // block_t is the block type of the viewed bitset, const for a read-only view. Like std::span the view does not
+    // propagate its own constness: the write operations are const members and modify the viewed bits. The bits
+    // outside the range are never modified. Operations between views (or a view and a bitset, see make_view) starting
+    // at the same offset in their first block use the kernels, the others shift the operand blocks one at a time.
+    template<typename block_t>
+    class view final
+    {
+    public:
+        using block_type = block_t;
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+        view() noexcept = default;
+
+        // bits [first, first + size) of blocks
+        view(std::span<block_t> blocks, size_t first, size_t size) noexcept
+          : m_data(blocks.data() + first / bits_per_block)
+          , m_offset(first % bits_per_block)
+          , m_size(size)
+        {
+            assert(first + size <= blocks.size() * bits_per_block);
+        }
+
+        // read-only view from a view
+        template<typename other_block_t>
+            requires std::same_as<block_t, const other_block_t>
+        view(const view<other_block_t>& other) noexcept // NOLINT(google-explicit-constructor)
+          : m_data(other.blocks().data())
+          , m_offset(other.offset())
+          , m_size(other.size())
+        {
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        // position of the first bit in the first block
+        [[nodiscard]] size_t offset() const noexcept
+        {
+            return m_offset;
+        }
+
+        // blocks containing the bits of the view, the first and last ones can contain bits outside of the view
+        [[nodiscard]] std::span<block_t> blocks() const noexcept
+        {
+            return {m_data, (m_offset + m_size + bits_per_block - 1) / bits_per_block};
+        }
+
+        // bits [first, first + size) of the view
+        [[nodiscard]] view subview(size_t first, size_t size) const noexcept
+        {
+            assert(first + size <= m_size);
+            return view(blocks(), m_offset + first, size);
+        }
+
+        [[nodiscard]] bool test(size_t pos) const noexcept
+        {
+            assert(pos < m_size);
+            const size_t bit = m_offset + pos;
+            return ((m_data[bit / bits_per_block] >> (bit % bits_per_block)) & 1) != 0;
+        }
+
+        [[nodiscard]] size_t count() const noexcept
+        {
+            const size_t result = head_bits() != 0 ? kernels::detail::popcount(head_block()) : 0;
+            return result + kernels::count(const_body(), body_bits());
+        }
+
+        [[nodiscard]] bool any() const noexcept
+        {
+            if(head_bits() != 0 && head_block() != block_value(0))
+            {
+                return true;
+            }
+            return kernels::any(const_body(), body_bits());
+        }
+
+        [[nodiscard]] bool none() const noexcept
+        {
+            return !any();
+        }
+
+        [[nodiscard]] bool all() const noexcept
+        {
+            const size_t head = head_bits();
+            if(head != 0 && head_block() != kernels::last_block_mask<block_value>(head))
+            {
+                return false;
+            }
+            return kernels::all(const_body(), body_bits());
+        }
+
+        // position of the first bit on, npos if none
+        [[nodiscard]] size_t find_first() const noexcept
+        {
+            const size_t head = head_bits();
+            if(head != 0)
+            {
+                if(const block_value block = head_block(); block != block_value(0))
+                {
+                    return static_cast<size_t>(std::countr_zero(block));
+                }
+            }
+            const size_t result = kernels::find_first(const_body(), body_bits());
+            return result == std::numeric_limits<size_t>::max() ? npos : head + result;
+        }
+
+        // call function(bit_pos) for each bit on, stop early if function returns false
+        template<typename Function>
+        void iterate_bits_on(Function&& function) const
+        {
+            const size_t head = head_bits();
+            if(head != 0)
+            {
+                block_value block = head_block();
+                while(block != block_value(0))
+                {
+                    const size_t bit_pos = static_cast<size_t>(std::countr_zero(block));
+                    block &= static_cast<block_value>(block - 1);
+                    if(!detail::invoke_bit(function, bit_pos))
+                    {
+                        return;
+                    }
+                }
+            }
+            kernels::iterate_bits_on(const_body(),
+                                     body_bits(),
+                                     [&](size_t bit_pos) { return detail::invoke_bit(function, head + bit_pos); });
+        }
+
+        template<detail::view_operand<block_t> operand_t>
+            requires(!std::is_const_v<block_t>)
+        void or_equal(const operand_t& operand) const noexcept
+        {
+            transform<kernels::simd::operation::bit_or>(as_view(operand));
+        }
+
+        template<detail::view_operand<block_t> operand_t>
+            requires(!std::is_const_v<block_t>)
+        void and_equal(const operand_t& operand) const noexcept
+        {
+            transform<kernels::simd::operation::bit_and>(as_view(operand));
+        }
+
+        template<detail::view_operand<block_t> operand_t>
+            requires(!std::is_const_v<block_t>)
+        void xor_equal(const operand_t& operand) const noexcept
+        {
+            transform<kernels::simd::operation::bit_xor>(as_view(operand));
+        }
+
+        // *this &= ~operand
+        template<detail::view_operand<block_t> operand_t>
+            requires(!std::is_const_v<block_t>)
+        void minus_equal(const operand_t& operand) const noexcept
+        {
+            transform<kernels::simd::operation::bit_andnot>(as_view(operand));
+        }
+
+        template<detail::view_operand<block_t> operand_t>
+        [[nodiscard]] size_t or_count(const operand_t& operand) const noexcept
+        {
+            return transform_count<kernels::simd::operation::bit_or>(as_view(operand));
+        }
+
+        template<detail::view_operand<block_t> operand_t>
+        [[nodiscard]] size_t and_count(const operand_t& operand) const noexcept
+        {
+            return transform_count<kernels::simd::operation::bit_and>(as_view(operand));
+        }
+
+        // count of *this & ~operand
+        template<detail::view_operand<block_t> operand_t>
+        [[nodiscard]] size_t andnot_count(const operand_t& operand) const noexcept
+        {
+            return transform_count<kernels::simd::operation::bit_andnot>(as_view(operand));
+        }
+
+    private:
+        using block_value = std::remove_const_t<block_t>;
+        static constexpr size_t bits_per_block = kernels::bits_per_block<block_value>;
+
+        template<typename operand_t>
+        [[nodiscard]] static view<const block_value> as_view(const operand_t& operand) noexcept
+        {
+            if constexpr(detail::is_view<operand_t>::value)
+            {
+                return view<const block_value>(operand);
+            }
+            else
+            {
+                return view<const block_value>(fix::dynamic_bitset::blocks(operand), 0, operand.size());
+            }
+        }
+
+        // bits of the view in its first block when it does not start at a block boundary
+        [[nodiscard]] size_t head_bits() const noexcept
+        {
+            return m_offset == 0 ? 0 : std::min(m_size, bits_per_block - m_offset);
+        }
+
+        // head bits moved to the low bits, the other bits cleared
+        [[nodiscard]] block_value head_block() const noexcept
+        {
+            return static_cast<block_value>(static_cast<block_value>(m_data[0] >> m_offset)
+                                            & kernels::last_block_mask<block_value>(head_bits()));
+        }
+
+        // bits after the head, they start at a block boundary
+        [[nodiscard]] size_t body_bits() const noexcept
+        {
+            return m_size - head_bits();
+        }
+
+        [[nodiscard]] std::span<block_t> body() const noexcept
+        {
+            return {m_data + (m_offset == 0 ? 0 : 1), (body_bits() + bits_per_block - 1) / bits_per_block};
+        }
+
+        [[nodiscard]] std::span<const block_value> const_body() const noexcept
+        {
+            return body();
+        }
+
+        // *this = *this op operand
+        template<kernels::simd::operation op>
+        void transform(const view<const block_value>& operand) const noexcept
+        {
+            assert(m_size == operand.size());
+            const block_value* operand_data = operand.blocks().data();
+            size_t operand_pos = operand.offset();
+
+            // lhs = lhs op rhs on the bits of mask only
+            const auto merge = [](block_value& lhs, block_value rhs, block_value mask) noexcept
+            {
+                lhs = static_cast<block_value>((lhs & ~mask)
+                                               | (kernels::detail::apply<op>(lhs, rhs) & mask));
+            };
+
+            if(const size_t head = head_bits(); head != 0)
+            {
+                merge(m_data[0],
+                      static_cast<block_value>(detail::load_bits(operand_data, operand_pos, head) << m_offset),
+                      static_cast<block_value>(kernels::last_block_mask<block_value>(head) << m_offset));
+                operand_pos += head;
+            }
+
+            const std::span<block_t> lhs = body();
+            if(lhs.empty())
+            {
+                return;
+            }
+            const size_t full_blocks = body_bits() / bits_per_block;
+            if(operand_pos % bits_per_block == 0)
+            {
+                kernels::detail::transform<op>(
+                  lhs.first(full_blocks), std::span(operand_data + operand_pos / bits_per_block, full_blocks));
+            }
+            else
+            {
+                const block_value* operand_blocks = operand_data + operand_pos / bits_per_block;
+                const size_t shift = operand_pos % bits_per_block;
+                for(size_t i = detail::shifted_transform<op>(lhs.data(), full_blocks, operand_blocks, shift);
+                    i < full_blocks;
+                    ++i)
+                {
+                    lhs[i] = kernels::detail::apply<op>(lhs[i], detail::load_shifted(operand_blocks, i, shift));
+                }
+            }
+            if(const size_t tail = body_bits() % bits_per_block; tail != 0)
+            {
+                merge(lhs[full_blocks],
+                      detail::load_bits(operand_data, operand_pos + full_blocks * bits_per_block, tail),
+                      kernels::last_block_mask<block_value>(tail));
+            }
+        }
+
+        // count of the bits on in *this op operand
+        template<kernels::simd::operation op>
+        [[nodiscard]] size_t transform_count(const view<const block_value>& operand) const noexcept
+        {
+            assert(m_size == operand.size());
+            const block_value* operand_data = operand.blocks().data();
+            size_t operand_pos = operand.offset();
+            size_t result = 0;
+
+            if(const size_t head = head_bits(); head != 0)
+            {
+                const block_value block =
+                  kernels::detail::apply<op>(head_block(), detail::load_bits(operand_data, operand_pos, head));
+                result += kernels::detail::popcount(
+                  static_cast<block_value>(block & kernels::last_block_mask<block_value>(head)));
+                operand_pos += head;
+            }
+
+            const std::span<const block_value> lhs = const_body();
+            if(lhs.empty())
+            {
+                return result;
+            }
+            if(operand_pos % bits_per_block == 0)
+            {
+                return result
+                       + kernels::detail::transform_count<op>(
+                         lhs, std::span(operand_data + operand_pos / bits_per_block, lhs.size()), body_bits());
+            }
+            const size_t full_blocks = body_bits() / bits_per_block;
+            const block_value* operand_blocks = operand_data + operand_pos / bits_per_block;
+            const size_t shift = operand_pos % bits_per_block;
+            for(size_t i = detail::shifted_transform_count<op>(lhs.data(), full_blocks, operand_blocks, shift, result);
+                i < full_blocks;
+                ++i)
+            {
+                result += kernels::detail::popcount(
+                  kernels::detail::apply<op>(lhs[i], detail::load_shifted(operand_blocks, i, shift)));
+            }
+            if(const size_t tail = body_bits() % bits_per_block; tail != 0)
+            {
+                const block_value block = kernels::detail::apply<op>(
+                  lhs[full_blocks], detail::load_bits(operand_data, operand_pos + full_blocks * bits_per_block, tail));
+                result += kernels::detail::popcount(
+                  static_cast<block_value>(block & kernels::last_block_mask<block_value>(tail)));
+            }
+            return result;
+        }
+
+        block_t* m_data = nullptr;
+        size_t m_offset = 0;
+        size_t m_size = 0;
+    };
+
+    // view over bits [first, first + size) of a bitset with blocks, read-only for a const bitset
+    template<has_blocks dynamic_bitset_t>
+    [[nodiscard]] auto make_view(dynamic_bitset_t& bitset, size_t first, size_t size) noexcept
+    {
+        assert(first + size <= bitset.size());
+        const auto bitset_blocks = blocks(bitset);
+        return view<typename decltype(bitset_blocks)::element_type>(bitset_blocks, first, size);
+    }
+
+    // view over all the bits of a bitset with blocks, read-only for a const bitset
+    template<has_blocks dynamic_bitset_t>
+    [[nodiscard]] auto make_view(dynamic_bitset_t& bitset) noexcept
+    {
+        return make_view(bitset, 0, bitset.size());
+    }
+} // namespace fix::dynamic_bitset
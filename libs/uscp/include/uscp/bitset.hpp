@@ -0,0 +1,109 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/dynamic_bitset.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+
+// Bitsets of the points and of the subsets of an instance.
+//
+// Dynamic bitsets have the size of the instance. Fixed-size bitsets (std::bitset<N>) are used for instances with at
+// most N points and N subsets: the bits of the instance are the first ones and the bits after them are always off, so
+// that the fix adapters work on the N bits, only the operations depending on the size go through these functions.
+namespace uscp
+{
+    // largest number of bits of an instance held by a dynamic_bitset_t
+    template<typename dynamic_bitset_t>
+    [[nodiscard]] constexpr size_t max_bits() noexcept
+    {
+        if constexpr(fix::dynamic_bitset::fixed_size<dynamic_bitset_t>)
+        {
+            return dynamic_bitset_t().size();
+        }
+        else
+        {
+            return std::numeric_limits<size_t>::max();
+        }
+    }
+
+    // bitset of bits bits, all off
+    template<typename dynamic_bitset_t>
+    [[nodiscard]] dynamic_bitset_t make_bitset(size_t bits)
+    {
+        if constexpr(fix::dynamic_bitset::fixed_size<dynamic_bitset_t>)
+        {
+            assert(bits <= max_bits<dynamic_bitset_t>());
+            return dynamic_bitset_t();
+        }
+        else
+        {
+            return dynamic_bitset_t(bits);
+        }
+    }
+
+    template<typename dynamic_bitset_t>
+    void resize_bitset(dynamic_bitset_t& bitset, size_t bits)
+    {
+        if constexpr(fix::dynamic_bitset::fixed_size<dynamic_bitset_t>)
+        {
+            assert(bits <= max_bits<dynamic_bitset_t>());
+            static_cast<void>(bitset);
+        }
+        else
+        {
+            bitset.resize(bits);
+        }
+    }
+
+    // bitsets choosing their representation from the density of their bits, as fix::auto_bitset, are given the expected
+    // fraction of bits on
+    template<typename dynamic_bitset_t>
+    void resize_bitset(dynamic_bitset_t& bitset, size_t bits, double expected_density)
+    {
+        if constexpr(requires { typename dynamic_bitset_t::expected_density; })
+        {
+            bitset.resize(bits, typename dynamic_bitset_t::expected_density{expected_density});
+        }
+        else
+        {
+            resize_bitset(bitset, bits);
+        }
+    }
+
+    // bitset holds bits bits
+    template<typename dynamic_bitset_t>
+    [[nodiscard]] bool has_bits(const dynamic_bitset_t& bitset, size_t bits) noexcept
+    {
+        if constexpr(fix::dynamic_bitset::fixed_size<dynamic_bitset_t>)
+        {
+            return bits <= bitset.size();
+        }
+        else
+        {
+            return bitset.size() == bits;
+        }
+    }
+
+    // the first bits bits are on
+    template<typename dynamic_bitset_t>
+    [[nodiscard]] bool all_bits(const dynamic_bitset_t& bitset, size_t bits) noexcept
+    {
+        assert(has_bits(bitset, bits));
+        if constexpr(fix::dynamic_bitset::fixed_size<dynamic_bitset_t>)
+        {
+            return fix::dynamic_bitset::do_count(bitset) == bits;
+        }
+        else
+        {
+            return fix::dynamic_bitset::do_all(bitset);
+        }
+    }
+} // namespace uscp
@@ -12,6 +12,7 @@
 #include <uscp/solution.hpp>
 
 #include <cstdlib>
+#include <span>
 
 namespace uscp::greedy
 {
@@ -28,25 +29,26 @@ uscp::greedy::solve(const uscp::problem::instance<dynamic_bitset_t>& problem) no
     while(!solution.cover_all_points)
     {
         size_t max_subset_number = solution.selected_subsets.size(); // invalid initial value
-        dynamic_bitset_t covered_points_with_max_subset(problem.points_number);
-        size_t covered_points_number_with_max_subset = fix::dynamic_bitset::do_count(solution.covered_points);
-        dynamic_bitset_t new_covered_points;
+        size_t max_subset_new_covered_points_number = 0;
         for(size_t i = 0; i < problem.subsets_number; ++i)
         {
-            if(solution.selected_subsets[i])
+            if(fix::dynamic_bitset::do_test(solution.selected_subsets, i))
             {
                 // already selected
                 continue;
             }
 
-            new_covered_points = solution.covered_points;
-            fix::dynamic_bitset::do_or_equal(new_covered_points, problem.subsets_points[i]);
-            const size_t new_covered_points_number = fix::dynamic_bitset::do_count(new_covered_points);
-            if(new_covered_points_number > covered_points_number_with_max_subset)
+            // marginal gain: points of the subset not covered yet
+            const size_t new_covered_points_number =
+              problem.sparse_subset(i) ? fix::dynamic_bitset::do_sparse_andnot_count(
+                                           std::span<const size_t>(problem.subsets_points_indices[i]),
+                                           solution.covered_points)
+                                       : fix::dynamic_bitset::do_andnot_count(problem.subsets_points[i],
+                                                                              solution.covered_points);
+            if(new_covered_points_number > max_subset_new_covered_points_number)
             {
                 max_subset_number = i;
-                covered_points_with_max_subset = new_covered_points;
-                covered_points_number_with_max_subset = new_covered_points_number;
+                max_subset_new_covered_points_number = new_covered_points_number;
             }
         }
 
@@ -58,8 +60,16 @@ uscp::greedy::solve(const uscp::problem::instance<dynamic_bitset_t>& problem) no
 
         // update solution
         fix::dynamic_bitset::do_set(solution.selected_subsets, max_subset_number);
-        solution.covered_points = covered_points_with_max_subset;
-        solution.cover_all_points = fix::dynamic_bitset::do_all(solution.covered_points);
+        if(problem.sparse_subset(max_subset_number))
+        {
+            fix::dynamic_bitset::do_sparse_or_equal(
+              solution.covered_points, std::span<const size_t>(problem.subsets_points_indices[max_subset_number]));
+        }
+        else
+        {
+            fix::dynamic_bitset::do_or_equal(solution.covered_points, problem.subsets_points[max_subset_number]);
+        }
+        solution.cover_all_points = uscp::all_bits(solution.covered_points, problem.points_number);
     }
 
     solution.compute_cover();
@@ -7,6 +7,9 @@
 //
 #pragma once
 
+#include <fix/dynamic_bitset.hpp>
+#include <uscp/bitset.hpp>
+
 #include <cstddef>
 #include <filesystem>
 #include <string>
@@ -14,6 +17,10 @@
 
 namespace uscp::problem
 {
+    // subsets with less than one point in sparse_density_inverse also store the positions of their points, the sparse
+    // adapters on the positions are faster than the bitset operations under this density
+    constexpr size_t sparse_density_inverse = 512;
+
     template<typename dynamic_bitset_t>
     struct instance final
     {
@@ -21,11 +28,40 @@ namespace uscp::problem
         size_t points_number = 0;
         size_t subsets_number = 0;
         std::vector<dynamic_bitset_t> subsets_points;
+        // positions of the points of the sparse subsets, empty for the other subsets
+        std::vector<std::vector<size_t>> subsets_points_indices;
 
         instance() noexcept = default;
         instance(const instance&) = default;
         instance(instance&&) noexcept = default;
         instance& operator=(const instance&) = default;
         instance& operator=(instance&&) noexcept = default;
+
+        [[nodiscard]] bool sparse_subset(size_t subset_number) const noexcept
+        {
+            return subset_number < subsets_points_indices.size() && !subsets_points_indices[subset_number].empty();
+        }
+
+        // fill subsets_points_indices from subsets_points
+        void compute_subsets_points_indices();
     };
 } // namespace uscp::problem
+
+template<typename dynamic_bitset_t>
+void uscp::problem::instance<dynamic_bitset_t>::compute_subsets_points_indices()
+{
+    subsets_points_indices.clear();
+    subsets_points_indices.resize(subsets_number);
+    for(size_t i = 0; i < subsets_number; ++i)
+    {
+        const size_t subset_points_number = fix::dynamic_bitset::do_count(subsets_points[i]);
+        if(subset_points_number * sparse_density_inverse >= points_number)
+        {
+            continue;
+        }
+        subsets_points_indices[i].reserve(subset_points_number);
+        fix::dynamic_bitset::do_iterate_bits_on(subsets_points[i],
+                                                [&](const size_t point) noexcept
+                                                { subsets_points_indices[i].push_back(point); });
+    }
+}
@@ -16,6 +16,8 @@
 #include <filesystem>
 #include <fstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace uscp::problem::or_library
 {
@@ -26,6 +28,7 @@ namespace uscp::problem::or_library
         instance.subsets_number = 0;
         instance.points_number = 0;
         instance.subsets_points.clear();
+        instance.subsets_points_indices.clear();
 
         // Check path exists
         if(std::error_code error; !std::filesystem::exists(path, error))
@@ -66,6 +69,11 @@ namespace uscp::problem::or_library
         {
             return tl::unexpected(fmt::format("{}: invalid points number: {}", path, points_number));
         }
+        if(points_number > max_bits<dynamic_bitset_t>())
+        {
+            return tl::unexpected(fmt::format(
+              "{}: {} points do not fit in a bitset of {} bits", path, points_number, max_bits<dynamic_bitset_t>()));
+        }
         instance.points_number = points_number;
 
         // Read subsets number
@@ -79,6 +87,11 @@ namespace uscp::problem::or_library
         {
             return tl::unexpected(fmt::format("{}: invalid subsets number: {}", path, subsets_number));
         }
+        if(subsets_number > max_bits<dynamic_bitset_t>())
+        {
+            return tl::unexpected(fmt::format(
+              "{}: {} subsets do not fit in a bitset of {} bits", path, subsets_number, max_bits<dynamic_bitset_t>()));
+        }
         instance.subsets_number = subsets_number;
 
         // Read subsets costs
@@ -92,12 +105,8 @@ namespace uscp::problem::or_library
             instance_stream >> ignored_subset_cost;
         }
 
-        // Read subsets covering points
-        instance.subsets_points.resize(subsets_number);
-        for(size_t i = 0; i < subsets_number; ++i)
-        {
-            instance.subsets_points[i].resize(points_number);
-        }
+        // Read subsets covering points, before making the subsets bitsets: they are given the density of the instance
+        std::vector<std::pair<size_t, size_t>> subsets_covering_points;
         for(size_t i_point = 0; i_point < points_number; ++i_point)
         {
             size_t subsets_covering_point = 0;
@@ -140,10 +149,24 @@ namespace uscp::problem::or_library
                       i_point,
                       subsets_number));
                 }
-                instance.subsets_points[subset_number][i_point] = true;
+                subsets_covering_points.emplace_back(subset_number, i_point);
             }
         }
 
+        const double density = static_cast<double>(subsets_covering_points.size())
+                               / (static_cast<double>(points_number) * static_cast<double>(subsets_number));
+        instance.subsets_points.resize(subsets_number);
+        for(size_t i = 0; i < subsets_number; ++i)
+        {
+            resize_bitset(instance.subsets_points[i], points_number, density);
+        }
+        for(const auto& [subset_number, i_point]: subsets_covering_points)
+        {
+            instance.subsets_points[subset_number][i_point] = true;
+        }
+
+        instance.compute_subsets_points_indices();
+
         // Success
         return instance;
     }
@@ -0,0 +1,180 @@
+//
+// Copyright (c) 2025 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#pragma once
+
+#include <fix/dynamic_bitset.hpp>
+#include <fix/parallel.hpp>
+#include <uscp/instance.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <vector>
+
+namespace uscp::overlap
+{
+    // bytes of subsets of a tile, the subsets of two tiles are compared against each other while they stay in the L2
+    constexpr size_t tile_size = 256 * 1024;
+
+    // subset-overlap graph: the neighbors of a subset are the other subsets sharing points with it, weighted by the
+    // number of shared points, stored in compressed sparse rows
+    struct graph final
+    {
+        // neighbors and weights of subset i are in [offsets[i], offsets[i + 1])
+        std::vector<size_t> offsets;
+        // in increasing order for each subset
+        std::vector<uint32_t> neighbors;
+        std::vector<uint32_t> weights;
+
+        [[nodiscard]] size_t subsets_number() const noexcept
+        {
+            return offsets.empty() ? 0 : offsets.size() - 1;
+        }
+
+        // number of subsets pairs sharing points
+        [[nodiscard]] size_t edges_number() const noexcept
+        {
+            return neighbors.size() / 2;
+        }
+
+        [[nodiscard]] std::span<const uint32_t> subset_neighbors(size_t subset_number) const noexcept
+        {
+            return std::span<const uint32_t>(neighbors).subspan(
+              offsets[subset_number], offsets[subset_number + 1] - offsets[subset_number]);
+        }
+
+        [[nodiscard]] std::span<const uint32_t> subset_weights(size_t subset_number) const noexcept
+        {
+            return std::span<const uint32_t>(weights).subspan(offsets[subset_number],
+                                                              offsets[subset_number + 1] - offsets[subset_number]);
+        }
+    };
+
+    // compare all subsets pairs with fused AND-popcounts, tiles of subsets pairs are split over the thread pool
+    template<typename dynamic_bitset_t>
+    [[nodiscard]] graph
+    build(const problem::instance<dynamic_bitset_t>& problem,
+          fix::dynamic_bitset::parallel::thread_pool& pool = fix::dynamic_bitset::parallel::default_thread_pool());
+
+    namespace detail
+    {
+        struct edge final
+        {
+            uint32_t first_subset;
+            uint32_t second_subset;
+            uint32_t weight;
+        };
+
+        // number of points shared by two subsets, through the positions of the points of a sparse one
+        template<typename dynamic_bitset_t>
+        [[nodiscard]] size_t shared_points_number(const problem::instance<dynamic_bitset_t>& problem,
+                                                  size_t first_subset,
+                                                  size_t second_subset) noexcept
+        {
+            if(problem.sparse_subset(first_subset) || problem.sparse_subset(second_subset))
+            {
+                const size_t sparse_subset = problem.sparse_subset(first_subset) ? first_subset : second_subset;
+                const size_t other_subset = sparse_subset == first_subset ? second_subset : first_subset;
+                const std::span<const size_t> sparse_points(problem.subsets_points_indices[sparse_subset]);
+                return sparse_points.size()
+                       - fix::dynamic_bitset::do_sparse_andnot_count(sparse_points,
+                                                                     problem.subsets_points[other_subset]);
+            }
+            return fix::dynamic_bitset::do_and_count(problem.subsets_points[first_subset],
+                                                     problem.subsets_points[second_subset]);
+        }
+    } // namespace detail
+} // namespace uscp::overlap
+
+template<typename dynamic_bitset_t>
+uscp::overlap::graph uscp::overlap::build(const uscp::problem::instance<dynamic_bitset_t>& problem,
+                                          fix::dynamic_bitset::parallel::thread_pool& pool)
+{
+    assert(problem.subsets_number <= std::numeric_limits<uint32_t>::max());
+    const size_t subsets_number = problem.subsets_number;
+    const size_t subset_bytes = std::max<size_t>((problem.points_number + 7) / 8, 1);
+    // at least two tiles per thread to balance the load between the threads
+    const size_t threads_tile_subsets = (subsets_number + 2 * pool.size() - 1) / (2 * pool.size());
+    const size_t tile_subsets = std::max<size_t>(std::min(tile_size / subset_bytes, threads_tile_subsets), 1);
+    const size_t tiles = (subsets_number + tile_subsets - 1) / tile_subsets;
+
+    // one task per pair of tiles (first_tile <= second_tile), each with its own edges to not synchronize the threads
+    std::vector<std::vector<detail::edge>> tasks_edges(tiles * (tiles + 1) / 2);
+    pool.run(tasks_edges.size(),
+             [&](size_t task) noexcept
+             {
+                 // task = second_tile * (second_tile + 1) / 2 + first_tile
+                 size_t second_tile = 0;
+                 while((second_tile + 1) * (second_tile + 2) / 2 <= task)
+                 {
+                     ++second_tile;
+                 }
+                 const size_t first_tile = task - second_tile * (second_tile + 1) / 2;
+
+                 const size_t first_begin = first_tile * tile_subsets;
+                 const size_t first_end = std::min(first_begin + tile_subsets, subsets_number);
+                 const size_t second_begin = second_tile * tile_subsets;
+                 const size_t second_end = std::min(second_begin + tile_subsets, subsets_number);
+                 std::vector<detail::edge>& edges = tasks_edges[task];
+                 for(size_t i = first_begin; i < first_end; ++i)
+                 {
+                     for(size_t j = std::max(second_begin, i + 1); j < second_end; ++j)
+                     {
+                         const size_t shared_points_number = detail::shared_points_number(problem, i, j);
+                         if(shared_points_number > 0)
+                         {
+                             edges.push_back({static_cast<uint32_t>(i),
+                                              static_cast<uint32_t>(j),
+                                              static_cast<uint32_t>(shared_points_number)});
+                         }
+                     }
+                 }
+             });
+
+    // compressed sparse rows, each edge in the rows of its two subsets
+    // going through the tasks in order fills the rows with increasing neighbors: the tasks of a row tile as second
+    // tile come first, then its diagonal task, then the tasks of the following tiles
+    graph result;
+    result.offsets.assign(subsets_number + 1, 0);
+    size_t edges_number = 0;
+    for(const std::vector<detail::edge>& edges: tasks_edges)
+    {
+        edges_number += edges.size();
+        for(const detail::edge& edge: edges)
+        {
+            ++result.offsets[edge.first_subset + 1];
+            ++result.offsets[edge.second_subset + 1];
+        }
+    }
+    for(size_t i = 0; i < subsets_number; ++i)
+    {
+        result.offsets[i + 1] += result.offsets[i];
+    }
+    result.neighbors.resize(2 * edges_number);
+    result.weights.resize(2 * edges_number);
+    std::vector<size_t> positions(result.offsets.begin(), result.offsets.end() - 1);
+    for(const std::vector<detail::edge>& edges: tasks_edges)
+    {
+        for(const detail::edge& edge: edges)
+        {
+            result.neighbors[positions[edge.first_subset]] = edge.second_subset;
+            result.weights[positions[edge.first_subset]++] = edge.weight;
+            result.neighbors[positions[edge.second_subset]] = edge.first_subset;
+            result.weights[positions[edge.second_subset]++] = edge.weight;
+        }
+    }
+
+    assert(std::ranges::all_of(std::views::iota(size_t(0), subsets_number),
+                               [&](size_t i) { return std::ranges::is_sorted(result.subset_neighbors(i)); }));
+
+    return result;
+}
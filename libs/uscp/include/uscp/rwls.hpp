@@ -7,21 +7,26 @@
 //
 #pragma once
 
+#include <fix/rank_select.hpp>
+#include <fix/transpose.hpp>
 #include <uscp/instance.hpp>
 #include <uscp/random.hpp>
 #include <uscp/rwls.hpp>
 #include <uscp/solution.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <deque>
+#include <span>
 #include <utility>
 #include <vector>
 
 namespace uscp::rwls
 {
     constexpr size_t TABU_LIST_LENGTH = 2;
+    constexpr size_t BITS_ON_BATCH_SIZE = 256;
 
     template<typename dynamic_bitset_t>
     class rwls final
@@ -57,11 +62,13 @@ namespace uscp::rwls
             solution<dynamic_bitset_t>& best_solution;
             solution<dynamic_bitset_t> current_solution;
             dynamic_bitset_t uncovered_points; // RWLS name: L
+            fix::dynamic_bitset::rank_select<dynamic_bitset_t> uncovered_points_index;
             std::vector<point_information> points_information;
             std::vector<subset_information> subsets_information;
             std::deque<size_t> tabu_subsets;
 
             dynamic_bitset_t subsets_tmp;
+            typename solution<dynamic_bitset_t>::cover_buffers best_solution_cover_buffers;
 
             explicit resolution_data(solution<dynamic_bitset_t>& solution, random_engine& generator) noexcept;
         };
@@ -99,22 +106,25 @@ uscp::rwls::rwls<dynamic_bitset_t>::rwls(const problem::instance<dynamic_bitset_
     , m_initialized(false)
 {
     m_subsets_points.resize(m_problem.subsets_number);
-    m_subsets_covering_points.resize(m_problem.points_number);
 }
 
 template<typename dynamic_bitset_t>
 void uscp::rwls::rwls<dynamic_bitset_t>::initialize() noexcept
 {
+    std::array<size_t, BITS_ON_BATCH_SIZE> bits_on_buffer;
     for(size_t i = 0; i < m_problem.subsets_number; ++i)
     {
-        fix::dynamic_bitset::do_iterate_bits_on(m_problem.subsets_points[i],
-                                                [&](size_t bit_on) noexcept
-                                                {
-                                                    m_subsets_points[i].push_back(bit_on);
-                                                    m_subsets_covering_points[bit_on].push_back(i);
-                                                });
+        fix::dynamic_bitset::do_iterate_bits_on_batched(
+          m_problem.subsets_points[i],
+          bits_on_buffer,
+          [&](std::span<const size_t> bits_on) noexcept
+          { m_subsets_points[i].insert(m_subsets_points[i].end(), bits_on.begin(), bits_on.end()); });
     }
 
+    // points by subsets matrix, built 64x64 bits at a time instead of one push_back per point of each subset
+    m_subsets_covering_points = fix::dynamic_bitset::transpose_bits_on(
+      std::span<const dynamic_bitset_t>(m_problem.subsets_points), m_problem.points_number);
+
     m_initialized = true;
 }
 
@@ -131,6 +141,7 @@ uscp::solution<dynamic_bitset_t> uscp::rwls::rwls<dynamic_bitset_t>::improve(
     resolution_data data(solution_final, generator);
     const std::vector<long long> points_initial_weights(m_problem.points_number, 1);
     init(data, points_initial_weights);
+    std::array<size_t, BITS_ON_BATCH_SIZE> bits_on_buffer;
 
     for(size_t step = 0; step < steps; ++step)
     {
@@ -143,7 +154,7 @@ uscp::solution<dynamic_bitset_t> uscp::rwls::rwls<dynamic_bitset_t>::improve(
                 remove_subset(data, selected_subset);
             } while(fix::dynamic_bitset::do_none(data.uncovered_points));
 
-            data.best_solution.compute_cover();
+            data.best_solution.compute_cover(data.best_solution_cover_buffers);
             assert(data.best_solution.cover_all_points);
             if(!data.best_solution.cover_all_points)
             {
@@ -165,19 +176,23 @@ uscp::solution<dynamic_bitset_t> uscp::rwls::rwls<dynamic_bitset_t>::improve(
         make_tabu(data, subset_to_add);
 
         // update points weights
-        fix::dynamic_bitset::do_iterate_bits_on(
+        fix::dynamic_bitset::do_iterate_bits_on_batched(
           data.uncovered_points,
-          [&](size_t uncovered_points_bit_on) noexcept
+          bits_on_buffer,
+          [&](std::span<const size_t> uncovered_points_bits_on) noexcept
           {
-              assert(data.points_information[uncovered_points_bit_on].subsets_covering_in_solution == 0);
+              for(const size_t uncovered_points_bit_on: uncovered_points_bits_on)
+              {
+                  assert(data.points_information[uncovered_points_bit_on].subsets_covering_in_solution == 0);
 
-              ++data.points_information[uncovered_points_bit_on].weight;
+                  ++data.points_information[uncovered_points_bit_on].weight;
 
-              // update subsets score depending on this point weight
-              // subset that can cover the point if added to solution
-              for(size_t subset_covering_point: m_subsets_covering_points[uncovered_points_bit_on])
-              {
-                  ++data.subsets_information[subset_covering_point].score;
+                  // update subsets score depending on this point weight
+                  // subset that can cover the point if added to solution
+                  for(size_t subset_covering_point: m_subsets_covering_points[uncovered_points_bit_on])
+                  {
+                      ++data.subsets_information[subset_covering_point].score;
+                  }
               }
           });
 #if !defined(NDEBUG)
@@ -199,11 +214,13 @@ uscp::rwls::rwls<dynamic_bitset_t>::resolution_data::resolution_data(solution<dy
     : generator(generator_)
     , best_solution(solution)
     , current_solution(solution)
-    , uncovered_points(solution.problem.points_number)
+    , uncovered_points(make_bitset<dynamic_bitset_t>(solution.problem.points_number))
+    , uncovered_points_index(uncovered_points)
     , points_information()
     , subsets_information()
     , tabu_subsets()
-    , subsets_tmp(solution.problem.subsets_number)
+    , subsets_tmp(make_bitset<dynamic_bitset_t>(solution.problem.subsets_number))
+    , best_solution_cover_buffers(solution.problem.subsets_number)
 {
     points_information.resize(solution.problem.points_number);
     subsets_information.resize(solution.problem.subsets_number);
@@ -304,6 +321,7 @@ void uscp::rwls::rwls<dynamic_bitset_t>::add_subset(resolution_data& data, size_
         if(data.points_information[subset_point].subsets_covering_in_solution == 1)
         {
             // point newly covered
+            data.uncovered_points_index.bit_reset(subset_point);
             const long long point_weight = data.points_information[subset_point].weight;
             for(size_t neighbor: m_subsets_covering_points[subset_point])
             {
@@ -365,6 +383,7 @@ void uscp::rwls::rwls<dynamic_bitset_t>::remove_subset(resolution_data& data, si
         {
             // point newly uncovered
             fix::dynamic_bitset::do_set(data.uncovered_points, subset_point);
+            data.uncovered_points_index.bit_set(subset_point);
             const long long point_weight = data.points_information[subset_point].weight;
             for(size_t neighbor: m_subsets_covering_points[subset_point])
             {
@@ -432,15 +451,20 @@ size_t uscp::rwls::rwls<dynamic_bitset_t>::select_subset_to_remove_no_timestamp(
     size_t selected_subset = fix::dynamic_bitset::do_find_first(data.current_solution.selected_subsets);
     assert(selected_subset < data.current_solution.selected_subsets.size());
     long long best_score = data.subsets_information[selected_subset].score;
-    fix::dynamic_bitset::do_iterate_bits_on(data.current_solution.selected_subsets,
-                                            [&](size_t bit_on) noexcept
-                                            {
-                                                if(data.subsets_information[bit_on].score > best_score)
-                                                {
-                                                    best_score = data.subsets_information[bit_on].score;
-                                                    selected_subset = bit_on;
-                                                }
-                                            });
+    std::array<size_t, BITS_ON_BATCH_SIZE> bits_on_buffer;
+    fix::dynamic_bitset::do_iterate_bits_on_batched(data.current_solution.selected_subsets,
+                                                    bits_on_buffer,
+                                                    [&](std::span<const size_t> bits_on) noexcept
+                                                    {
+                                                        for(const size_t bit_on: bits_on)
+                                                        {
+                                                            if(data.subsets_information[bit_on].score > best_score)
+                                                            {
+                                                                best_score = data.subsets_information[bit_on].score;
+                                                                selected_subset = bit_on;
+                                                            }
+                                                        }
+                                                    });
     assert(fix::dynamic_bitset::do_test(data.current_solution.selected_subsets, selected_subset));
     return selected_subset;
 }
@@ -453,16 +477,21 @@ size_t uscp::rwls::rwls<dynamic_bitset_t>::select_subset_to_remove(const resolut
     assert(remove_subset < data.current_solution.selected_subsets.size());
     std::pair<long long, long long> best_score_minus_timestamp(data.subsets_information[remove_subset].score,
                                                                -data.subsets_information[remove_subset].timestamp);
-    fix::dynamic_bitset::do_iterate_bits_on(
+    std::array<size_t, BITS_ON_BATCH_SIZE> bits_on_buffer;
+    fix::dynamic_bitset::do_iterate_bits_on_batched(
       data.current_solution.selected_subsets,
-      [&](size_t bit_on) noexcept
+      bits_on_buffer,
+      [&](std::span<const size_t> bits_on) noexcept
       {
-          const std::pair<long long, long long> current_score_timestamp(data.subsets_information[bit_on].score,
-                                                                        -data.subsets_information[bit_on].timestamp);
-          if(current_score_timestamp > best_score_minus_timestamp && !is_tabu(data, bit_on))
+          for(const size_t bit_on: bits_on)
           {
-              best_score_minus_timestamp = current_score_timestamp;
-              remove_subset = bit_on;
+              const std::pair<long long, long long> current_score_timestamp(
+                data.subsets_information[bit_on].score, -data.subsets_information[bit_on].timestamp);
+              if(current_score_timestamp > best_score_minus_timestamp && !is_tabu(data, bit_on))
+              {
+                  best_score_minus_timestamp = current_score_timestamp;
+                  remove_subset = bit_on;
+              }
           }
       });
     assert(fix::dynamic_bitset::do_test(data.current_solution.selected_subsets, remove_subset));
@@ -517,21 +546,13 @@ size_t uscp::rwls::rwls<dynamic_bitset_t>::select_subset_to_add(const resolution
 template<typename dynamic_bitset_t>
 size_t uscp::rwls::rwls<dynamic_bitset_t>::select_uncovered_point(resolution_data& data) noexcept
 {
-    assert(fix::dynamic_bitset::do_count(data.uncovered_points) > 0);
-    size_t selected_point = 0;
-    std::uniform_int_distribution<size_t> uncovered_point_dist(0, fix::dynamic_bitset::do_count(data.uncovered_points));
+    assert(data.uncovered_points_index.count() == fix::dynamic_bitset::do_count(data.uncovered_points));
+    assert(data.uncovered_points_index.count() > 0);
+    std::uniform_int_distribution<size_t> uncovered_point_dist(0, data.uncovered_points_index.count());
     const size_t selected_point_number = uncovered_point_dist(data.generator);
-    size_t current_point_number = 0;
-    fix::dynamic_bitset::do_iterate_bits_on(data.uncovered_points,
-                                            [&](size_t bit_on) noexcept
-                                            {
-                                                if(++current_point_number >= selected_point_number)
-                                                {
-                                                    selected_point = bit_on;
-                                                    return false;
-                                                }
-                                                return true;
-                                            });
+    // selected_point_number 0 and 1 both select the first uncovered point
+    const size_t selected_point =
+      data.uncovered_points_index.select(data.uncovered_points, std::max<size_t>(selected_point_number, 1) - 1);
     assert(fix::dynamic_bitset::do_test(data.uncovered_points, selected_point));
     return selected_point;
 }
@@ -10,7 +10,10 @@
 #include <fix/dynamic_bitset.hpp>
 #include <uscp/instance.hpp>
 
+#include <ranges>
+#include <span>
 #include <utility>
+#include <vector>
 
 namespace uscp
 {
@@ -28,15 +31,26 @@ namespace uscp
         solution& operator=(const solution& other);
         solution& operator=(solution&& other) noexcept;
 
-        void compute_cover() noexcept;
+        // selected subsets numbers of compute_cover(), reserved for all the subsets so that it does not allocate
+        struct cover_buffers final
+        {
+            std::vector<size_t> dense_subsets_numbers;
+            std::vector<size_t> sparse_subsets_numbers;
+
+            explicit cover_buffers(size_t subsets_number);
+        };
+
+        void compute_cover();
+        // for the callers computing the cover repeatedly, with buffers of the subsets number of the problem
+        void compute_cover(cover_buffers& buffers) noexcept;
     };
 } // namespace uscp
 
 template<typename dynamic_bitset_t>
 uscp::solution<dynamic_bitset_t>::solution(const uscp::problem::instance<dynamic_bitset_t>& problem_)
     : problem(problem_)
-    , selected_subsets(problem_.subsets_number)
-    , covered_points(problem_.points_number)
+    , selected_subsets(make_bitset<dynamic_bitset_t>(problem_.subsets_number))
+    , covered_points(make_bitset<dynamic_bitset_t>(problem_.points_number))
     , cover_all_points(false)
 {
 }
@@ -63,15 +77,55 @@ uscp::solution<dynamic_bitset_t>::operator=(solution<dynamic_bitset_t>&& other)
 }
 
 template<typename dynamic_bitset_t>
-void uscp::solution<dynamic_bitset_t>::compute_cover() noexcept
+uscp::solution<dynamic_bitset_t>::cover_buffers::cover_buffers(size_t subsets_number)
+    : dense_subsets_numbers()
+    , sparse_subsets_numbers()
+{
+    dense_subsets_numbers.reserve(subsets_number);
+    sparse_subsets_numbers.reserve(subsets_number);
+}
+
+template<typename dynamic_bitset_t>
+void uscp::solution<dynamic_bitset_t>::compute_cover()
 {
-    assert(selected_subsets.size() == problem.subsets_number);
-    assert(covered_points.size() == problem.points_number);
+    cover_buffers buffers(problem.subsets_number);
+    compute_cover(buffers);
+}
+
+template<typename dynamic_bitset_t>
+void uscp::solution<dynamic_bitset_t>::compute_cover(cover_buffers& buffers) noexcept
+{
+    assert(has_bits(selected_subsets, problem.subsets_number));
+    assert(has_bits(covered_points, problem.points_number));
+    assert(buffers.dense_subsets_numbers.capacity() >= problem.subsets_number);
+    assert(buffers.sparse_subsets_numbers.capacity() >= problem.subsets_number);
+
+    // dense subsets are reduced in one pass over covered_points, sparse subsets are scattered afterwards
+    buffers.dense_subsets_numbers.clear();
+    buffers.sparse_subsets_numbers.clear();
+    fix::dynamic_bitset::do_iterate_bits_on(selected_subsets,
+                                            [&](const size_t selected_subset) noexcept
+                                            {
+                                                if(problem.sparse_subset(selected_subset))
+                                                {
+                                                    buffers.sparse_subsets_numbers.push_back(selected_subset);
+                                                }
+                                                else
+                                                {
+                                                    buffers.dense_subsets_numbers.push_back(selected_subset);
+                                                }
+                                            });
 
     fix::dynamic_bitset::do_reset(covered_points);
-    fix::dynamic_bitset::do_iterate_bits_on(
-      selected_subsets,
-      [&](const size_t selected_subset) noexcept
-      { fix::dynamic_bitset::do_or_equal(covered_points, problem.subsets_points[selected_subset]); });
-    cover_all_points = fix::dynamic_bitset::do_all(covered_points);
+    fix::dynamic_bitset::do_or_reduce(
+      covered_points,
+      std::views::transform(buffers.dense_subsets_numbers,
+                            [&](const size_t selected_subset) noexcept -> const dynamic_bitset_t&
+                            { return problem.subsets_points[selected_subset]; }));
+    for(const size_t selected_subset: buffers.sparse_subsets_numbers)
+    {
+        fix::dynamic_bitset::do_sparse_or_equal(
+          covered_points, std::span<const size_t>(problem.subsets_points_indices[selected_subset]));
+    }
+    cover_all_points = all_bits(covered_points, problem.points_number);
 }